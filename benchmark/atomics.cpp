@@ -0,0 +1,72 @@
+#include "contended.h"
+#include <core/atomics.h>
+
+HD_BENCHMARK(atomic_fetch_add_contended, hud, HD_BENCH_THREAD_COUNTS)(hud_bench::state &state)
+{
+    hud::atomic<u64> counter {0};
+    hud_bench::run_contended(state, [&counter](const usize, const usize iteration_count) {
+        for (usize iteration = 0; iteration < iteration_count; iteration++) {
+            counter.fetch_add(1);
+        }
+    });
+    hud_bench::do_not_optimize(counter.load());
+}
+
+HD_BENCHMARK(atomic_fetch_add_contended, std, HD_BENCH_THREAD_COUNTS)(hud_bench::state &state)
+{
+    std::atomic<u64> counter {0};
+    hud_bench::run_contended(state, [&counter](const usize, const usize iteration_count) {
+        for (usize iteration = 0; iteration < iteration_count; iteration++) {
+            counter.fetch_add(1);
+        }
+    });
+    hud_bench::do_not_optimize(counter.load());
+}
+
+HD_BENCHMARK(atomic_fetch_add_relaxed_contended, hud, HD_BENCH_THREAD_COUNTS)(hud_bench::state &state)
+{
+    hud::atomic<u64> counter {0};
+    hud_bench::run_contended(state, [&counter](const usize, const usize iteration_count) {
+        for (usize iteration = 0; iteration < iteration_count; iteration++) {
+            counter.fetch_add(1, hud::atomics::memory_order_e::relaxed);
+        }
+    });
+    hud_bench::do_not_optimize(counter.load());
+}
+
+HD_BENCHMARK(atomic_fetch_add_relaxed_contended, std, HD_BENCH_THREAD_COUNTS)(hud_bench::state &state)
+{
+    std::atomic<u64> counter {0};
+    hud_bench::run_contended(state, [&counter](const usize, const usize iteration_count) {
+        for (usize iteration = 0; iteration < iteration_count; iteration++) {
+            counter.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    hud_bench::do_not_optimize(counter.load());
+}
+
+HD_BENCHMARK(atomic_compare_exchange_contended, hud, HD_BENCH_THREAD_COUNTS)(hud_bench::state &state)
+{
+    hud::atomic<u64> counter {0};
+    hud_bench::run_contended(state, [&counter](const usize, const usize iteration_count) {
+        for (usize iteration = 0; iteration < iteration_count; iteration++) {
+            u64 expected = counter.load(hud::atomics::memory_order_e::relaxed);
+            while (!counter.compare_exchange(expected, expected + 1)) {
+            }
+        }
+    });
+    hud_bench::do_not_optimize(counter.load());
+}
+
+HD_BENCHMARK(atomic_compare_exchange_contended, std, HD_BENCH_THREAD_COUNTS)(hud_bench::state &state)
+{
+    std::atomic<u64> counter {0};
+    hud_bench::run_contended(state, [&counter](const usize, const usize iteration_count) {
+        for (usize iteration = 0; iteration < iteration_count; iteration++) {
+            u64 expected = counter.load(std::memory_order_relaxed);
+            while (!counter.compare_exchange_strong(expected, expected + 1)) {
+            }
+        }
+    });
+    hud_bench::do_not_optimize(counter.load());
+}
@@ -0,0 +1,152 @@
+#ifndef HD_INC_BENCHMARK_BENCHMARK_H
+#define HD_INC_BENCHMARK_BENCHMARK_H
+#include <core/minimal.h>
+#include <chrono>
+#include <vector>
+
+namespace hud_bench
+{
+    /**
+     * State given to a benchmark function.
+     * The function must run its operation `iteration_count()` times, only this loop is timed.
+     * Setup done before the loop can be excluded from the timing with `reset_timer()`.
+     */
+    class state
+    {
+    public:
+        /**
+         * Construct a state for a run of `iteration_count` iterations.
+         * @param iteration_count Number of iterations to run
+         * @param size The size parameter of the benchmark
+         */
+        state(const usize iteration_count, const usize size) noexcept
+            : iteration_count_(iteration_count)
+            , size_(size)
+            , start_(clock::now())
+        {
+        }
+
+        /** Retrieves the number of iterations to run. */
+        [[nodiscard]] usize iteration_count() const noexcept
+        {
+            return iteration_count_;
+        }
+
+        /** Retrieves the size parameter of the benchmark (Number of elements, bytes, threads...). */
+        [[nodiscard]] usize size() const noexcept
+        {
+            return size_;
+        }
+
+        /** Restart the timer, everything done before is not timed. */
+        void reset_timer() noexcept
+        {
+            start_ = clock::now();
+        }
+
+        /** Set the number of bytes processed by one iteration, used to compute the throughput. */
+        void set_bytes_per_iteration(const usize byte_count) noexcept
+        {
+            bytes_per_iteration_ = byte_count;
+        }
+
+        /** Set the number of items processed by one iteration, used to compute the time per item. */
+        void set_items_per_iteration(const usize item_count) noexcept
+        {
+            items_per_iteration_ = item_count;
+        }
+
+        /** Retrieves the number of bytes processed by one iteration. */
+        [[nodiscard]] usize bytes_per_iteration() const noexcept
+        {
+            return bytes_per_iteration_;
+        }
+
+        /** Retrieves the number of items processed by one iteration. */
+        [[nodiscard]] usize items_per_iteration() const noexcept
+        {
+            return items_per_iteration_;
+        }
+
+        /** Retrieves the elapsed time in nanoseconds since the construction or the last `reset_timer()`. */
+        [[nodiscard]] f64 elapsed_ns() const noexcept
+        {
+            return std::chrono::duration<f64, std::nano>(clock::now() - start_).count();
+        }
+
+    private:
+        using clock = std::chrono::steady_clock;
+        /** Number of iterations to run. */
+        usize iteration_count_;
+        /** The size parameter of the benchmark. */
+        usize size_;
+        /** Number of bytes processed by one iteration. */
+        usize bytes_per_iteration_ = 0;
+        /** Number of items processed by one iteration. */
+        usize items_per_iteration_ = 1;
+        /** Start time of the timed loop. */
+        clock::time_point start_;
+    };
+
+    /** A registered benchmark. */
+    struct benchmark
+    {
+        /** Group of the benchmark. Benchmarks of the same group and size are compared together. */
+        const char *group;
+        /** Name of the implementation measured, `std` for the standard library reference. */
+        const char *name;
+        /** Sizes to run the benchmark with. */
+        std::vector<usize> sizes;
+        /** The function to measure. */
+        void (*function)(state &);
+    };
+
+    /** Retrieves all registered benchmarks. */
+    [[nodiscard]] std::vector<benchmark> &registry() noexcept;
+
+    /** Register a benchmark at static initialization. */
+    struct registrar
+    {
+        registrar(const char *group, const char *name, std::vector<usize> sizes, void (*function)(state &)) noexcept
+        {
+            registry().push_back({group, name, static_cast<std::vector<usize> &&>(sizes), function});
+        }
+    };
+
+    /** Prevent the compiler to optimize away a value. */
+    template<typename type_t>
+    inline void do_not_optimize(const type_t &value) noexcept
+    {
+#if defined(HD_COMPILER_MSVC)
+        static volatile const void *sink;
+        sink = &value;
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+    /** Prevent the compiler to reorder memory accesses around this point. */
+    inline void clobber_memory() noexcept
+    {
+#if defined(HD_COMPILER_MSVC)
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : : "memory");
+#endif
+    }
+
+} // namespace hud_bench
+
+#define HD_BENCH_CONCAT_IMPL(a, b) a##b
+#define HD_BENCH_CONCAT(a, b) HD_BENCH_CONCAT_IMPL(a, b)
+
+/**
+ * Register a benchmark function `void(hud_bench::state&)` run with each size of the list.
+ * Usage: HD_BENCHMARK(vector_add, hud, 16, 1024)(hud_bench::state &state) { ... }
+ */
+#define HD_BENCHMARK(group, name, ...)                                                                                                                   \
+    static void HD_BENCH_CONCAT(bench_##group##_##name, __LINE__)(hud_bench::state &);                                                                  \
+    static const hud_bench::registrar HD_BENCH_CONCAT(bench_registrar_##group##_##name, __LINE__) {#group, #name, {__VA_ARGS__}, &HD_BENCH_CONCAT(bench_##group##_##name, __LINE__)}; \
+    static void HD_BENCH_CONCAT(bench_##group##_##name, __LINE__)
+
+#endif // HD_INC_BENCHMARK_BENCHMARK_H
@@ -0,0 +1,209 @@
+#include "contended.h"
+#include "random.h"
+#include <core/containers/concurrent_hashmap.h>
+#include <core/containers/read_mostly_hashmap.h>
+#include <core/containers/hashset.h>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+// Each thread looks up random keys of a shared map and updates one key out of 16
+#define HD_BENCH_CONCURRENT_KEY_COUNT 65536
+
+HD_BENCHMARK(concurrent_hashmap_read_mostly, hud, HD_BENCH_THREAD_COUNTS)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(HD_BENCH_CONCURRENT_KEY_COUNT);
+    hud::concurrent_hashmap<u64, u64> map;
+    for (const u64 key : keys) {
+        map.add(key, key);
+    }
+    hud_bench::run_contended(state, [&](const usize thread_index, const usize iteration_count) {
+        usize found = 0;
+        for (usize iteration = 0; iteration < iteration_count; iteration++) {
+            const u64 key = keys[(iteration * 7919 + thread_index * 104729) % keys.size()];
+            if (iteration % 16 == 0) {
+                map.update_or_add(key, [](u64 &value) { value++; });
+            }
+            else {
+                found += map.contains(key) ? 1 : 0;
+            }
+        }
+        hud_bench::do_not_optimize(found);
+    });
+}
+
+HD_BENCHMARK(concurrent_hashmap_read_mostly, std, HD_BENCH_THREAD_COUNTS)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(HD_BENCH_CONCURRENT_KEY_COUNT);
+    std::mutex mutex;
+    std::unordered_map<u64, u64> map;
+    for (const u64 key : keys) {
+        map.emplace(key, key);
+    }
+    hud_bench::run_contended(state, [&](const usize thread_index, const usize iteration_count) {
+        usize found = 0;
+        for (usize iteration = 0; iteration < iteration_count; iteration++) {
+            const u64 key = keys[(iteration * 7919 + thread_index * 104729) % keys.size()];
+            const std::lock_guard<std::mutex> guard(mutex);
+            if (iteration % 16 == 0) {
+                map[key]++;
+            }
+            else {
+                found += map.contains(key) ? 1 : 0;
+            }
+        }
+        hud_bench::do_not_optimize(found);
+    });
+}
+
+// Same as above with sequential keys, `hud::hash_64` is the identity for integers and the shards must still be balanced
+
+HD_BENCHMARK(concurrent_hashmap_read_mostly_sequential, hud, HD_BENCH_THREAD_COUNTS)(hud_bench::state &state)
+{
+    hud::concurrent_hashmap<u64, u64> map;
+    for (u64 key = 0; key < HD_BENCH_CONCURRENT_KEY_COUNT; key++) {
+        map.add(key, key);
+    }
+    hud_bench::run_contended(state, [&](const usize thread_index, const usize iteration_count) {
+        usize found = 0;
+        for (usize iteration = 0; iteration < iteration_count; iteration++) {
+            const u64 key = (iteration * 7919 + thread_index * 104729) % HD_BENCH_CONCURRENT_KEY_COUNT;
+            if (iteration % 16 == 0) {
+                map.update_or_add(key, [](u64 &value) { value++; });
+            }
+            else {
+                found += map.contains(key) ? 1 : 0;
+            }
+        }
+        hud_bench::do_not_optimize(found);
+    });
+}
+
+HD_BENCHMARK(concurrent_hashmap_read_mostly_sequential, std, HD_BENCH_THREAD_COUNTS)(hud_bench::state &state)
+{
+    std::mutex mutex;
+    std::unordered_map<u64, u64> map;
+    for (u64 key = 0; key < HD_BENCH_CONCURRENT_KEY_COUNT; key++) {
+        map.emplace(key, key);
+    }
+    hud_bench::run_contended(state, [&](const usize thread_index, const usize iteration_count) {
+        usize found = 0;
+        for (usize iteration = 0; iteration < iteration_count; iteration++) {
+            const u64 key = (iteration * 7919 + thread_index * 104729) % HD_BENCH_CONCURRENT_KEY_COUNT;
+            const std::lock_guard<std::mutex> guard(mutex);
+            if (iteration % 16 == 0) {
+                map[key]++;
+            }
+            else {
+                found += map.contains(key) ? 1 : 0;
+            }
+        }
+        hud_bench::do_not_optimize(found);
+    });
+}
+
+// Each thread only looks up random keys of a shared map
+
+HD_BENCHMARK(read_mostly_hashmap_find, hud, HD_BENCH_THREAD_COUNTS)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(HD_BENCH_CONCURRENT_KEY_COUNT);
+    hud::read_mostly_hashmap<u64, u64> map;
+    map.update([&keys](auto &version) {
+        for (const u64 key : keys) {
+            version.add(key, key);
+        }
+    });
+    hud_bench::run_contended(state, [&](const usize thread_index, const usize iteration_count) {
+        auto reader = map.register_reader();
+        usize found = 0;
+        for (usize iteration = 0; iteration < iteration_count; iteration++) {
+            found += reader.contains(keys[(iteration * 7919 + thread_index * 104729) % keys.size()]) ? 1 : 0;
+        }
+        hud_bench::do_not_optimize(found);
+    });
+}
+
+HD_BENCHMARK(read_mostly_hashmap_find, sharded, HD_BENCH_THREAD_COUNTS)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(HD_BENCH_CONCURRENT_KEY_COUNT);
+    hud::concurrent_hashmap<u64, u64> map;
+    for (const u64 key : keys) {
+        map.add(key, key);
+    }
+    hud_bench::run_contended(state, [&](const usize thread_index, const usize iteration_count) {
+        usize found = 0;
+        for (usize iteration = 0; iteration < iteration_count; iteration++) {
+            found += map.contains(keys[(iteration * 7919 + thread_index * 104729) % keys.size()]) ? 1 : 0;
+        }
+        hud_bench::do_not_optimize(found);
+    });
+}
+
+HD_BENCHMARK(read_mostly_hashmap_find, std, HD_BENCH_THREAD_COUNTS)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(HD_BENCH_CONCURRENT_KEY_COUNT);
+    std::shared_mutex mutex;
+    std::unordered_map<u64, u64> map;
+    for (const u64 key : keys) {
+        map.emplace(key, key);
+    }
+    hud_bench::run_contended(state, [&](const usize thread_index, const usize iteration_count) {
+        usize found = 0;
+        for (usize iteration = 0; iteration < iteration_count; iteration++) {
+            const std::shared_lock<std::shared_mutex> guard(mutex);
+            found += map.contains(keys[(iteration * 7919 + thread_index * 104729) % keys.size()]) ? 1 : 0;
+        }
+        hud_bench::do_not_optimize(found);
+    });
+}
+
+// Each iteration copies a table of 1M keys then grows it, relocating the keys with `state.size()` threads
+#define HD_BENCH_PARALLEL_RESIZE_KEY_COUNT 1048576
+
+HD_BENCHMARK(hashset_reserve_parallel, hud, HD_BENCH_THREAD_COUNTS)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(HD_BENCH_PARALLEL_RESIZE_KEY_COUNT);
+    hud::hashset<u64> source;
+    for (const u64 key : keys) {
+        source.add(key);
+    }
+    const usize thread_count = state.size();
+    auto executor = [thread_count](const usize task_count, auto &&task) {
+        std::atomic<usize> next_task_index {0};
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+        for (usize index = 0; index < thread_count; index++) {
+            threads.emplace_back([&]() {
+                for (usize task_index = next_task_index.fetch_add(1); task_index < task_count; task_index = next_task_index.fetch_add(1)) {
+                    task(task_index);
+                }
+            });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+    };
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud::hashset<u64> set {source};
+        set.reserve_parallel(keys.size() * 4, executor);
+        hud_bench::do_not_optimize(set.max_count());
+    }
+    state.set_items_per_iteration(keys.size());
+}
+
+HD_BENCHMARK(hashset_reserve_parallel, serial, 1)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(HD_BENCH_PARALLEL_RESIZE_KEY_COUNT);
+    hud::hashset<u64> source;
+    for (const u64 key : keys) {
+        source.add(key);
+    }
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud::hashset<u64> set {source};
+        set.reserve(keys.size() * 4);
+        hud_bench::do_not_optimize(set.max_count());
+    }
+    state.set_items_per_iteration(keys.size());
+}
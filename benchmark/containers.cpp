@@ -0,0 +1,640 @@
+#include "benchmark.h"
+#include "random.h"
+#include <core/containers/vector.h>
+#include <core/containers/hashset.h>
+#include <core/containers/hashmap.h>
+#include <unordered_set>
+#include <unordered_map>
+#include <memory>
+
+#define HD_BENCH_CONTAINER_SIZES 16, 1024, 65536, 1048576
+
+// vector
+
+HD_BENCHMARK(vector_add, hud, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud::vector<u64> vector;
+        for (usize index = 0; index < state.size(); index++) {
+            vector.add(index);
+        }
+        hud_bench::do_not_optimize(vector.data());
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(vector_add, std, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        std::vector<u64> vector;
+        for (usize index = 0; index < state.size(); index++) {
+            vector.push_back(index);
+        }
+        hud_bench::do_not_optimize(vector.data());
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(vector_iterate, hud, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    hud::vector<u64> vector;
+    for (const u64 value : hud_bench::random_u64(state.size())) {
+        vector.add(value);
+    }
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        u64 sum = 0;
+        for (const u64 value : vector) {
+            sum += value;
+        }
+        hud_bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(state.size());
+    state.set_bytes_per_iteration(state.size() * sizeof(u64));
+}
+
+HD_BENCHMARK(vector_iterate, std, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> vector = hud_bench::random_u64(state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        u64 sum = 0;
+        for (const u64 value : vector) {
+            sum += value;
+        }
+        hud_bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(state.size());
+    state.set_bytes_per_iteration(state.size() * sizeof(u64));
+}
+
+HD_BENCHMARK(vector_remove_last, hud, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    hud::vector<u64> vector;
+    vector.reserve(state.size());
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        for (usize index = 0; index < state.size(); index++) {
+            vector.add(index);
+        }
+        while (vector.count() > 0) {
+            vector.remove_at(vector.count() - 1);
+        }
+        hud_bench::do_not_optimize(vector.data());
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(vector_remove_last, std, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    std::vector<u64> vector;
+    vector.reserve(state.size());
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        for (usize index = 0; index < state.size(); index++) {
+            vector.push_back(index);
+        }
+        while (!vector.empty()) {
+            vector.pop_back();
+        }
+        hud_bench::do_not_optimize(vector.data());
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+// hashset
+
+HD_BENCHMARK(hashset_add, hud, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud::hashset<u64> set;
+        for (const u64 key : keys) {
+            set.add(key);
+        }
+        hud_bench::do_not_optimize(set.count());
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_add, std, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        std::unordered_set<u64> set;
+        for (const u64 key : keys) {
+            set.insert(key);
+        }
+        hud_bench::do_not_optimize(set.size());
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_find_hit, hud, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    hud::hashset<u64> set;
+    for (const u64 key : keys) {
+        set.add(key);
+    }
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        usize found = 0;
+        for (const u64 key : keys) {
+            found += set.contains(key) ? 1 : 0;
+        }
+        hud_bench::do_not_optimize(found);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_find_hit, std, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    const std::unordered_set<u64> set(keys.begin(), keys.end());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        usize found = 0;
+        for (const u64 key : keys) {
+            found += set.contains(key) ? 1 : 0;
+        }
+        hud_bench::do_not_optimize(found);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_find_hit, batch, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    hud::hashset<u64> set;
+    for (const u64 key : keys) {
+        set.add(key);
+    }
+    const std::unique_ptr<bool[]> results(new bool[keys.size()]);
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        const usize found = set.contains_batch(hud::slice {keys.data(), keys.size()}, hud::slice {results.get(), keys.size()});
+        hud_bench::do_not_optimize(found);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_find_miss, hud, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    hud::hashset<u64> set;
+    for (const u64 key : hud_bench::random_u64(state.size())) {
+        set.add(key);
+    }
+    const std::vector<u64> misses = hud_bench::random_u64(state.size(), 0xDEADBEEFULL);
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        usize found = 0;
+        for (const u64 key : misses) {
+            found += set.contains(key) ? 1 : 0;
+        }
+        hud_bench::do_not_optimize(found);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_find_miss, std, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    const std::unordered_set<u64> set(keys.begin(), keys.end());
+    const std::vector<u64> misses = hud_bench::random_u64(state.size(), 0xDEADBEEFULL);
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        usize found = 0;
+        for (const u64 key : misses) {
+            found += set.contains(key) ? 1 : 0;
+        }
+        hud_bench::do_not_optimize(found);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_churn, hud, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    std::vector<u64> keys = hud_bench::random_u64(state.size());
+    hud::hashset<u64> set;
+    for (const u64 key : keys) {
+        set.add(key);
+    }
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        // Replace every key by another one, the count of elements never change
+        for (u64 &key : keys) {
+            set.remove(key);
+            key ^= 0x9E3779B97F4A7C15ULL;
+            set.add(key);
+        }
+        hud_bench::do_not_optimize(set.count());
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_churn, std, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    std::vector<u64> keys = hud_bench::random_u64(state.size());
+    std::unordered_set<u64> set(keys.begin(), keys.end());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        // Replace every key by another one, the count of elements never change
+        for (u64 &key : keys) {
+            set.erase(key);
+            key ^= 0x9E3779B97F4A7C15ULL;
+            set.insert(key);
+        }
+        hud_bench::do_not_optimize(set.size());
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+// Sizes at 7/8 of a power of two capacity, the load factor where probing visits the most groups
+#define HD_BENCH_HIGH_LOAD_SIZES 14, 896, 57344, 917504
+
+HD_BENCHMARK(hashset_find_hit_high_load, hud, HD_BENCH_HIGH_LOAD_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    hud::hashset<u64> set;
+    for (const u64 key : keys) {
+        set.add(key);
+    }
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        usize found = 0;
+        for (const u64 key : keys) {
+            found += set.contains(key) ? 1 : 0;
+        }
+        hud_bench::do_not_optimize(found);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_find_hit_high_load, std, HD_BENCH_HIGH_LOAD_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    const std::unordered_set<u64> set(keys.begin(), keys.end());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        usize found = 0;
+        for (const u64 key : keys) {
+            found += set.contains(key) ? 1 : 0;
+        }
+        hud_bench::do_not_optimize(found);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_find_miss_high_load, hud, HD_BENCH_HIGH_LOAD_SIZES)(hud_bench::state &state)
+{
+    hud::hashset<u64> set;
+    for (const u64 key : hud_bench::random_u64(state.size())) {
+        set.add(key);
+    }
+    const std::vector<u64> misses = hud_bench::random_u64(state.size(), 0xDEADBEEFULL);
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        usize found = 0;
+        for (const u64 key : misses) {
+            found += set.contains(key) ? 1 : 0;
+        }
+        hud_bench::do_not_optimize(found);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_find_miss_high_load, std, HD_BENCH_HIGH_LOAD_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    const std::unordered_set<u64> set(keys.begin(), keys.end());
+    const std::vector<u64> misses = hud_bench::random_u64(state.size(), 0xDEADBEEFULL);
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        usize found = 0;
+        for (const u64 key : misses) {
+            found += set.contains(key) ? 1 : 0;
+        }
+        hud_bench::do_not_optimize(found);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+// Misses probe until a group with an empty slot, the max load factor of the policy sets how many groups they scan
+
+template<typename policy_t>
+static void bench_hashset_find_miss_policy(hud_bench::state &state) noexcept
+{
+    hud::hashset<u64, hud::hash_64<u64>, hud::equal<u64>, hud::heap_allocator, policy_t> set;
+    for (const u64 key : hud_bench::random_u64(state.size())) {
+        set.add(key);
+    }
+    const std::vector<u64> misses = hud_bench::random_u64(state.size(), 0xDEADBEEFULL);
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        usize found = 0;
+        for (const u64 key : misses) {
+            found += set.contains(key) ? 1 : 0;
+        }
+        hud_bench::do_not_optimize(found);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_find_miss_policy, hud, HD_BENCH_HIGH_LOAD_SIZES)(hud_bench::state &state)
+{
+    bench_hashset_find_miss_policy<hud::default_hashset_policy>(state);
+}
+
+HD_BENCHMARK(hashset_find_miss_policy, dense, HD_BENCH_HIGH_LOAD_SIZES)(hud_bench::state &state)
+{
+    bench_hashset_find_miss_policy<hud::dense_hashset_policy>(state);
+}
+
+HD_BENCHMARK(hashset_find_miss_policy, sparse, HD_BENCH_HIGH_LOAD_SIZES)(hud_bench::state &state)
+{
+    bench_hashset_find_miss_policy<hud::sparse_hashset_policy>(state);
+}
+
+// Keys that only differ in their high bits, like aligned addresses, need a hasher that mixes them in the low bits
+
+template<typename hasher_t>
+static void bench_hashset_find_hit_strided(hud_bench::state &state) noexcept
+{
+    hud::hashset<u64, hasher_t> set;
+    std::vector<u64> keys;
+    for (u64 index = 0; index < state.size(); index++) {
+        keys.push_back(index * 4096);
+        set.add(keys.back());
+    }
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        usize found = 0;
+        for (const u64 key : keys) {
+            found += set.contains(key) ? 1 : 0;
+        }
+        hud_bench::do_not_optimize(found);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_find_hit_strided, hud, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    bench_hashset_find_hit_strided<hud::hash_64<u64>>(state);
+}
+
+HD_BENCHMARK(hashset_find_hit_strided, wyhash, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    bench_hashset_find_hit_strided<hud::wyhash_64<u64>>(state);
+}
+
+// Composite keys hash each element and combine them, `hud::hash_64` combines with CityHash and `hud::wyhash_64` with one multiplication
+
+template<typename hasher_t>
+static void bench_hashset_find_hit_pair(hud_bench::state &state) noexcept
+{
+    using key_type = hud::pair<u64, u64>;
+    const std::vector<u64> values = hud_bench::random_u64(state.size());
+    hud::hashset<key_type, hasher_t> set;
+    std::vector<key_type> keys;
+    for (u64 index = 0; index < state.size(); index++) {
+        keys.push_back(key_type {values[index], index});
+        set.add(keys.back());
+    }
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        usize found = 0;
+        for (const key_type &key : keys) {
+            found += set.contains(key) ? 1 : 0;
+        }
+        hud_bench::do_not_optimize(found);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_find_hit_pair, hud, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    bench_hashset_find_hit_pair<hud::hash_64<hud::pair<u64, u64>>>(state);
+}
+
+HD_BENCHMARK(hashset_find_hit_pair, wyhash, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    bench_hashset_find_hit_pair<hud::wyhash_64<hud::pair<u64, u64>>>(state);
+}
+
+HD_BENCHMARK(hashset_remove, hud, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    hud::hashset<u64> set;
+    set.reserve(state.size());
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        for (const u64 key : keys) {
+            set.add(key);
+        }
+        for (const u64 key : keys) {
+            set.remove(key);
+        }
+        hud_bench::do_not_optimize(set.count());
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_remove, std, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    std::unordered_set<u64> set;
+    set.reserve(state.size());
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        for (const u64 key : keys) {
+            set.insert(key);
+        }
+        for (const u64 key : keys) {
+            set.erase(key);
+        }
+        hud_bench::do_not_optimize(set.size());
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_iterate, hud, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    hud::hashset<u64> set;
+    for (const u64 key : hud_bench::random_u64(state.size())) {
+        set.add(key);
+    }
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        u64 sum = 0;
+        for (const auto &element : set) {
+            sum += element.key();
+        }
+        hud_bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashset_iterate, std, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    const std::unordered_set<u64> set(keys.begin(), keys.end());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        u64 sum = 0;
+        for (const u64 key : set) {
+            sum += key;
+        }
+        hud_bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+// hashmap
+
+HD_BENCHMARK(hashmap_add, hud, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud::hashmap<u64, u64> map;
+        for (const u64 key : keys) {
+            map.add(key, key);
+        }
+        hud_bench::do_not_optimize(map.count());
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashmap_add, std, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        std::unordered_map<u64, u64> map;
+        for (const u64 key : keys) {
+            map.emplace(key, key);
+        }
+        hud_bench::do_not_optimize(map.size());
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashmap_add, range, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    std::vector<hud::pair<u64, u64>> pairs;
+    for (const u64 key : hud_bench::random_u64(state.size())) {
+        pairs.emplace_back(key, key);
+    }
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud::hashmap<u64, u64> map;
+        map.add_range(hud::slice {pairs.data(), pairs.size()});
+        hud_bench::do_not_optimize(map.count());
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashmap_add, unique_range, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    // Random 64 bits keys are unique
+    std::vector<hud::pair<u64, u64>> pairs;
+    for (const u64 key : hud_bench::random_u64(state.size())) {
+        pairs.emplace_back(key, key);
+    }
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud::hashmap<u64, u64> map;
+        map.add_unique_range(hud::slice {pairs.data(), pairs.size()});
+        hud_bench::do_not_optimize(map.count());
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashmap_find_hit, hud, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    hud::hashmap<u64, u64> map;
+    for (const u64 key : keys) {
+        map.add(key, key);
+    }
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        u64 sum = 0;
+        for (const u64 key : keys) {
+            sum += map.find(key)->value();
+        }
+        hud_bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+// A random seed costs the mixing of the keys that hud::hash_64 uses as is
+
+HD_BENCHMARK(hashmap_find_hit, keyed, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    hud::hashmap<u64, u64, hud::keyed_hash_64<u64>> map;
+    for (const u64 key : keys) {
+        map.add(key, key);
+    }
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        u64 sum = 0;
+        for (const u64 key : keys) {
+            sum += map.find(key)->value();
+        }
+        hud_bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashmap_find_hit, std, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    std::unordered_map<u64, u64> map;
+    for (const u64 key : keys) {
+        map.emplace(key, key);
+    }
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        u64 sum = 0;
+        for (const u64 key : keys) {
+            sum += map.find(key)->second;
+        }
+        hud_bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashmap_remove, hud, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    hud::hashmap<u64, u64> map;
+    map.reserve(state.size());
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        for (const u64 key : keys) {
+            map.add(key, key);
+        }
+        for (const u64 key : keys) {
+            map.remove(key);
+        }
+        hud_bench::do_not_optimize(map.count());
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hashmap_remove, std, HD_BENCH_CONTAINER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    std::unordered_map<u64, u64> map;
+    map.reserve(state.size());
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        for (const u64 key : keys) {
+            map.emplace(key, key);
+        }
+        for (const u64 key : keys) {
+            map.erase(key);
+        }
+        hud_bench::do_not_optimize(map.size());
+    }
+    state.set_items_per_iteration(state.size());
+}
@@ -0,0 +1,38 @@
+#ifndef HD_INC_BENCHMARK_CONTENDED_H
+#define HD_INC_BENCHMARK_CONTENDED_H
+#include "benchmark.h"
+#include <atomic>
+#include <thread>
+
+#define HD_BENCH_THREAD_COUNTS 1, 2, 4, 8
+
+namespace hud_bench
+{
+    /**
+     * Run `function(thread_index, iteration_count)` on `state.size()` threads.
+     * Threads are started before the timer and released together to measure the contention only.
+     */
+    template<typename function_t>
+    void run_contended(hud_bench::state &state, function_t function) noexcept
+    {
+        std::atomic<bool> go {false};
+        std::vector<std::thread> threads;
+        threads.reserve(state.size());
+        for (usize index = 0; index < state.size(); index++) {
+            threads.emplace_back([&, index]() {
+                while (!go.load(std::memory_order_acquire)) {
+                }
+                function(index, state.iteration_count());
+            });
+        }
+        state.reset_timer();
+        go.store(true, std::memory_order_release);
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+        state.set_items_per_iteration(state.size());
+    }
+
+} // namespace hud_bench
+
+#endif // HD_INC_BENCHMARK_CONTENDED_H
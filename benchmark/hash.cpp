@@ -0,0 +1,265 @@
+#include "benchmark.h"
+#include "random.h"
+#include <core/hash.h>
+#include <core/hash/crc32.h>
+#include <atomic>
+#include <functional>
+#include <string_view>
+#include <thread>
+
+#define HD_BENCH_KEY_LENGTHS 4, 8, 16, 32, 64, 256, 1024, 65536
+
+HD_BENCHMARK(hash_bytes, city_hash_32, HD_BENCH_KEY_LENGTHS)(hud_bench::state &state)
+{
+    const std::vector<u8> bytes = hud_bench::random_bytes(state.size());
+    const char8 *key = reinterpret_cast<const char8 *>(bytes.data());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud_bench::do_not_optimize(hud::hash_algorithm::city_hash::hash_32(key, state.size()));
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hash_bytes, city_hash_64, HD_BENCH_KEY_LENGTHS)(hud_bench::state &state)
+{
+    const std::vector<u8> bytes = hud_bench::random_bytes(state.size());
+    const char8 *key = reinterpret_cast<const char8 *>(bytes.data());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud_bench::do_not_optimize(hud::hash_algorithm::city_hash::hash_64(key, state.size()));
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hash_bytes, wyhash, HD_BENCH_KEY_LENGTHS)(hud_bench::state &state)
+{
+    const std::vector<u8> bytes = hud_bench::random_bytes(state.size());
+    const char8 *key = reinterpret_cast<const char8 *>(bytes.data());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud_bench::do_not_optimize(hud::hash_algorithm::wyhash::hash_64(key, state.size()));
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+// Hash a key of `state.size()` bytes received in 4 fragments
+#define HD_BENCH_FRAGMENT_COUNT 4
+
+HD_BENCHMARK(hash_fragments, copy_then_city_hash_64, 256, 1024, 65536)(hud_bench::state &state)
+{
+    const std::vector<u8> bytes = hud_bench::random_bytes(state.size());
+    const usize fragment_length = state.size() / HD_BENCH_FRAGMENT_COUNT;
+    std::vector<std::vector<char8>> fragments;
+    for (usize index = 0; index < HD_BENCH_FRAGMENT_COUNT; index++) {
+        fragments.emplace_back(bytes.begin() + index * fragment_length, bytes.begin() + (index + 1) * fragment_length);
+    }
+    std::vector<char8> key;
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        key.clear();
+        for (const std::vector<char8> &fragment : fragments) {
+            key.insert(key.end(), fragment.begin(), fragment.end());
+        }
+        hud_bench::do_not_optimize(hud::hash_algorithm::city_hash::hash_64(key.data(), key.size()));
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hash_fragments, city_hash_64_stream, 256, 1024, 65536)(hud_bench::state &state)
+{
+    const std::vector<u8> bytes = hud_bench::random_bytes(state.size());
+    const usize fragment_length = state.size() / HD_BENCH_FRAGMENT_COUNT;
+    std::vector<std::vector<char8>> fragments;
+    for (usize index = 0; index < HD_BENCH_FRAGMENT_COUNT; index++) {
+        fragments.emplace_back(bytes.begin() + index * fragment_length, bytes.begin() + (index + 1) * fragment_length);
+    }
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud::hash_algorithm::city_hash_64_stream<HD_BENCH_FRAGMENT_COUNT> stream;
+        for (const std::vector<char8> &fragment : fragments) {
+            stream.update(fragment.data(), fragment.size());
+        }
+        hud_bench::do_not_optimize(stream.finalize());
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hash_bytes, crc32, HD_BENCH_KEY_LENGTHS)(hud_bench::state &state)
+{
+    const std::vector<u8> bytes = hud_bench::random_bytes(state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud_bench::do_not_optimize(hud::hash_algorithm::crc32::hash(bytes.data(), state.size()));
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hash_bytes, crc32_slice_by_8, HD_BENCH_KEY_LENGTHS)(hud_bench::state &state)
+{
+    const std::vector<u8> bytes = hud_bench::random_bytes(state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud_bench::do_not_optimize(hud::hash_algorithm::crc32::hash_slice_by_8(bytes.data(), state.size()));
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hash_bytes, crc32c, HD_BENCH_KEY_LENGTHS)(hud_bench::state &state)
+{
+    const std::vector<u8> bytes = hud_bench::random_bytes(state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud_bench::do_not_optimize(hud::hash_algorithm::crc32c::hash(bytes.data(), state.size()));
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+// Hash 64 MiB by chunks of 1 MiB on `state.size()` threads
+#define HD_BENCH_CRC32_PARALLEL_BYTE_COUNT (64 * 1024 * 1024)
+
+HD_BENCHMARK(crc32_hash_parallel, hud, 1, 2, 4, 8)(hud_bench::state &state)
+{
+    const std::vector<u8> bytes = hud_bench::random_bytes(HD_BENCH_CRC32_PARALLEL_BYTE_COUNT);
+    const usize thread_count = state.size();
+    auto executor = [thread_count](const usize task_count, auto &&task) {
+        std::atomic<usize> next_task_index {0};
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+        for (usize index = 0; index < thread_count; index++) {
+            threads.emplace_back([&]() {
+                for (usize task_index = next_task_index.fetch_add(1); task_index < task_count; task_index = next_task_index.fetch_add(1)) {
+                    task(task_index);
+                }
+            });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+    };
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud_bench::do_not_optimize(hud::hash_algorithm::crc32::hash_parallel(bytes.data(), bytes.size(), 1024 * 1024, executor));
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(bytes.size());
+}
+
+HD_BENCHMARK(hash_bytes, keyed, HD_BENCH_KEY_LENGTHS)(hud_bench::state &state)
+{
+    const std::vector<u8> bytes = hud_bench::random_bytes(state.size());
+    const char8 *key = reinterpret_cast<const char8 *>(bytes.data());
+    const hud::keyed_hash_64<const char8 *> hasher;
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud_bench::do_not_optimize(hasher(key, state.size()));
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hash_bytes, std, HD_BENCH_KEY_LENGTHS)(hud_bench::state &state)
+{
+    const std::vector<u8> bytes = hud_bench::random_bytes(state.size());
+    const std::string_view key(reinterpret_cast<const char *>(bytes.data()), state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud_bench::do_not_optimize(std::hash<std::string_view> {}(key));
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hash_integer, hud, 1024)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        u64 sum = 0;
+        for (const u64 key : keys) {
+            sum += hud::hash_64<u64> {}(key);
+        }
+        hud_bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hash_integer, wyhash, 1024)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        u64 sum = 0;
+        for (const u64 key : keys) {
+            sum += hud::wyhash_64<u64> {}(key);
+        }
+        hud_bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hash_integer, keyed, 1024)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    const hud::keyed_hash_64<u64> hasher;
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        u64 sum = 0;
+        for (const u64 key : keys) {
+            sum += hasher(key);
+        }
+        hud_bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hash_integer, std, 1024)(hud_bench::state &state)
+{
+    const std::vector<u64> keys = hud_bench::random_u64(state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        u64 sum = 0;
+        for (const u64 key : keys) {
+            sum += std::hash<u64> {}(key);
+        }
+        hud_bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+// Hash a record of 4 fields, each field is hashed then combined with the previous ones
+
+HD_BENCHMARK(hash_record, hasher_64, 1024)(hud_bench::state &state)
+{
+    const std::vector<u64> fields = hud_bench::random_u64(state.size() * 4);
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        u64 sum = 0;
+        for (usize index = 0; index < fields.size(); index += 4) {
+            sum += hud::hasher_64 {}(fields[index])(fields[index + 1])(fields[index + 2])(fields[index + 3]).result();
+        }
+        hud_bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(state.size());
+}
+
+HD_BENCHMARK(hash_record, wyhasher_64, 1024)(hud_bench::state &state)
+{
+    const std::vector<u64> fields = hud_bench::random_u64(state.size() * 4);
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        u64 sum = 0;
+        for (usize index = 0; index < fields.size(); index += 4) {
+            sum += hud::wyhasher_64 {}(fields[index])(fields[index + 1])(fields[index + 2])(fields[index + 3]).result();
+        }
+        hud_bench::do_not_optimize(sum);
+    }
+    state.set_items_per_iteration(state.size());
+}
@@ -0,0 +1,241 @@
+#include "benchmark.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace hud_bench
+{
+    std::vector<benchmark> &registry() noexcept
+    {
+        static std::vector<benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    /** Output format of the results. */
+    enum class format
+    {
+        console,
+        csv,
+        json
+    };
+
+    /** Command line options. */
+    struct options
+    {
+        /** Only benchmarks with a `group/name` containing this filter are run. */
+        const char *filter = nullptr;
+        /** Output format of the results. */
+        format output_format = format::console;
+        /** Minimum time in nanoseconds of one repetition. */
+        f64 min_time_ns = 20'000'000.0;
+        /** Count of repetitions, the median is reported. */
+        u32 repetition_count = 5;
+    };
+
+    /** Result of a benchmark run with a size. */
+    struct result
+    {
+        const char *group;
+        const char *name;
+        usize size;
+        usize iteration_count;
+        f64 ns_per_iteration;
+        f64 ns_per_item;
+        f64 bytes_per_second;
+    };
+
+    /** Run a benchmark once with `iteration_count` iterations and return the elapsed time in nanoseconds. */
+    [[nodiscard]] static f64 run_once(const benchmark &bench, const usize size, const usize iteration_count, usize &bytes_per_iteration, usize &items_per_iteration) noexcept
+    {
+        state s(iteration_count, size);
+        bench.function(s);
+        const f64 elapsed = s.elapsed_ns();
+        bytes_per_iteration = s.bytes_per_iteration();
+        items_per_iteration = s.items_per_iteration();
+        return elapsed;
+    }
+
+    /** Run a benchmark with a size, calibrating the iteration count to reach the minimum time. */
+    [[nodiscard]] static result run(const benchmark &bench, const usize size, const options &opts) noexcept
+    {
+        usize bytes_per_iteration = 0;
+        usize items_per_iteration = 1;
+
+        // Grow the iteration count until a run last at least a tenth of the minimum time, then extrapolate
+        usize iteration_count = 1;
+        f64 elapsed = run_once(bench, size, iteration_count, bytes_per_iteration, items_per_iteration);
+        while (elapsed < opts.min_time_ns / 10.0 && iteration_count < (usize(1) << 40)) {
+            iteration_count *= 10;
+            elapsed = run_once(bench, size, iteration_count, bytes_per_iteration, items_per_iteration);
+        }
+        if (elapsed < opts.min_time_ns) {
+            const f64 scale = opts.min_time_ns / (elapsed > 0.0 ? elapsed : 1.0);
+            iteration_count = static_cast<usize>(static_cast<f64>(iteration_count) * scale) + 1;
+        }
+
+        std::vector<f64> samples;
+        samples.reserve(opts.repetition_count);
+        for (u32 repetition = 0; repetition < opts.repetition_count; repetition++) {
+            samples.push_back(run_once(bench, size, iteration_count, bytes_per_iteration, items_per_iteration) / static_cast<f64>(iteration_count));
+        }
+        std::sort(samples.begin(), samples.end());
+        const f64 median = samples[samples.size() / 2];
+
+        result r;
+        r.group = bench.group;
+        r.name = bench.name;
+        r.size = size;
+        r.iteration_count = iteration_count;
+        r.ns_per_iteration = median;
+        r.ns_per_item = median / static_cast<f64>(items_per_iteration > 0 ? items_per_iteration : 1);
+        r.bytes_per_second = bytes_per_iteration > 0 ? static_cast<f64>(bytes_per_iteration) * 1e9 / median : 0.0;
+        return r;
+    }
+
+    /** Retrieves the median time per item of the `std` benchmark of the same group and size, 0 if none. */
+    [[nodiscard]] static f64 std_reference(const std::vector<result> &results, const result &r) noexcept
+    {
+        for (const result &other : results) {
+            if (std::strcmp(other.group, r.group) == 0 && other.size == r.size && std::strcmp(other.name, "std") == 0) {
+                return other.ns_per_item;
+            }
+        }
+        return 0.0;
+    }
+
+    static void print_console(const std::vector<result> &results) noexcept
+    {
+        std::printf("%-28s %-10s %10s %14s %14s %12s %10s\n", "group", "name", "size", "ns/iter", "ns/item", "MB/s", "vs std");
+        for (const result &r : results) {
+            const f64 reference = std_reference(results, r);
+            std::printf("%-28s %-10s %10zu %14.2f %14.3f ", r.group, r.name, static_cast<size_t>(r.size), r.ns_per_iteration, r.ns_per_item);
+            if (r.bytes_per_second > 0.0) {
+                std::printf("%12.1f ", r.bytes_per_second / 1e6);
+            }
+            else {
+                std::printf("%12s ", "-");
+            }
+            if (reference > 0.0) {
+                std::printf("%9.2fx\n", reference / r.ns_per_item);
+            }
+            else {
+                std::printf("%10s\n", "-");
+            }
+        }
+    }
+
+    static void print_csv(const std::vector<result> &results) noexcept
+    {
+        std::printf("group,name,size,iterations,ns_per_iteration,ns_per_item,bytes_per_second,speedup_vs_std\n");
+        for (const result &r : results) {
+            const f64 reference = std_reference(results, r);
+            std::printf("%s,%s,%zu,%zu,%.4f,%.4f,%.1f,", r.group, r.name, static_cast<size_t>(r.size), static_cast<size_t>(r.iteration_count), r.ns_per_iteration, r.ns_per_item, r.bytes_per_second);
+            // Leave the speedup empty when the group has no std reference
+            if (reference > 0.0) {
+                std::printf("%.4f", reference / r.ns_per_item);
+            }
+            std::printf("\n");
+        }
+    }
+
+    static void print_json(const std::vector<result> &results) noexcept
+    {
+        std::printf("{\n  \"benchmarks\": [\n");
+        for (usize index = 0; index < results.size(); index++) {
+            const result &r = results[index];
+            const f64 reference = std_reference(results, r);
+            std::printf("    {\"group\": \"%s\", \"name\": \"%s\", \"size\": %zu, \"iterations\": %zu, \"ns_per_iteration\": %.4f, \"ns_per_item\": %.4f, \"bytes_per_second\": %.1f, \"speedup_vs_std\": ",
+                        r.group, r.name, static_cast<size_t>(r.size), static_cast<size_t>(r.iteration_count), r.ns_per_iteration, r.ns_per_item, r.bytes_per_second);
+            // null when the group has no std reference
+            if (reference > 0.0) {
+                std::printf("%.4f}", reference / r.ns_per_item);
+            }
+            else {
+                std::printf("null}");
+            }
+            std::printf("%s\n", index + 1 < results.size() ? "," : "");
+        }
+        std::printf("  ]\n}\n");
+    }
+
+    static void print_usage(const char *program) noexcept
+    {
+        std::printf("Usage: %s [--filter=<substring>] [--format=console|csv|json] [--min-time-ms=<ms>] [--repetitions=<count>] [--list]\n", program);
+    }
+
+} // namespace hud_bench
+
+int main(int argc, char **argv)
+{
+    hud_bench::options opts;
+    bool list_only = false;
+    for (int index = 1; index < argc; index++) {
+        const char *arg = argv[index];
+        if (std::strncmp(arg, "--filter=", 9) == 0) {
+            opts.filter = arg + 9;
+        }
+        else if (std::strcmp(arg, "--format=csv") == 0) {
+            opts.output_format = hud_bench::format::csv;
+        }
+        else if (std::strcmp(arg, "--format=json") == 0) {
+            opts.output_format = hud_bench::format::json;
+        }
+        else if (std::strcmp(arg, "--format=console") == 0) {
+            opts.output_format = hud_bench::format::console;
+        }
+        else if (std::strncmp(arg, "--min-time-ms=", 14) == 0) {
+            opts.min_time_ns = std::atof(arg + 14) * 1e6;
+        }
+        else if (std::strncmp(arg, "--repetitions=", 14) == 0) {
+            const int count = std::atoi(arg + 14);
+            opts.repetition_count = count > 0 ? static_cast<u32>(count) : 1u;
+        }
+        else if (std::strcmp(arg, "--list") == 0) {
+            list_only = true;
+        }
+        else {
+            hud_bench::print_usage(argv[0]);
+            return std::strcmp(arg, "--help") == 0 ? 0 : 1;
+        }
+    }
+
+#if defined(HD_DEBUG)
+    // Timings of a debug build are dominated by checks and missing inlining
+    std::fprintf(stderr, "Warning: bench_core is built in Debug, results are not representative\n");
+#endif
+
+    std::vector<hud_bench::result> results;
+    for (const hud_bench::benchmark &bench : hud_bench::registry()) {
+        const std::string full_name = std::string(bench.group) + "/" + bench.name;
+        if (opts.filter != nullptr && full_name.find(opts.filter) == std::string::npos) {
+            continue;
+        }
+        if (list_only) {
+            std::printf("%s\n", full_name.c_str());
+            continue;
+        }
+        for (const usize size : bench.sizes) {
+            results.push_back(hud_bench::run(bench, size, opts));
+            if (opts.output_format == hud_bench::format::console) {
+                std::fprintf(stderr, "%s/%zu done\n", full_name.c_str(), static_cast<size_t>(size));
+            }
+        }
+    }
+
+    if (list_only) {
+        return 0;
+    }
+    switch (opts.output_format) {
+        case hud_bench::format::console:
+            hud_bench::print_console(results);
+            break;
+        case hud_bench::format::csv:
+            hud_bench::print_csv(results);
+            break;
+        case hud_bench::format::json:
+            hud_bench::print_json(results);
+            break;
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include "benchmark.h"
+#include "random.h"
+#include <core/memory.h>
+#include <cstring>
+
+#define HD_BENCH_BUFFER_SIZES 8, 64, 256, 4096, 65536, 1048576
+
+HD_BENCHMARK(memory_copy, hud, HD_BENCH_BUFFER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u8> source = hud_bench::random_bytes(state.size());
+    std::vector<u8> destination(state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud::memory::copy_memory(destination.data(), source.data(), state.size());
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+HD_BENCHMARK(memory_copy, std, HD_BENCH_BUFFER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u8> source = hud_bench::random_bytes(state.size());
+    std::vector<u8> destination(state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        std::memcpy(destination.data(), source.data(), state.size());
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+HD_BENCHMARK(memory_move, hud, HD_BENCH_BUFFER_SIZES)(hud_bench::state &state)
+{
+    std::vector<u8> buffer = hud_bench::random_bytes(state.size() + 1);
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud::memory::move_memory(buffer.data() + 1, buffer.data(), state.size());
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+HD_BENCHMARK(memory_move, std, HD_BENCH_BUFFER_SIZES)(hud_bench::state &state)
+{
+    std::vector<u8> buffer = hud_bench::random_bytes(state.size() + 1);
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        std::memmove(buffer.data() + 1, buffer.data(), state.size());
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+HD_BENCHMARK(memory_compare, hud, HD_BENCH_BUFFER_SIZES)(hud_bench::state &state)
+{
+    // Equal buffers, the whole buffer is compared
+    const std::vector<u8> buffer1 = hud_bench::random_bytes(state.size());
+    const std::vector<u8> buffer2 = buffer1;
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud_bench::do_not_optimize(hud::memory::compare_memory(buffer1.data(), buffer2.data(), state.size()));
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+HD_BENCHMARK(memory_compare, std, HD_BENCH_BUFFER_SIZES)(hud_bench::state &state)
+{
+    const std::vector<u8> buffer1 = hud_bench::random_bytes(state.size());
+    const std::vector<u8> buffer2 = buffer1;
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud_bench::do_not_optimize(std::memcmp(buffer1.data(), buffer2.data(), state.size()));
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+HD_BENCHMARK(memory_set, hud, HD_BENCH_BUFFER_SIZES)(hud_bench::state &state)
+{
+    std::vector<u8> buffer(state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        hud::memory::set_memory(buffer.data(), state.size(), static_cast<u8>(iteration));
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
+
+HD_BENCHMARK(memory_set, std, HD_BENCH_BUFFER_SIZES)(hud_bench::state &state)
+{
+    std::vector<u8> buffer(state.size());
+    state.reset_timer();
+    for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+        std::memset(buffer.data(), static_cast<u8>(iteration), state.size());
+        hud_bench::clobber_memory();
+    }
+    state.set_bytes_per_iteration(state.size());
+}
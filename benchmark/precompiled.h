@@ -0,0 +1,8 @@
+#ifndef HD_PRECOMPILED
+#define HD_PRECOMPILED
+#include <core/minimal.h>
+#include <core/traits/is_pointer.h>
+#include <core/memory.h>
+#include <core/hash.h>
+
+#endif // HD_PRECOMPILED
@@ -0,0 +1,34 @@
+#ifndef HD_INC_BENCHMARK_RANDOM_H
+#define HD_INC_BENCHMARK_RANDOM_H
+#include <core/minimal.h>
+#include <vector>
+
+namespace hud_bench
+{
+    /** Fill a vector with `count` deterministic pseudo random values (xorshift64*). */
+    [[nodiscard]] inline std::vector<u64> random_u64(const usize count, u64 seed = 0x9E3779B97F4A7C15ULL) noexcept
+    {
+        std::vector<u64> values(count);
+        for (u64 &value : values) {
+            seed ^= seed >> 12;
+            seed ^= seed << 25;
+            seed ^= seed >> 27;
+            value = seed * 0x2545F4914F6CDD1DULL;
+        }
+        return values;
+    }
+
+    /** Fill a vector with `count` deterministic pseudo random bytes. */
+    [[nodiscard]] inline std::vector<u8> random_bytes(const usize count, const u64 seed = 0x9E3779B97F4A7C15ULL) noexcept
+    {
+        const std::vector<u64> values = random_u64((count + 7) / 8, seed);
+        std::vector<u8> bytes(count);
+        for (usize index = 0; index < count; index++) {
+            bytes[index] = static_cast<u8>(values[index / 8] >> ((index % 8) * 8));
+        }
+        return bytes;
+    }
+
+} // namespace hud_bench
+
+#endif // HD_INC_BENCHMARK_RANDOM_H
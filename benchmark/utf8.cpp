@@ -0,0 +1,63 @@
+#include "benchmark.h"
+#include "random.h"
+#include <core/string/encoding/utf8.h>
+#include <cstring>
+
+#define HD_BENCH_TEXT_SIZES 16, 256, 4096, 65536, 1048576
+
+namespace
+{
+    /** Build a valid UTF-8 text of `size` bytes, `ascii_only` produces only ASCII characters. */
+    [[nodiscard]] std::vector<char8> make_utf8_text(const usize size, const bool ascii_only) noexcept
+    {
+        // 1, 2, 3 and 4 bytes sequences
+        static constexpr const char8 *sequences[] = {"a", "Z", " ", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80"};
+        const usize sequence_count = ascii_only ? 3 : 6;
+        const std::vector<u64> random = hud_bench::random_u64(size);
+        std::vector<char8> text;
+        text.reserve(size);
+        for (usize index = 0; text.size() < size; index++) {
+            const char8 *sequence = sequences[random[index] % sequence_count];
+            const usize length = std::strlen(sequence);
+            if (text.size() + length > size) {
+                sequence = sequences[0];
+            }
+            for (const char8 *c = sequence; *c != '\0'; c++) {
+                text.push_back(*c);
+            }
+        }
+        return text;
+    }
+
+    void bench_is_valid_utf8(hud_bench::state &state, const bool ascii_only, bool (*function)(const hud::slice<const char8>)) noexcept
+    {
+        const std::vector<char8> text = make_utf8_text(state.size(), ascii_only);
+        const hud::slice<const char8> slice(text.data(), text.size());
+        state.reset_timer();
+        for (usize iteration = 0; iteration < state.iteration_count(); iteration++) {
+            hud_bench::do_not_optimize(function(slice));
+            hud_bench::clobber_memory();
+        }
+        state.set_bytes_per_iteration(state.size());
+    }
+} // namespace
+
+HD_BENCHMARK(utf8_validate_ascii, hud, HD_BENCH_TEXT_SIZES)(hud_bench::state &state)
+{
+    bench_is_valid_utf8(state, true, [](const hud::slice<const char8> text) { return hud::encoding::is_valid_utf8(text); });
+}
+
+HD_BENCHMARK(utf8_validate_ascii, portable, HD_BENCH_TEXT_SIZES)(hud_bench::state &state)
+{
+    bench_is_valid_utf8(state, true, [](const hud::slice<const char8> text) { return hud::encoding::is_valid_utf8_portable(text); });
+}
+
+HD_BENCHMARK(utf8_validate_mixed, hud, HD_BENCH_TEXT_SIZES)(hud_bench::state &state)
+{
+    bench_is_valid_utf8(state, false, [](const hud::slice<const char8> text) { return hud::encoding::is_valid_utf8(text); });
+}
+
+HD_BENCHMARK(utf8_validate_mixed, portable, HD_BENCH_TEXT_SIZES)(hud_bench::state &state)
+{
+    bench_is_valid_utf8(state, false, [](const hud::slice<const char8> text) { return hud::encoding::is_valid_utf8_portable(text); });
+}
@@ -1,8 +1,496 @@
 #ifndef HD_INC_CORE_ALGORITHMS_SORT_H
 #define HD_INC_CORE_ALGORITHMS_SORT_H
+#include "../memory.h"
+#include "../slice.h"
+#include "../templates/less.h"
+#include "../templates/move.h"
+#include "../templates/swap.h"
+#include "../traits/is_integral.h"
+#include "../traits/is_bool.h"
+#include "../traits/is_signed.h"
+#include "../traits/make_unsigned.h"
+#include "../traits/is_bitwise_move_constructible.h"
 
 namespace hud
 {
-}
+    namespace details::sort
+    {
+        /** Under this count of elements, ranges are sorted with an insertion sort. */
+        static constexpr usize INSERTION_SORT_THRESHOLD = 16u;
 
-#endif // HD_INC_CORE_ALGORITHMS_SORT_H
\ No newline at end of file
+        /**
+         * Sort a range with an insertion sort. The sort is stable.
+         * Bitwise move constructible elements are relocated with a single memory move instead of being moved one by one.
+         * @param begin Pointer to the first element
+         * @param end Pointer after the last element
+         * @param less The comparison function object
+         */
+        template<typename type_t, typename less_t>
+        static constexpr void insertion_sort(type_t *begin, type_t *end, less_t &less) noexcept
+        {
+            if (begin == end) {
+                return;
+            }
+            for (type_t *current = begin + 1; current < end; ++current) {
+                if (!hud::is_constant_evaluated() && hud::is_bitwise_move_constructible_v<type_t>) {
+                    type_t *position = current;
+                    while (position > begin && less(*current, *(position - 1))) {
+                        --position;
+                    }
+                    if (position != current) {
+                        alignas(type_t) u8 element[sizeof(type_t)];
+                        hud::memory::copy_memory(static_cast<void *>(element), static_cast<const void *>(current), sizeof(type_t));
+                        hud::memory::move_memory(static_cast<void *>(position + 1), static_cast<const void *>(position), static_cast<usize>(current - position) * sizeof(type_t));
+                        hud::memory::copy_memory(static_cast<void *>(position), static_cast<const void *>(element), sizeof(type_t));
+                    }
+                }
+                else {
+                    type_t element = hud::move(*current);
+                    type_t *position = current;
+                    while (position > begin && less(element, *(position - 1))) {
+                        *position = hud::move(*(position - 1));
+                        --position;
+                    }
+                    *position = hud::move(element);
+                }
+            }
+        }
+
+        /** Sift down the element at `index` in the max heap [begin, begin + count). */
+        template<typename type_t, typename less_t>
+        static constexpr void sift_down(type_t *begin, usize index, const usize count, less_t &less) noexcept
+        {
+            while (true) {
+                usize child = 2u * index + 1u;
+                if (child >= count) {
+                    return;
+                }
+                if (child + 1u < count && less(begin[child], begin[child + 1u])) {
+                    ++child;
+                }
+                if (!less(begin[index], begin[child])) {
+                    return;
+                }
+                hud::swap(begin[index], begin[child]);
+                index = child;
+            }
+        }
+
+        /** Rearrange the range [begin, end) into a max heap. */
+        template<typename type_t, typename less_t>
+        static constexpr void make_heap(type_t *begin, type_t *end, less_t &less) noexcept
+        {
+            const usize count = static_cast<usize>(end - begin);
+            for (usize index = count / 2u; index > 0u; --index) {
+                sift_down(begin, index - 1u, count, less);
+            }
+        }
+
+        /** Sort the max heap [begin, end) in ascending order. */
+        template<typename type_t, typename less_t>
+        static constexpr void sort_heap(type_t *begin, type_t *end, less_t &less) noexcept
+        {
+            for (usize count = static_cast<usize>(end - begin); count > 1u; --count) {
+                hud::swap(begin[0], begin[count - 1u]);
+                sift_down(begin, 0u, count - 1u, less);
+            }
+        }
+
+        /** Rearrange [begin, end) so that [begin, middle) is a max heap of the `middle - begin` smallest elements. */
+        template<typename type_t, typename less_t>
+        static constexpr void heap_select(type_t *begin, type_t *middle, type_t *end, less_t &less) noexcept
+        {
+            make_heap(begin, middle, less);
+            const usize heap_count = static_cast<usize>(middle - begin);
+            for (type_t *current = middle; current < end; ++current) {
+                if (less(*current, *begin)) {
+                    hud::swap(*current, *begin);
+                    sift_down(begin, 0u, heap_count, less);
+                }
+            }
+        }
+
+        /** Move the median of `a`, `b` and `c` to `result`. */
+        template<typename type_t, typename less_t>
+        static constexpr void move_median_to(type_t *result, type_t *a, type_t *b, type_t *c, less_t &less) noexcept
+        {
+            if (less(*a, *b)) {
+                if (less(*b, *c)) {
+                    hud::swap(*result, *b);
+                }
+                else if (less(*a, *c)) {
+                    hud::swap(*result, *c);
+                }
+                else {
+                    hud::swap(*result, *a);
+                }
+            }
+            else if (less(*a, *c)) {
+                hud::swap(*result, *a);
+            }
+            else if (less(*b, *c)) {
+                hud::swap(*result, *c);
+            }
+            else {
+                hud::swap(*result, *b);
+            }
+        }
+
+        /**
+         * Partition [begin, end) around a median of three pivot moved to `begin`.
+         * The range must contains at least 3 elements.
+         * @return Pointer to the first element of the right partition. All elements before are not greater than the pivot, all elements after are not less than the pivot
+         */
+        template<typename type_t, typename less_t>
+        static constexpr type_t *partition(type_t *begin, type_t *end, less_t &less) noexcept
+        {
+            type_t *middle = begin + (end - begin) / 2;
+            move_median_to(begin, begin + 1, middle, end - 1, less);
+            // The median of three guarantee an element not less and an element not greater than the pivot stop both loops
+            type_t *left = begin + 1;
+            type_t *right = end;
+            while (true) {
+                while (less(*left, *begin)) {
+                    ++left;
+                }
+                --right;
+                while (less(*begin, *right)) {
+                    --right;
+                }
+                if (!(left < right)) {
+                    return left;
+                }
+                hud::swap(*left, *right);
+                ++left;
+            }
+        }
+
+        /** Retrieves the recursion depth after which introsort fallback to heap sort, 2 * log2(count). */
+        [[nodiscard]] static constexpr usize depth_limit(usize count) noexcept
+        {
+            usize depth = 0u;
+            for (; count > 1u; count >>= 1u) {
+                depth += 2u;
+            }
+            return depth;
+        }
+
+        /** Introsort loop, leave ranges smaller than `INSERTION_SORT_THRESHOLD` unsorted. */
+        template<typename type_t, typename less_t>
+        static constexpr void introsort_loop(type_t *begin, type_t *end, usize depth, less_t &less) noexcept
+        {
+            while (static_cast<usize>(end - begin) > INSERTION_SORT_THRESHOLD) {
+                if (depth == 0u) {
+                    heap_select(begin, end, end, less);
+                    sort_heap(begin, end, less);
+                    return;
+                }
+                --depth;
+                type_t *cut = partition(begin, end, less);
+                // Recurse in the smallest partition to bound the stack
+                if (cut - begin < end - cut) {
+                    introsort_loop(begin, cut, depth, less);
+                    begin = cut;
+                }
+                else {
+                    introsort_loop(cut, end, depth, less);
+                    end = cut;
+                }
+            }
+        }
+
+        /**
+         * Merge the sorted ranges [begin, middle) and [middle, end).
+         * The left range is moved in `buffer` that must be able to contains `middle - begin` elements.
+         */
+        template<typename type_t, typename less_t>
+        static constexpr void merge(type_t *begin, type_t *middle, type_t *end, type_t *buffer, less_t &less) noexcept
+        {
+            const usize left_count = static_cast<usize>(middle - begin);
+            hud::memory::move_or_copy_construct_array(buffer, begin, left_count);
+            type_t *left = buffer;
+            type_t *left_end = buffer + left_count;
+            type_t *right = middle;
+            type_t *destination = begin;
+            while (left < left_end && right < end) {
+                // Take the left element when equal to keep the sort stable
+                if (less(*right, *left)) {
+                    *destination = hud::move(*right);
+                    ++right;
+                }
+                else {
+                    *destination = hud::move(*left);
+                    ++left;
+                }
+                ++destination;
+            }
+            while (left < left_end) {
+                *destination = hud::move(*left);
+                ++left;
+                ++destination;
+            }
+            hud::memory::destroy_object_array(buffer, left_count);
+        }
+
+        /** Stable merge sort of [begin, end) using `buffer` to merge. */
+        template<typename type_t, typename less_t>
+        static constexpr void merge_sort(type_t *begin, type_t *end, type_t *buffer, less_t &less) noexcept
+        {
+            const usize count = static_cast<usize>(end - begin);
+            if (count <= INSERTION_SORT_THRESHOLD) {
+                insertion_sort(begin, end, less);
+                return;
+            }
+            type_t *middle = begin + count / 2u;
+            merge_sort(begin, middle, buffer, less);
+            merge_sort(middle, end, buffer, less);
+            // Already ordered, nothing to merge
+            if (!less(*middle, *(middle - 1))) {
+                return;
+            }
+            merge(begin, middle, end, buffer, less);
+        }
+
+    } // namespace details::sort
+
+    /**
+     * Sort the elements in the range [begin, end) in ascending order.
+     * The sort is not stable, the order of equal elements is not guaranteed to be preserved.
+     * Use an introsort: quicksort with median of three pivot that fallback to heap sort when the recursion is too deep,
+     * small partitions are sorted with an insertion sort. The complexity is O(n log n) in the worst case.
+     * @tparam type_t The type of element
+     * @tparam less_t The comparison function object type
+     * @param begin Pointer to the first element
+     * @param end Pointer after the last element
+     * @param less The comparison function object returning true if the first argument is less than the second
+     */
+    template<typename type_t, typename less_t = hud::less<type_t>>
+    static constexpr void sort(type_t *begin, type_t *end, less_t less = less_t {}) noexcept
+    {
+        if (end - begin < 2) {
+            return;
+        }
+        details::sort::introsort_loop(begin, end, details::sort::depth_limit(static_cast<usize>(end - begin)), less);
+        // Partitions are all smaller than the threshold and ordered relative to each others
+        details::sort::insertion_sort(begin, end, less);
+    }
+
+    /**
+     * Sort the elements of a slice in ascending order.
+     * The sort is not stable, the order of equal elements is not guaranteed to be preserved.
+     * @tparam type_t The type of element
+     * @tparam less_t The comparison function object type
+     * @param slice The slice of elements to sort
+     * @param less The comparison function object returning true if the first argument is less than the second
+     */
+    template<typename type_t, typename less_t = hud::less<type_t>>
+    static constexpr void sort(hud::slice<type_t> slice, less_t less = less_t {}) noexcept
+    {
+        hud::sort(slice.data(), slice.data() + slice.count(), hud::move(less));
+    }
+
+    /**
+     * Sort the elements in the range [begin, end) in ascending order, the order of equal elements is preserved.
+     * Use a merge sort with a temporary buffer of half the range allocated on the heap, small ranges are sorted with an insertion sort.
+     * If the buffer allocation failed, fallback to an insertion sort.
+     * @tparam type_t The type of element
+     * @tparam less_t The comparison function object type
+     * @param begin Pointer to the first element
+     * @param end Pointer after the last element
+     * @param less The comparison function object returning true if the first argument is less than the second
+     */
+    template<typename type_t, typename less_t = hud::less<type_t>>
+    static constexpr void stable_sort(type_t *begin, type_t *end, less_t less = less_t {}) noexcept
+    {
+        const usize count = static_cast<usize>(end - begin);
+        if (count <= details::sort::INSERTION_SORT_THRESHOLD) {
+            details::sort::insertion_sort(begin, end, less);
+            return;
+        }
+        const usize buffer_count = (count + 1u) / 2u;
+        type_t *buffer = hud::memory::allocate_array<type_t>(buffer_count);
+        if (buffer == nullptr) [[unlikely]] {
+            details::sort::insertion_sort(begin, end, less);
+            return;
+        }
+        details::sort::merge_sort(begin, end, buffer, less);
+        hud::memory::free_array(buffer, buffer_count);
+    }
+
+    /**
+     * Sort the elements of a slice in ascending order, the order of equal elements is preserved.
+     * @tparam type_t The type of element
+     * @tparam less_t The comparison function object type
+     * @param slice The slice of elements to sort
+     * @param less The comparison function object returning true if the first argument is less than the second
+     */
+    template<typename type_t, typename less_t = hud::less<type_t>>
+    static constexpr void stable_sort(hud::slice<type_t> slice, less_t less = less_t {}) noexcept
+    {
+        hud::stable_sort(slice.data(), slice.data() + slice.count(), hud::move(less));
+    }
+
+    /**
+     * Rearrange the elements in the range [begin, end) such that [begin, middle) contains the `middle - begin` smallest elements sorted in ascending order.
+     * The order of the remaining elements in [middle, end) is unspecified.
+     * Use a heap select followed by a heap sort, the complexity is O(n log m) where m is `middle - begin`.
+     * @tparam type_t The type of element
+     * @tparam less_t The comparison function object type
+     * @param begin Pointer to the first element
+     * @param middle Pointer after the last element to sort
+     * @param end Pointer after the last element
+     * @param less The comparison function object returning true if the first argument is less than the second
+     */
+    template<typename type_t, typename less_t = hud::less<type_t>>
+    static constexpr void partial_sort(type_t *begin, type_t *middle, type_t *end, less_t less = less_t {}) noexcept
+    {
+        if (begin == middle) {
+            return;
+        }
+        details::sort::heap_select(begin, middle, end, less);
+        details::sort::sort_heap(begin, middle, less);
+    }
+
+    /**
+     * Rearrange the elements of a slice such that the first `count` elements are the smallest elements sorted in ascending order.
+     * @tparam type_t The type of element
+     * @tparam less_t The comparison function object type
+     * @param slice The slice of elements
+     * @param count The number of elements to sort. Must be lower or equal to the count of element in the slice
+     * @param less The comparison function object returning true if the first argument is less than the second
+     */
+    template<typename type_t, typename less_t = hud::less<type_t>>
+    static constexpr void partial_sort(hud::slice<type_t> slice, const usize count, less_t less = less_t {}) noexcept
+    {
+        check(count <= slice.count());
+        hud::partial_sort(slice.data(), slice.data() + count, slice.data() + slice.count(), hud::move(less));
+    }
+
+    /**
+     * Rearrange the elements in the range [begin, end) such that the element at `nth` is the element that would be there if the range was sorted.
+     * All elements before `nth` are not greater than it, all elements after are not less than it.
+     * Use an introselect: quickselect with median of three pivot that fallback to heap select when the recursion is too deep.
+     * The complexity is O(n) on average.
+     * @tparam type_t The type of element
+     * @tparam less_t The comparison function object type
+     * @param begin Pointer to the first element
+     * @param nth Pointer to the partition element
+     * @param end Pointer after the last element
+     * @param less The comparison function object returning true if the first argument is less than the second
+     */
+    template<typename type_t, typename less_t = hud::less<type_t>>
+    static constexpr void nth_element(type_t *begin, type_t *nth, type_t *end, less_t less = less_t {}) noexcept
+    {
+        if (begin == end || nth == end) {
+            return;
+        }
+        usize depth = details::sort::depth_limit(static_cast<usize>(end - begin));
+        while (end - begin > 3) {
+            if (depth == 0u) {
+                details::sort::heap_select(begin, nth + 1, end, less);
+                // The biggest element of the heap is the nth
+                hud::swap(*nth, *begin);
+                return;
+            }
+            --depth;
+            type_t *cut = details::sort::partition(begin, end, less);
+            if (cut <= nth) {
+                begin = cut;
+            }
+            else {
+                end = cut;
+            }
+        }
+        details::sort::insertion_sort(begin, end, less);
+    }
+
+    /**
+     * Rearrange the elements of a slice such that the element at `index` is the element that would be there if the slice was sorted.
+     * @tparam type_t The type of element
+     * @tparam less_t The comparison function object type
+     * @param slice The slice of elements
+     * @param index The index of the partition element. Must be lower than the count of element in the slice
+     * @param less The comparison function object returning true if the first argument is less than the second
+     */
+    template<typename type_t, typename less_t = hud::less<type_t>>
+    static constexpr void nth_element(hud::slice<type_t> slice, const usize index, less_t less = less_t {}) noexcept
+    {
+        check(index < slice.count());
+        hud::nth_element(slice.data(), slice.data() + index, slice.data() + slice.count(), hud::move(less));
+    }
+
+    /**
+     * Sort the integral elements in the range [begin, end) in ascending order with a least significant digit radix sort.
+     * Elements are distributed one byte at a time in a temporary buffer allocated on the heap, bytes where all elements are equal are skipped.
+     * The sort is stable and the complexity is O(n * sizeof(type_t)).
+     * If the buffer allocation failed, fallback to `hud::sort`.
+     * @tparam type_t The integral type of element
+     * @param begin Pointer to the first element
+     * @param end Pointer after the last element
+     */
+    template<typename type_t>
+    requires(hud::is_integral_v<type_t> && !hud::is_bool_v<type_t>)
+    static constexpr void radix_sort(type_t *begin, type_t *end) noexcept
+    {
+        using key_type = hud::make_unsigned_t<type_t>;
+        // Flip the sign bit of signed integral so negative values are ordered before positive values
+        constexpr key_type sign_flip = hud::is_signed_v<type_t> ? static_cast<key_type>(key_type {1} << (sizeof(type_t) * 8u - 1u)) : key_type {0};
+
+        const usize count = static_cast<usize>(end - begin);
+        if (count <= details::sort::INSERTION_SORT_THRESHOLD) {
+            hud::sort(begin, end);
+            return;
+        }
+        type_t *buffer = hud::memory::allocate_array<type_t>(count);
+        if (buffer == nullptr) [[unlikely]] {
+            hud::sort(begin, end);
+            return;
+        }
+
+        type_t *source = begin;
+        type_t *destination = buffer;
+        for (usize byte_index = 0u; byte_index < sizeof(type_t); byte_index++) {
+            const u32 shift = static_cast<u32>(byte_index * 8u);
+            usize offsets[256] = {};
+            for (usize index = 0u; index < count; index++) {
+                const key_type key = static_cast<key_type>(static_cast<key_type>(source[index]) ^ sign_flip);
+                offsets[(key >> shift) & 0xFFu]++;
+            }
+            // All elements have the same byte, they are already ordered by this byte
+            const key_type first_key = static_cast<key_type>(static_cast<key_type>(source[0]) ^ sign_flip);
+            if (offsets[(first_key >> shift) & 0xFFu] == count) {
+                continue;
+            }
+            usize offset = 0u;
+            for (usize &bucket : offsets) {
+                const usize bucket_count = bucket;
+                bucket = offset;
+                offset += bucket_count;
+            }
+            for (usize index = 0u; index < count; index++) {
+                const key_type key = static_cast<key_type>(static_cast<key_type>(source[index]) ^ sign_flip);
+                destination[offsets[(key >> shift) & 0xFFu]++] = source[index];
+            }
+            hud::swap(source, destination);
+        }
+        if (source != begin) {
+            hud::memory::copy_assign_object_array(begin, source, count);
+        }
+        hud::memory::free_array(buffer, count);
+    }
+
+    /**
+     * Sort the integral elements of a slice in ascending order with a least significant digit radix sort.
+     * @tparam type_t The integral type of element
+     * @param slice The slice of elements to sort
+     */
+    template<typename type_t>
+    requires(hud::is_integral_v<type_t> && !hud::is_bool_v<type_t>)
+    static constexpr void radix_sort(hud::slice<type_t> slice) noexcept
+    {
+        hud::radix_sort(slice.data(), slice.data() + slice.count());
+    }
+
+} // namespace hud
+
+#endif // HD_INC_CORE_ALGORITHMS_SORT_H
@@ -31,6 +31,22 @@ namespace hud
             return memory_allocation_type<type_t>(memory::allocate_align<type_t>(count, alignment), count);
         }
 
+        /**
+         * Reallocate memory block, the block can be extended or shrunk in place.
+         * The content of the buffer is preserved up to the lesser of the old and new sizes.
+         * Never used in a constant evaluated expression.
+         * @tparam type_t The element type to reallocate
+         * @param buffer The buffer to reallocate. Invalidated if the reallocation succeed
+         * @param count Number of element type_t to allocate
+         * @return allocation of the reallocated memory block, empty allocation if failed (buffer is still valid)
+         */
+        template<typename type_t>
+        [[nodiscard]] memory_allocation_type<type_t> reallocate(const memory_allocation_type<type_t> &buffer, const usize count) noexcept
+        {
+            type_t *pointer = reinterpret_cast<type_t *>(hud::memory::reallocate_align(buffer.data(), count * sizeof(type_t), alignment));
+            return pointer != nullptr ? memory_allocation_type<type_t>(pointer, count) : memory_allocation_type<type_t>();
+        }
+
         /**
          * Free memory block
          * @param buffer The buffer to free
@@ -49,12 +65,15 @@ namespace hud
         using copy_when_container_copy_assigned = hud::false_type;
         using move_when_container_move_assigned = hud::false_type;
         using swap_when_container_swap = hud::false_type;
+        using can_reallocate = hud::true_type;
+        using growth_policy = hud::default_growth_policy;
     };
 
     static_assert(hud::allocator_traits<aligned_heap_allocator<8>>::is_always_equal::value);
     static_assert(!hud::allocator_traits<aligned_heap_allocator<8>>::copy_when_container_copy_assigned::value);
     static_assert(!hud::allocator_traits<aligned_heap_allocator<8>>::move_when_container_move_assigned::value);
     static_assert(!hud::allocator_traits<aligned_heap_allocator<8>>::swap_when_container_swap::value);
+    static_assert(hud::allocator_traits<aligned_heap_allocator<8>>::can_reallocate::value);
 
 } // namespace hud
 
@@ -3,6 +3,7 @@
 #include "../traits/integral_constant.h"
 #include "../traits/is_bitwise_copyable.h"
 #include "../traits/is_empty.h"
+#include "growth_policy.h"
 
 namespace hud
 {
@@ -40,6 +41,21 @@ namespace hud
          * If `hud::true_type`, the allocator is swapped when the container is swapped.
          */
         using swap_when_container_swap = hud::true_type;
+
+        /**
+         * Indicates whether `allocator_t` provides `reallocate(const memory_allocation_type<type_t> &buffer, usize count)`.
+         * If `hud::true_type`, containers can grow an allocation of trivially relocatable elements in place instead of allocate, copy and free.
+         * `reallocate` preserves the content up to the lesser of the old and new sizes and returns an empty allocation if it failed.
+         * If `hud::false_type`, containers always allocate a new allocation and relocate elements.
+         */
+        using can_reallocate = hud::false_type;
+
+        /**
+         * The growth policy used by containers to compute the next capacity when they need to grow.
+         * Must provide `static constexpr usize grow(usize max_count, usize required_count)` that returns a capacity greater or equal to `required_count`.
+         * See `hud::geometric_growth_policy`, `hud::fixed_chunk_growth_policy` and `hud::exact_growth_policy`.
+         */
+        using growth_policy = hud::default_growth_policy;
     };
 
 } // namespace hud
@@ -0,0 +1,313 @@
+#ifndef HD_INC_CORE_ALLOCATOR_ARENA_H
+#define HD_INC_CORE_ALLOCATOR_ARENA_H
+#include "../memory.h"
+#include "../slice.h"
+#include "../templates/max.h"
+#include "../templates/min.h"
+#include "memory_allocation.h"
+#include "allocator_traits.h"
+
+namespace hud
+{
+    /**
+     * Monotonic arena that allocates memory by bumping a pointer inside chunks.
+     * Memory is never freed individually, all allocations are released at once with `reset()` or when the arena is destroyed.
+     * The arena can start with a user provided buffer (On the stack for example), chunks are allocated on the heap only when the buffer is full.
+     * Chunks are kept by `reset()` and reused by the next allocations, this makes `reset()` O(1).
+     * The arena is not thread safe and can't be copied or moved because `arena_allocator` refers to it.
+     */
+    class arena
+    {
+    public:
+        /** Default size in bytes of chunks allocated on the heap. */
+        static constexpr usize DEFAULT_CHUNK_SIZE = 4096u;
+
+        /**
+         * Construct an arena that allocate chunks of `chunk_size` bytes on the heap.
+         * @param chunk_size The size in bytes of chunks allocated on the heap
+         */
+        explicit arena(const usize chunk_size = DEFAULT_CHUNK_SIZE) noexcept
+            : chunk_size_(chunk_size)
+        {
+        }
+
+        /**
+         * Construct an arena that allocate in the given buffer first, then in chunks of `chunk_size` bytes allocated on the heap.
+         * The buffer is not owned by the arena and must outlive it.
+         * @param initial_buffer The buffer used before allocating chunks on the heap
+         * @param chunk_size The size in bytes of chunks allocated on the heap
+         */
+        explicit arena(hud::slice<u8> initial_buffer, const usize chunk_size = DEFAULT_CHUNK_SIZE) noexcept
+            : initial_buffer_begin_(initial_buffer.data())
+            , initial_buffer_end_(initial_buffer.data() + initial_buffer.count())
+            , current_ptr_(initial_buffer_begin_)
+            , current_end_(initial_buffer_end_)
+            , chunk_size_(chunk_size)
+        {
+        }
+
+        arena(const arena &) = delete;
+        arena &operator=(const arena &) = delete;
+
+        /** Free all chunks allocated on the heap. */
+        ~arena() noexcept
+        {
+            chunk_header *chunk = first_chunk_;
+            while (chunk != nullptr) {
+                chunk_header *next = chunk->next;
+                hud::memory::free(chunk);
+                chunk = next;
+            }
+        }
+
+        /**
+         * Allocate a memory block.
+         * @param size Number of bytes to allocate
+         * @param alignment Required alignment in bytes. Must be a power of two
+         * @return Pointer to the allocated memory block, nullptr if size is 0 or if the allocation failed
+         */
+        [[nodiscard]] void *allocate(const usize size, const u32 alignment) noexcept
+        {
+            if (size == 0u) [[unlikely]] {
+                return nullptr;
+            }
+            u8 *aligned_ptr = reinterpret_cast<u8 *>(hud::memory::align_address(reinterpret_cast<uptr>(current_ptr_), alignment));
+            if (current_ptr_ == nullptr || aligned_ptr + size > current_end_) [[unlikely]] {
+                if (!next_chunk(size + alignment)) {
+                    return nullptr;
+                }
+                aligned_ptr = reinterpret_cast<u8 *>(hud::memory::align_address(reinterpret_cast<uptr>(current_ptr_), alignment));
+            }
+            last_allocation_ = aligned_ptr;
+            current_ptr_ = aligned_ptr + size;
+            return aligned_ptr;
+        }
+
+        /**
+         * Try to resize the last allocation in place.
+         * @param pointer Pointer to the memory block to resize
+         * @param size The new size in bytes of the memory block
+         * @return true if the memory block is the last allocation and is resized, false otherwise
+         */
+        [[nodiscard]] bool try_resize_last_allocation(const void *pointer, const usize size) noexcept
+        {
+            if (pointer == nullptr || pointer != last_allocation_ || last_allocation_ + size > current_end_) {
+                return false;
+            }
+            current_ptr_ = last_allocation_ + size;
+            return true;
+        }
+
+        /**
+         * Release all allocations at once without freeing chunks.
+         * All memory allocated by the arena is invalidated and reused by next allocations.
+         * No destructor is called.
+         */
+        void reset() noexcept
+        {
+            current_chunk_ = nullptr;
+            current_ptr_ = initial_buffer_begin_;
+            current_end_ = initial_buffer_end_;
+            last_allocation_ = nullptr;
+        }
+
+        /** Retrieves the number of bytes allocated on the heap by the arena. */
+        [[nodiscard]] usize heap_byte_count() const noexcept
+        {
+            usize byte_count = 0u;
+            for (const chunk_header *chunk = first_chunk_; chunk != nullptr; chunk = chunk->next) {
+                byte_count += chunk->size;
+            }
+            return byte_count;
+        }
+
+        /** Retrieves the size in bytes of chunks allocated on the heap. */
+        [[nodiscard]] usize chunk_size() const noexcept
+        {
+            return chunk_size_;
+        }
+
+    private:
+        /** Header at the beginning of each chunk allocated on the heap. */
+        struct chunk_header
+        {
+            /** The next chunk in the list. */
+            chunk_header *next;
+            /** The size in bytes of the chunk, header included. */
+            usize size;
+        };
+
+        /**
+         * Move to the next chunk that can contains `min_size` bytes.
+         * Reuse chunks kept by `reset()` if possible, allocate a new chunk on the heap otherwise.
+         * @param min_size Minimum size in bytes the chunk must contains
+         * @return true if the current chunk is changed, false if the allocation failed
+         */
+        [[nodiscard]] bool next_chunk(const usize min_size) noexcept
+        {
+            chunk_header *previous = current_chunk_;
+            chunk_header *candidate = current_chunk_ == nullptr ? first_chunk_ : current_chunk_->next;
+            // Reuse the next chunk if it is big enough
+            if (candidate != nullptr && candidate->size - sizeof(chunk_header) >= min_size) {
+                use_chunk(candidate);
+                return true;
+            }
+
+            // Allocate a new chunk and insert it after the current one
+            const usize min_chunk_size = min_size + sizeof(chunk_header);
+            const usize size = hud::max(chunk_size_, min_chunk_size);
+            chunk_header *chunk = reinterpret_cast<chunk_header *>(hud::memory::allocate(size));
+            if (chunk == nullptr) [[unlikely]] {
+                return false;
+            }
+            chunk->next = candidate;
+            chunk->size = size;
+            if (previous == nullptr) {
+                first_chunk_ = chunk;
+            }
+            else {
+                previous->next = chunk;
+            }
+            use_chunk(chunk);
+            return true;
+        }
+
+        /** Set the given chunk as the current chunk. */
+        void use_chunk(chunk_header *chunk) noexcept
+        {
+            current_chunk_ = chunk;
+            current_ptr_ = reinterpret_cast<u8 *>(chunk) + sizeof(chunk_header);
+            current_end_ = reinterpret_cast<u8 *>(chunk) + chunk->size;
+        }
+
+    private:
+        /** Beginning of the user provided buffer. */
+        u8 *initial_buffer_begin_ = nullptr;
+        /** End of the user provided buffer. */
+        u8 *initial_buffer_end_ = nullptr;
+        /** The list of chunks allocated on the heap. */
+        chunk_header *first_chunk_ = nullptr;
+        /** The chunk currently used, nullptr if the user provided buffer is used. */
+        chunk_header *current_chunk_ = nullptr;
+        /** Pointer to the next free byte. */
+        u8 *current_ptr_ = nullptr;
+        /** End of the current buffer. */
+        u8 *current_end_ = nullptr;
+        /** The last allocation, used to resize it in place. */
+        u8 *last_allocation_ = nullptr;
+        /** The size in bytes of chunks allocated on the heap. */
+        usize chunk_size_;
+    };
+
+    /**
+     * Allocator that allocate in a `hud::arena`.
+     * Freeing memory does nothing, the memory is released when the arena is reset or destroyed.
+     * The allocator only refers to the arena, the arena must outlive all containers using it.
+     * In a constant evaluated expression, the allocator allocate and free like `heap_allocator`.
+     */
+    struct arena_allocator
+    {
+        /** The type of allocation done by this allocator. */
+        template<typename type_t>
+        using memory_allocation_type = hud::memory_allocation<type_t>;
+
+        /** Construct an allocator that does not refer to an arena. Must be assigned before any allocation. */
+        constexpr arena_allocator() noexcept = default;
+
+        /**
+         * Construct an allocator that allocate in the given arena.
+         * @param arena The arena to allocate in
+         */
+        constexpr arena_allocator(hud::arena &arena) noexcept
+            : arena_(&arena)
+        {
+        }
+
+        /**
+         * Allocate memory block aligned on alignof(type_t)
+         * @tparam type_t The element type to allocate
+         * @param count Number of element type_t to allocate
+         * @return allocation of the allocated memory block, empty allocation if failed
+         */
+        template<typename type_t = u8>
+        [[nodiscard]] constexpr memory_allocation_type<type_t> allocate(const usize count) noexcept
+        {
+            if consteval {
+                return memory_allocation_type<type_t>(hud::memory::allocate_array<type_t>(count), count);
+            }
+            else {
+                check(arena_ != nullptr);
+                type_t *pointer = reinterpret_cast<type_t *>(arena_->allocate(count * sizeof(type_t), alignof(type_t)));
+                return pointer != nullptr ? memory_allocation_type<type_t>(pointer, count) : memory_allocation_type<type_t>();
+            }
+        }
+
+        /**
+         * Reallocate memory block, the block is resized in place if it is the last allocation of the arena.
+         * The content of the buffer is preserved up to the lesser of the old and new sizes.
+         * Never used in a constant evaluated expression.
+         * @tparam type_t The element type to reallocate
+         * @param buffer The buffer to reallocate. Invalidated if the reallocation succeed
+         * @param count Number of element type_t to allocate
+         * @return allocation of the reallocated memory block, empty allocation if failed (buffer is still valid)
+         */
+        template<typename type_t>
+        [[nodiscard]] memory_allocation_type<type_t> reallocate(const memory_allocation_type<type_t> &buffer, const usize count) noexcept
+        {
+            check(arena_ != nullptr);
+            if (arena_->try_resize_last_allocation(buffer.data(), count * sizeof(type_t))) {
+                return memory_allocation_type<type_t>(buffer.data(), count);
+            }
+            memory_allocation_type<type_t> new_buffer = allocate<type_t>(count);
+            if (!new_buffer.is_empty() && !buffer.is_empty()) {
+                hud::memory::copy_memory(new_buffer.data(), buffer.data(), hud::min(buffer.byte_count(), new_buffer.byte_count()));
+            }
+            return new_buffer;
+        }
+
+        /**
+         * Free memory block. Does nothing, the memory is released when the arena is reset or destroyed.
+         * @param buffer The buffer to free
+         */
+        template<typename type_t>
+        constexpr void free([[maybe_unused]] const memory_allocation_type<type_t> &buffer) noexcept
+        {
+            if consteval {
+                hud::memory::free_array(buffer.data(), buffer.count());
+            }
+        }
+
+        /** Retrieves the arena used by the allocator. */
+        [[nodiscard]] constexpr hud::arena *arena() const noexcept
+        {
+            return arena_;
+        }
+
+        /** Checks whether two allocators allocate in the same arena. */
+        [[nodiscard]] constexpr bool operator==(const arena_allocator &other) const noexcept = default;
+
+    private:
+        /** The arena where allocations are done. */
+        hud::arena *arena_ = nullptr;
+    };
+
+    template<>
+    struct allocator_traits<arena_allocator>
+    {
+        using is_always_equal = hud::false_type;
+        using copy_when_container_copy_assigned = hud::false_type;
+        using move_when_container_move_assigned = hud::true_type;
+        using swap_when_container_swap = hud::true_type;
+        using can_reallocate = hud::true_type;
+        using growth_policy = hud::default_growth_policy;
+    };
+
+    static_assert(!hud::allocator_traits<arena_allocator>::is_always_equal::value);
+    static_assert(!hud::allocator_traits<arena_allocator>::copy_when_container_copy_assigned::value);
+    static_assert(hud::allocator_traits<arena_allocator>::move_when_container_move_assigned::value);
+    static_assert(hud::allocator_traits<arena_allocator>::swap_when_container_swap::value);
+    static_assert(hud::allocator_traits<arena_allocator>::can_reallocate::value);
+
+} // namespace hud
+
+#endif // HD_INC_CORE_ALLOCATOR_ARENA_H
@@ -0,0 +1,88 @@
+#ifndef HD_INC_CORE_ALLOCATOR_GROWTH_POLICY_H
+#define HD_INC_CORE_ALLOCATOR_GROWTH_POLICY_H
+#include "../types.h"
+#include "../templates/max.h"
+
+namespace hud
+{
+    /**
+     * Growth policy that multiply the current capacity by `numerator / denominator` each time a container need to grow.
+     * Amortize the cost of relocation to O(1) per insertion.
+     * If the geometric capacity is not enough to store the required count, the required count is used.
+     * @tparam numerator The numerator of the growth factor
+     * @tparam denominator The denominator of the growth factor
+     */
+    template<usize numerator, usize denominator>
+    requires(denominator > 0u && numerator > denominator)
+    struct geometric_growth_policy
+    {
+        /**
+         * Compute the next capacity of a container.
+         * @param max_count The current capacity of the container
+         * @param required_count The count of elements the container must be able to contains
+         * @return The next capacity, always greater or equal to `required_count`
+         */
+        [[nodiscard]] static constexpr usize grow(const usize max_count, const usize required_count) noexcept
+        {
+            // Saturate instead of overflowing if the capacity is too big to be multiplied
+            const usize geometric_count = max_count <= hud::usize_max / numerator ? (max_count * numerator) / denominator : hud::usize_max;
+            return hud::max(geometric_count, required_count);
+        }
+    };
+
+    /**
+     * Growth policy that grow the capacity by chunk of `chunk_count` elements.
+     * The capacity is always a multiple of `chunk_count`.
+     * Useful when memory usage is more important than relocation cost.
+     * @tparam chunk_count The count of elements in a chunk
+     */
+    template<usize chunk_count>
+    requires(chunk_count > 0u)
+    struct fixed_chunk_growth_policy
+    {
+        /**
+         * Compute the next capacity of a container.
+         * @param max_count The current capacity of the container
+         * @param required_count The count of elements the container must be able to contains
+         * @return The next capacity, always greater or equal to `required_count`
+         */
+        [[nodiscard]] static constexpr usize grow([[maybe_unused]] const usize max_count, const usize required_count) noexcept
+        {
+            const usize remainder = required_count % chunk_count;
+            if (remainder == 0u || required_count > hud::usize_max - chunk_count) {
+                return required_count;
+            }
+            return required_count + (chunk_count - remainder);
+        }
+    };
+
+    /**
+     * Growth policy that grow the capacity to exactly the required count.
+     * Each growth relocate all elements, use it only when the final count is known or memory is very constrained.
+     */
+    struct exact_growth_policy
+    {
+        /**
+         * Compute the next capacity of a container.
+         * @param max_count The current capacity of the container
+         * @param required_count The count of elements the container must be able to contains
+         * @return `required_count`
+         */
+        [[nodiscard]] static constexpr usize grow([[maybe_unused]] const usize max_count, const usize required_count) noexcept
+        {
+            return required_count;
+        }
+    };
+
+    /** Growth policy that multiply the capacity by 1.5. */
+    using growth_policy_1_5x = geometric_growth_policy<3u, 2u>;
+
+    /** Growth policy that multiply the capacity by 2. */
+    using growth_policy_2x = geometric_growth_policy<2u, 1u>;
+
+    /** The growth policy used by containers when the allocator does not provide one. */
+    using default_growth_policy = growth_policy_1_5x;
+
+} // namespace hud
+
+#endif // HD_INC_CORE_ALLOCATOR_GROWTH_POLICY_H
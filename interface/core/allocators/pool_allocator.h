@@ -0,0 +1,415 @@
+#ifndef HD_INC_CORE_ALLOCATOR_POOL_H
+#define HD_INC_CORE_ALLOCATOR_POOL_H
+#include "../memory.h"
+#include "../math.h"
+#include "../bits.h"
+#include "../templates/max.h"
+#include "../atomics.h"
+#include "memory_allocation.h"
+#include "allocator_traits.h"
+
+namespace hud
+{
+    /**
+     * Size-class pool that serve small allocations from free lists.
+     * Each size class is a power of two between `MIN_BLOCK_SIZE` and `MAX_BLOCK_SIZE` bytes.
+     * Blocks are carved out of page-sized slabs allocated on the heap and are never returned to the heap before the pool is destroyed,
+     * a freed block is pushed on the free list of its size class and reused by the next allocation of the same size class.
+     * Allocations bigger than `MAX_BLOCK_SIZE` or with an alignment bigger than `MAX_ALIGNMENT` are forwarded to the heap.
+     *
+     * A pool is owned by the thread that constructs it, only this thread can allocate, use `pool::this_thread()` to get a pool owned by the calling thread.
+     * Any thread can free a block. A block freed by another thread is pushed on a lock-free remote free list of its size class,
+     * the owner thread moves the remote free list to its free list when the free list of the size class is empty.
+     */
+    class pool
+    {
+    public:
+        /** Size in bytes of slabs allocated on the heap. */
+        static constexpr usize SLAB_SIZE = 4096u;
+        /** Size in bytes of the smallest size class. A block must be able to store a free list link. */
+        static constexpr usize MIN_BLOCK_SIZE = 8u;
+        /** Size in bytes of the biggest size class. */
+        static constexpr usize MAX_BLOCK_SIZE = 1024u;
+        /** Biggest alignment served by the pool, this is the alignment guaranteed by the heap for slabs. */
+        static constexpr u32 MAX_ALIGNMENT = 2u * sizeof(void *);
+        /** Count of size classes. */
+        static constexpr usize SIZE_CLASS_COUNT = 8u;
+
+        static_assert(MIN_BLOCK_SIZE >= sizeof(void *), "A block must be able to store a free list link");
+        static_assert((MIN_BLOCK_SIZE << (SIZE_CLASS_COUNT - 1u)) == MAX_BLOCK_SIZE, "Size classes must cover all power of two between MIN_BLOCK_SIZE and MAX_BLOCK_SIZE");
+
+        /** Construct an empty pool owned by the calling thread. No slab is allocated until the first allocation. */
+        pool() noexcept
+            : owner_thread_id_(this_thread_id())
+        {
+        }
+
+        pool(const pool &) = delete;
+        pool &operator=(const pool &) = delete;
+
+        /** Free all slabs allocated on the heap. */
+        ~pool() noexcept
+        {
+            slab_header *slab = slabs_;
+            while (slab != nullptr) {
+                slab_header *next = slab->next;
+                hud::memory::free(slab);
+                slab = next;
+            }
+        }
+
+        /**
+         * Allocate a memory block. Must be called by the thread that owns the pool.
+         * @param size Number of bytes to allocate
+         * @param alignment Required alignment in bytes. Must be a power of two
+         * @return Pointer to the allocated memory block, nullptr if size is 0 or if the allocation failed
+         */
+        [[nodiscard]] void *allocate(const usize size, const u32 alignment) noexcept
+        {
+            HUD_CHECK(owner_thread_id_ == this_thread_id() && "Only the thread that owns the pool can allocate");
+            if (size == 0u) [[unlikely]] {
+                return nullptr;
+            }
+            if (!is_pooled(size, alignment)) [[unlikely]] {
+                return hud::memory::allocate_align(size, alignment);
+            }
+            const usize class_index = size_class_index(size, alignment);
+            if (free_lists_[class_index] == nullptr) [[unlikely]] {
+                // Take back the blocks freed by other threads before allocating a new slab
+                free_lists_[class_index] = hud::atomics::exchange(remote_free_lists_[class_index], static_cast<free_block *>(nullptr), hud::atomics::memory_order_e::acquire);
+                if (free_lists_[class_index] == nullptr && !allocate_slab(class_index)) [[unlikely]] {
+                    return nullptr;
+                }
+            }
+            free_block *block = free_lists_[class_index];
+            free_lists_[class_index] = block->next;
+            live_block_count_++;
+            return block;
+        }
+
+        /**
+         * Free a memory block allocated by this pool. Can be called by any thread.
+         * A block freed by another thread than the owner is pushed on the remote free list of its size class.
+         * @param pointer Pointer to the memory block to free
+         * @param size The size given to `allocate`
+         * @param alignment The alignment given to `allocate`
+         */
+        void free(void *pointer, const usize size, const u32 alignment) noexcept
+        {
+            if (pointer == nullptr) [[unlikely]] {
+                return;
+            }
+            if (!is_pooled(size, alignment)) [[unlikely]] {
+                hud::memory::free_align(pointer);
+                return;
+            }
+            const usize class_index = size_class_index(size, alignment);
+            free_block *block = static_cast<free_block *>(pointer);
+            if (owner_thread_id_ != this_thread_id()) [[unlikely]] {
+                free_remote(block, class_index);
+                return;
+            }
+            block->next = free_lists_[class_index];
+            free_lists_[class_index] = block;
+            live_block_count_--;
+        }
+
+        /** Retrieves the count of slabs allocated on the heap. */
+        [[nodiscard]] usize slab_count() const noexcept
+        {
+            return slab_count_;
+        }
+
+        /**
+         * Retrieves the pool of the calling thread.
+         * The pool is allocated on the heap by the first call in the thread. When the thread exits, the pool is destroyed
+         * if all its blocks are freed, otherwise it is destroyed by the thread that frees its last block.
+         */
+        [[nodiscard]] static pool &this_thread() noexcept
+        {
+            thread_local thread_pool_owner owner;
+            return *owner.pool;
+        }
+
+        /**
+         * Retrieves the size in bytes of the block used to allocate `size` bytes aligned on `alignment`.
+         * @param size Number of bytes to allocate
+         * @param alignment Required alignment in bytes
+         * @return The size of the block, or `size` if the allocation is not served by the pool
+         */
+        [[nodiscard]] static constexpr usize block_size(const usize size, const u32 alignment) noexcept
+        {
+            if (!is_pooled(size, alignment)) {
+                return size;
+            }
+            return hud::math::next_power_of_two(static_cast<u32>(hud::max(hud::max(size, static_cast<usize>(alignment)), MIN_BLOCK_SIZE)));
+        }
+
+    private:
+        /** Owns the pool of a thread and releases it when the thread exits. */
+        struct thread_pool_owner
+        {
+            thread_pool_owner() noexcept
+                : pool(static_cast<hud::pool *>(hud::memory::allocate(sizeof(hud::pool))))
+            {
+                HUD_CHECK(pool != nullptr && "Failed to allocate the pool of the thread");
+                hud::memory::construct_object_at(pool);
+            }
+
+            ~thread_pool_owner() noexcept
+            {
+                pool->release_owner();
+            }
+
+            /** The pool of the thread. */
+            hud::pool *pool;
+        };
+
+        /** A free block, linked in the free list of its size class. */
+        struct free_block
+        {
+            /** The next free block in the list. */
+            free_block *next;
+        };
+
+        /** Header at the beginning of each slab. */
+        struct slab_header
+        {
+            /** The next slab in the list. */
+            slab_header *next;
+        };
+
+        /** Retrieves a unique identifier of the calling thread. Identifiers are never reused. */
+        [[nodiscard]] static usize this_thread_id() noexcept
+        {
+            static constinit usize next_thread_id = 1u;
+            static constinit thread_local usize thread_id = 0u;
+            if (thread_id == 0u) [[unlikely]] {
+                thread_id = hud::atomics::fetch_add(next_thread_id, usize {1u}, hud::atomics::memory_order_e::relaxed);
+            }
+            return thread_id;
+        }
+
+        /**
+         * Push a block freed by another thread than the owner on the remote free list of its size class.
+         * If the owner thread has exited, the thread that frees the last block of the pool destroys it.
+         */
+        void free_remote(free_block *block, const usize class_index) noexcept
+        {
+            free_block *head = hud::atomics::load(remote_free_lists_[class_index], hud::atomics::memory_order_e::relaxed);
+            do {
+                block->next = head;
+            } while (!hud::atomics::compare_and_set(remote_free_lists_[class_index], head, block, hud::atomics::memory_order_e::release));
+
+            if (hud::atomics::fetch_sub(remote_free_count_, usize {1u}, hud::atomics::memory_order_e::acq_rel) == 1u) {
+                destroy(this);
+            }
+        }
+
+        /**
+         * Called by the owner thread when it exits.
+         * Remove the bias of `remote_free_count_`, the counter then contains the count of blocks that are not freed yet.
+         * The pool is destroyed now if all blocks are freed, otherwise by the thread that frees the last block.
+         */
+        void release_owner() noexcept
+        {
+            const usize unbias = live_block_count_ - OWNED_BIAS;
+            if (hud::atomics::fetch_add(remote_free_count_, unbias, hud::atomics::memory_order_e::acq_rel) + unbias == 0u) {
+                destroy(this);
+            }
+        }
+
+        /** Destroy and free a pool allocated by `thread_pool_owner`. */
+        static void destroy(hud::pool *pool) noexcept
+        {
+            hud::memory::destroy_object(pool);
+            hud::memory::free(pool);
+        }
+
+        /** Checks whether an allocation is served by the pool or forwarded to the heap. */
+        [[nodiscard]] static constexpr bool is_pooled(const usize size, const u32 alignment) noexcept
+        {
+            return size <= MAX_BLOCK_SIZE && alignment <= MAX_ALIGNMENT;
+        }
+
+        /** Retrieves the index of the size class used to allocate `size` bytes aligned on `alignment`. */
+        [[nodiscard]] static constexpr usize size_class_index(const usize size, const u32 alignment) noexcept
+        {
+            return hud::bits::trailing_zeros(static_cast<u32>(block_size(size, alignment))) - hud::bits::trailing_zeros(static_cast<u32>(MIN_BLOCK_SIZE));
+        }
+
+        /**
+         * Allocate a slab and push all its blocks in the free list of the size class.
+         * The header of the slab use the first block.
+         * @param class_index The index of the size class
+         * @return true if the slab is allocated, false otherwise
+         */
+        [[nodiscard]] bool allocate_slab(const usize class_index) noexcept
+        {
+            u8 *slab = static_cast<u8 *>(hud::memory::allocate(SLAB_SIZE));
+            if (slab == nullptr) [[unlikely]] {
+                return false;
+            }
+            slab_header *header = reinterpret_cast<slab_header *>(slab);
+            header->next = slabs_;
+            slabs_ = header;
+            slab_count_++;
+
+            // Link blocks from the end so the first allocations are at the lowest addresses
+            const usize class_block_size = MIN_BLOCK_SIZE << class_index;
+            free_block *head = free_lists_[class_index];
+            for (usize offset = SLAB_SIZE - class_block_size; offset >= class_block_size; offset -= class_block_size) {
+                free_block *block = reinterpret_cast<free_block *>(slab + offset);
+                block->next = head;
+                head = block;
+            }
+            free_lists_[class_index] = head;
+            return true;
+        }
+
+    private:
+        /** Bias added to `remote_free_count_` while the owner thread is alive, the counter never reaches 0 before the owner thread exits. */
+        static constexpr usize OWNED_BIAS = (~usize {0u}) >> 1u;
+
+        /** Identifier of the thread that owns the pool. */
+        usize owner_thread_id_;
+        /** Free list of each size class. */
+        free_block *free_lists_[SIZE_CLASS_COUNT] = {};
+        /** Blocks freed by other threads than the owner, for each size class. Accessed atomically. */
+        free_block *remote_free_lists_[SIZE_CLASS_COUNT] = {};
+        /** Count of blocks allocated and not freed by the owner thread. Blocks freed by other threads are not counted. */
+        usize live_block_count_ = 0u;
+        /** `OWNED_BIAS` minus the count of blocks freed by other threads. Accessed atomically. */
+        usize remote_free_count_ = OWNED_BIAS;
+        /** The list of slabs allocated on the heap. */
+        slab_header *slabs_ = nullptr;
+        /** Count of slabs allocated on the heap. */
+        usize slab_count_ = 0u;
+    };
+
+    /**
+     * Allocator that allocate in a `hud::pool`.
+     * A default constructed allocator use the pool of the calling thread. Only the owner thread of the pool can allocate, any thread can free.
+     * The allocator only refers to the pool, the pool must outlive all containers using it.
+     */
+    struct pool_allocator
+    {
+        /** The type of allocation done by this allocator. */
+        template<typename type_t>
+        using memory_allocation_type = hud::memory_allocation<type_t>;
+
+        /** Construct an allocator that allocate in the pool of the calling thread. */
+        pool_allocator() noexcept
+            : pool_(&hud::pool::this_thread())
+        {
+        }
+
+        /**
+         * Construct an allocator that allocate in the given pool.
+         * @param pool The pool to allocate in
+         */
+        constexpr pool_allocator(hud::pool &pool) noexcept
+            : pool_(&pool)
+        {
+        }
+
+        /**
+         * Allocate memory block aligned on alignof(type_t)
+         * @tparam type_t The element type to allocate
+         * @param count Number of element type_t to allocate
+         * @return allocation of the allocated memory block, empty allocation if failed
+         */
+        template<typename type_t = u8>
+        [[nodiscard]] memory_allocation_type<type_t> allocate(const usize count) noexcept
+        {
+            type_t *pointer = static_cast<type_t *>(pool_->allocate(count * sizeof(type_t), alignof(type_t)));
+            return pointer != nullptr ? memory_allocation_type<type_t>(pointer, count) : memory_allocation_type<type_t>();
+        }
+
+        /**
+         * Free memory block, the block is reused by the next allocation of the same size class.
+         * @param buffer The buffer to free
+         */
+        template<typename type_t>
+        void free(const memory_allocation_type<type_t> &buffer) noexcept
+        {
+            pool_->free(buffer.data(), buffer.byte_count(), alignof(type_t));
+        }
+
+        /** Retrieves the pool used by the allocator. */
+        [[nodiscard]] constexpr hud::pool *pool() const noexcept
+        {
+            return pool_;
+        }
+
+        /** Checks whether two allocators allocate in the same pool. */
+        [[nodiscard]] constexpr bool operator==(const pool_allocator &other) const noexcept = default;
+
+    private:
+        /** The pool where allocations are done. */
+        hud::pool *pool_;
+    };
+
+    /** Function object class, whose function-like invokation takes an object of type type_t* allocated with a `pool_allocator`, destroys it and frees it. */
+    template<typename type_t>
+    struct pool_deleter
+    {
+        /** The pointer type to delete. */
+        using pointer_type = type_t *;
+
+        /** Construct a deleter that frees in the pool of the calling thread. */
+        pool_deleter() noexcept = default;
+
+        /**
+         * Construct a deleter that frees with the given allocator.
+         * @param allocator The allocator used to allocate the object
+         */
+        explicit constexpr pool_deleter(const hud::pool_allocator &allocator) noexcept
+            : allocator_(allocator)
+        {
+        }
+
+        /** Destroy the object and free its memory block. Does nothing if ptr is nullptr. */
+        void operator()(type_t *ptr) const noexcept
+        {
+            // Ensure we don't have an incomplete type
+            static_assert(0 < sizeof(type_t), "can't delete an incomplete type");
+            if (ptr == nullptr) {
+                return;
+            }
+            hud::memory::destroy_object(ptr);
+            hud::pool_allocator allocator = allocator_;
+            allocator.free(hud::memory_allocation<type_t>(ptr, 1u));
+        }
+
+        /** Retrieves the allocator used to free the object. */
+        [[nodiscard]] constexpr const hud::pool_allocator &allocator() const noexcept
+        {
+            return allocator_;
+        }
+
+    private:
+        /** The allocator used to free the object. */
+        hud::pool_allocator allocator_;
+    };
+
+    template<>
+    struct allocator_traits<pool_allocator>
+    {
+        using is_always_equal = hud::false_type;
+        using copy_when_container_copy_assigned = hud::false_type;
+        using move_when_container_move_assigned = hud::true_type;
+        using swap_when_container_swap = hud::true_type;
+        using can_reallocate = hud::false_type;
+        using growth_policy = hud::default_growth_policy;
+    };
+
+    static_assert(!hud::allocator_traits<pool_allocator>::is_always_equal::value);
+    static_assert(!hud::allocator_traits<pool_allocator>::copy_when_container_copy_assigned::value);
+    static_assert(hud::allocator_traits<pool_allocator>::move_when_container_move_assigned::value);
+    static_assert(hud::allocator_traits<pool_allocator>::swap_when_container_swap::value);
+    static_assert(!hud::allocator_traits<pool_allocator>::can_reallocate::value);
+
+} // namespace hud
+
+#endif // HD_INC_CORE_ALLOCATOR_POOL_H
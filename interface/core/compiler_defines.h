@@ -255,4 +255,16 @@ SSE             __SSE__
 #define HD_SSE4_2 0
 #endif
 
+#if defined(__wasm_simd128__)
+#define HD_WASM_SIMD128 1
+#else
+#define HD_WASM_SIMD128 0
+#endif
+
+#if defined(__ARM_NEON) || defined(_M_ARM64)
+#define HD_NEON 1
+#else
+#define HD_NEON 0
+#endif
+
 #endif // HD_INC_CORE_COMPILER_DEFINES_H
@@ -0,0 +1,433 @@
+#ifndef HD_INC_CORE_CONCURRENT_HASHMAP_H
+#define HD_INC_CORE_CONCURRENT_HASHMAP_H
+#include "hashmap.h"
+#include "optional.h"
+#include "../atomics.h"
+#include "../hash/wyhash.h"
+
+namespace hud
+{
+    namespace details::concurrent_hashmap
+    {
+        /**
+         * Readers-writer spin lock protecting a shard.
+         *
+         * The state is a single 32 bits atomic: the high bit is set while a writer owns or waits for the lock,
+         * the other bits count the readers. A writer first sets the writer bit, which blocks new readers,
+         * then waits for the readers in progress to leave. This prevents writers starvation when reads dominate.
+         *
+         * The lock is not recursive and spins without ever sleeping, it is designed for short critical sections.
+         */
+        class shared_spin_lock
+        {
+        public:
+            /** Acquires the lock for exclusive ownership. */
+            void lock() noexcept
+            {
+                u32 state {state_.load(hud::atomics::memory_order_e::relaxed)};
+                while ((state & WRITER_BIT) != 0 || !state_.compare_exchange(state, state | WRITER_BIT, hud::atomics::memory_order_e::acquire))
+                {
+                    cpu_relax();
+                    state = state_.load(hud::atomics::memory_order_e::relaxed);
+                }
+                // New readers are now blocked, wait for readers in progress
+                while ((state_.load(hud::atomics::memory_order_e::acquire) & READER_MASK) != 0)
+                {
+                    cpu_relax();
+                }
+            }
+
+            /** Releases the exclusive ownership. */
+            void unlock() noexcept
+            {
+                state_.store(0, hud::atomics::memory_order_e::release);
+            }
+
+            /** Acquires the lock for shared ownership. */
+            void lock_shared() noexcept
+            {
+                u32 state {state_.load(hud::atomics::memory_order_e::relaxed)};
+                while ((state & WRITER_BIT) != 0 || !state_.compare_exchange(state, state + 1, hud::atomics::memory_order_e::acquire))
+                {
+                    cpu_relax();
+                    state = state_.load(hud::atomics::memory_order_e::relaxed);
+                }
+            }
+
+            /** Releases the shared ownership. */
+            void unlock_shared() noexcept
+            {
+                state_.fetch_sub(1, hud::atomics::memory_order_e::release);
+            }
+
+        private:
+            /** Hints the processor that the thread is spinning in a wait loop. */
+            static HD_FORCEINLINE void cpu_relax() noexcept
+            {
+#if HD_SSE2
+                _mm_pause();
+#elif defined(HD_TARGET_ARM_FAMILY) && defined(HD_COMPILER_MSVC)
+                __yield();
+#elif defined(HD_TARGET_ARM_FAMILY)
+                __asm__ __volatile__("yield");
+#endif
+            }
+
+        private:
+            /** Bit set when a writer owns or waits for the lock. */
+            static constexpr u32 WRITER_BIT {0x80000000u};
+            /** Bits counting the readers. */
+            static constexpr u32 READER_MASK {~WRITER_BIT};
+            /** The lock state. */
+            hud::atomic<u32> state_ {0};
+        };
+
+        /** Acquires a `shared_spin_lock` for exclusive ownership until the end of the scope. */
+        class unique_lock_guard
+        {
+        public:
+            explicit unique_lock_guard(shared_spin_lock &lock) noexcept
+                : lock_(lock)
+            {
+                lock_.lock();
+            }
+
+            ~unique_lock_guard() noexcept
+            {
+                lock_.unlock();
+            }
+
+        private:
+            /** The owned lock. */
+            shared_spin_lock &lock_;
+        };
+
+        /** Acquires a `shared_spin_lock` for shared ownership until the end of the scope. */
+        class shared_lock_guard
+        {
+        public:
+            explicit shared_lock_guard(shared_spin_lock &lock) noexcept
+                : lock_(lock)
+            {
+                lock_.lock_shared();
+            }
+
+            ~shared_lock_guard() noexcept
+            {
+                lock_.unlock_shared();
+            }
+
+        private:
+            /** The owned lock. */
+            shared_spin_lock &lock_;
+        };
+
+        /**
+         * A shard of the concurrent hash map: a hash map and the lock that protects it.
+         * Shards are aligned on a cache line so that locking a shard never invalidates the cache line of another shard.
+         * @tparam map_t The hash map type of the shard
+         */
+        template<typename map_t>
+        struct alignas(64) shard
+        {
+            /** Lock protecting `map`. */
+            mutable shared_spin_lock lock;
+            /** Elements of the shard. */
+            map_t map;
+        };
+
+    } // namespace details::concurrent_hashmap
+
+    /**
+     * A hash map that can be used concurrently by multiple threads.
+     *
+     * Keys are distributed across `shard_count_v` independent `hud::hashmap` by the high bits of their hash,
+     * each shard is protected by its own readers-writer spin lock. Threads working on keys of different shards
+     * never contend, and readers of the same shard do not block each other.
+     *
+     * The hash of a key is computed once per operation, it selects the shard and is reused to probe the shard.
+     * The low bits of the hash select the slot in the shard, so sharding does not degrade the distribution in a shard.
+     *
+     * Elements are never exposed by reference outside of a lock: `find` returns a copy of the value,
+     * and `update_or_add` and `for_each` call a function with the lock held. These functions must not access the map.
+     *
+     * Example:
+     * ```cpp
+     * hud::concurrent_hashmap<i32, u64> hits;
+     * // From any thread
+     * hits.update_or_add(request_id, [](u64 &count) { count++; });
+     * hud::optional<u64> count = hits.find(request_id);
+     * ```
+     *
+     * @tparam key_t The key type
+     * @tparam value_t The value type
+     * @tparam hasher_t The hasher type, used to select the shard and the slot in the shard
+     * @tparam key_equal_t The key equality comparator type
+     * @tparam allocator_t The allocator type used by each shard
+     * @tparam shard_count_v The number of shards, must be a power of two
+     */
+    template<
+        typename key_t,
+        typename value_t,
+        typename hasher_t = hud::hash_64<key_t>,
+        typename key_equal_t = hud::equal<key_t>,
+        typename allocator_t = hud::heap_allocator,
+        usize shard_count_v = 64>
+    class concurrent_hashmap
+    {
+        static_assert(shard_count_v > 0 && (shard_count_v & (shard_count_v - 1)) == 0, "shard_count_v must be a power of two");
+
+    public:
+        /** Type of the hash map of a shard. */
+        using map_type = hud::hashmap<key_t, value_t, hasher_t, key_equal_t, allocator_t>;
+        /** Type of the key. */
+        using key_type = typename map_type::key_type;
+        /** Type of the value. */
+        using value_type = typename map_type::value_type;
+        /** Type of the hash function. */
+        using hasher_type = typename map_type::hasher_type;
+        /** Type of the equal function. */
+        using key_equal_type = typename map_type::key_equal_type;
+        /** Type of the allocator. */
+        using allocator_type = typename map_type::allocator_type;
+
+        /** The number of shards. */
+        static constexpr usize SHARD_COUNT {shard_count_v};
+
+        /** Default constructor. Constructs an empty map. */
+        explicit concurrent_hashmap() noexcept = default;
+
+        /** Not copyable, not movable. */
+        concurrent_hashmap(const concurrent_hashmap &) = delete;
+        concurrent_hashmap &operator=(const concurrent_hashmap &) = delete;
+
+        /**
+         * Finds an element by key and returns a copy of its value.
+         * @tparam K Type of the key to search for. See `hud::hashmap::find`.
+         * @param key The key to search for.
+         * @return A copy of the value if the key is found, an empty optional otherwise.
+         */
+        template<typename K>
+        [[nodiscard]] hud::optional<value_type> find(K &&key) const noexcept
+        {
+            const u64 hash {hash_of(key)};
+            const shard_type &shard {shard_of(hash)};
+            details::concurrent_hashmap::shared_lock_guard guard {shard.lock};
+            const auto it {shard.map.find_with_hash(hud::forward<K>(key), hash)};
+            if (it == shard.map.end())
+            {
+                return hud::nullopt;
+            }
+            return it->value();
+        }
+
+        /**
+         * Checks whether the key exists in the map.
+         * @tparam K Type of the key to search for. See `hud::hashmap::find`.
+         * @param key The key to search for.
+         * @return `true` if the key is found, `false` otherwise.
+         */
+        template<typename K>
+        [[nodiscard]] bool contains(K &&key) const noexcept
+        {
+            const u64 hash {hash_of(key)};
+            const shard_type &shard {shard_of(hash)};
+            details::concurrent_hashmap::shared_lock_guard guard {shard.lock};
+            return shard.map.contains_with_hash(hud::forward<K>(key), hash);
+        }
+
+        /**
+         * Inserts a key-value pair if the key does not exist.
+         * If the key already exists, its value is left unchanged.
+         * @param key The key to insert.
+         * @param value The value to insert.
+         * @return `true` if the pair is inserted, `false` if the key already exists.
+         */
+        template<typename u_key_t = key_t, typename u_value_t = value_t>
+        bool add(u_key_t &&key, u_value_t &&value) noexcept
+        {
+            const u64 hash {hash_of(key)};
+            shard_type &shard {shard_of(hash)};
+            details::concurrent_hashmap::unique_lock_guard guard {shard.lock};
+            const usize count_before {shard.map.count()};
+            shard.map.add_with_hash(hud::forward<u_key_t>(key), hud::forward<u_value_t>(value), hash);
+            return shard.map.count() != count_before;
+        }
+
+        /**
+         * Updates the value of a key, inserting a default constructed value first if the key does not exist.
+         *
+         * `function` is called with a reference to the value while the shard is locked for writing,
+         * this makes read-modify-write operations like counters atomic.
+         *
+         * @param key The key to update or insert.
+         * @param function Called with `value_type &`. Must not access the map.
+         * @return `true` if the key is inserted, `false` if it already exists.
+         */
+        template<typename u_key_t, typename function_t>
+        bool update_or_add(u_key_t &&key, function_t &&function) noexcept
+        requires(hud::is_default_constructible_v<value_type>)
+        {
+            const u64 hash {hash_of(key)};
+            shard_type &shard {shard_of(hash)};
+            details::concurrent_hashmap::unique_lock_guard guard {shard.lock};
+            auto it {shard.map.find_with_hash(key, hash)};
+            const bool is_added {it == shard.map.end()};
+            if (is_added)
+            {
+                it = shard.map.add_with_hash(hud::forward<u_key_t>(key), value_type {}, hash);
+            }
+            function(it->value());
+            return is_added;
+        }
+
+        /**
+         * Removes an element by key if it exists.
+         * @tparam K Type of the key to search for. See `hud::hashmap::find`.
+         * @param key The key to remove.
+         * @return `true` if the key is removed, `false` if it does not exist.
+         */
+        template<typename K>
+        bool remove(K &&key) noexcept
+        {
+            const u64 hash {hash_of(key)};
+            shard_type &shard {shard_of(hash)};
+            details::concurrent_hashmap::unique_lock_guard guard {shard.lock};
+            const usize count_before {shard.map.count()};
+            shard.map.remove_with_hash(hud::forward<K>(key), hash);
+            return shard.map.count() != count_before;
+        }
+
+        /**
+         * Calls a function on every element of a shard while the shard is locked for reading.
+         *
+         * Shards are independent, calling this function with different shard indices from different threads
+         * visits the map in parallel. Use `for_each` to visit all shards from the current thread.
+         *
+         * @param shard_index Index of the shard, in [0, SHARD_COUNT).
+         * @param function Called with `const key_type &` and `const value_type &`. Must not access the map.
+         */
+        template<typename function_t>
+        void for_each_in_shard(const usize shard_index, function_t &&function) const noexcept
+        {
+            HUD_CHECK(shard_index < SHARD_COUNT && "Shard index out of bound");
+            const shard_type &shard {shards_[shard_index]};
+            details::concurrent_hashmap::shared_lock_guard guard {shard.lock};
+            for (const auto &element : shard.map)
+            {
+                function(element.key(), element.value());
+            }
+        }
+
+        /**
+         * Calls a function on every element of the map, shard by shard.
+         * Only one shard is locked at a time: the visit is not a snapshot of the whole map.
+         * @param function Called with `const key_type &` and `const value_type &`. Must not access the map.
+         */
+        template<typename function_t>
+        void for_each(function_t &&function) const noexcept
+        {
+            for (usize shard_index = 0; shard_index < SHARD_COUNT; shard_index++)
+            {
+                for_each_in_shard(shard_index, function);
+            }
+        }
+
+        /**
+         * Retrieves the number of elements in the map.
+         * Shards are counted one after the other, the result is only exact if the map is not modified concurrently.
+         */
+        [[nodiscard]] usize count() const noexcept
+        {
+            usize count {0};
+            for (const shard_type &shard : shards_)
+            {
+                details::concurrent_hashmap::shared_lock_guard guard {shard.lock};
+                count += shard.map.count();
+            }
+            return count;
+        }
+
+        /**
+         * Reserves memory for at least `count` elements, distributed evenly across shards.
+         * @param count The number of elements to reserve
+         */
+        void reserve(const usize count) noexcept
+        {
+            const usize count_per_shard {(count + SHARD_COUNT - 1) / SHARD_COUNT};
+            for (shard_type &shard : shards_)
+            {
+                details::concurrent_hashmap::unique_lock_guard guard {shard.lock};
+                shard.map.reserve(count_per_shard);
+            }
+        }
+
+        /** Removes all elements of the map, keeping the allocated memory. */
+        void clear() noexcept
+        {
+            for (shard_type &shard : shards_)
+            {
+                details::concurrent_hashmap::unique_lock_guard guard {shard.lock};
+                shard.map.clear();
+            }
+        }
+
+        /**
+         * Retrieves the index of the shard that contains a key.
+         * @param key The key
+         * @return The index of the shard, in [0, SHARD_COUNT).
+         */
+        template<typename K>
+        [[nodiscard]] usize shard_index_of(const K &key) const noexcept
+        {
+            return shard_index_of_hash(hash_of(key));
+        }
+
+    private:
+        /** Type of a shard. */
+        using shard_type = details::concurrent_hashmap::shard<map_type>;
+
+        /** Computes the hash of a key. The hasher is never modified after construction, all shards hash the same way. */
+        template<typename K>
+        [[nodiscard]] u64 hash_of(const K &key) const noexcept
+        {
+            return shards_[0].map.hash_of(key);
+        }
+
+        /**
+         * Retrieves the shard index of a hash from the high bits of the mixed hash.
+         * The hash is mixed first because `hud::hash_64` is the identity for integers, the high bits of small integer keys are all 0.
+         */
+        [[nodiscard]] static constexpr usize shard_index_of_hash(const u64 hash) noexcept
+        {
+            if constexpr (SHARD_COUNT == 1)
+            {
+                return 0;
+            }
+            else
+            {
+                const u64 mixed_hash {hud::hash_algorithm::wyhash::mix(hash ^ hud::hash_algorithm::wyhash::SECRET[0], hud::hash_algorithm::wyhash::SECRET[1])};
+                return static_cast<usize>(mixed_hash >> (64 - hud::bits::trailing_zeros(static_cast<u64>(SHARD_COUNT))));
+            }
+        }
+
+        /** Retrieves the shard of a hash. */
+        [[nodiscard]] shard_type &shard_of(const u64 hash) noexcept
+        {
+            return shards_[shard_index_of_hash(hash)];
+        }
+
+        /** Retrieves the shard of a hash. */
+        [[nodiscard]] const shard_type &shard_of(const u64 hash) const noexcept
+        {
+            return shards_[shard_index_of_hash(hash)];
+        }
+
+    private:
+        /** The shards. */
+        shard_type shards_[SHARD_COUNT];
+    };
+
+} // namespace hud
+
+#endif // HD_INC_CORE_CONCURRENT_HASHMAP_H
@@ -324,7 +324,10 @@ namespace hud
      * - `clear_shrink()` destroys all elements and frees memory.
      * - `rehash(max_count)` resizes the underlying table; if `max_count` is less than current capacity, nothing happens.
      * - `shrink_to_fit()` reduces the table to fit the current number of elements exactly.
+     * - `add_range(keys)` and `add_unique_range(keys)` grow the table once to insert many elements.
      * - `free_slot_before_grow()` returns the number of free slots before the next resizing.
+     * - `policy_t` sets the max load factor and the growth factor, see `hud::hashset_policy`.
+     *   The default grows at 7/8 of the slots and doubles the number of slots.
      *
      * Iterators:
      * ----------
@@ -372,14 +375,15 @@ namespace hud
         typename value_t,
         typename hasher_t = hud::hash_64<key_t>,
         typename key_equal_t = hud::equal<key_t>,
-        typename allocator_t = hud::heap_allocator>
+        typename allocator_t = hud::heap_allocator,
+        typename policy_t = hud::default_hashset_policy>
     class hashmap
-        : public details::hashset::hashset_impl<details::hashmap::hashmap_storage<key_t, value_t>, hasher_t, key_equal_t, allocator_t>
+        : public details::hashset::hashset_impl<details::hashmap::hashmap_storage<key_t, value_t>, hasher_t, key_equal_t, allocator_t, policy_t>
     {
 
     private:
         /** Alias for the base class to simplify access to its members. */
-        using super = details::hashset::hashset_impl<details::hashmap::hashmap_storage<key_t, value_t>, hasher_t, key_equal_t, allocator_t>;
+        using super = details::hashset::hashset_impl<details::hashmap::hashmap_storage<key_t, value_t>, hasher_t, key_equal_t, allocator_t, policy_t>;
 
     public:
         /** Type of the hash function. */
@@ -392,6 +396,10 @@ namespace hud
         using typename super::const_iterator;
         /**  Type of the allocator. */
         using typename super::allocator_type;
+        /** Type of the statistics returned by `stats()`. */
+        using typename super::stats_type;
+        /** Type of the statistics returned by `probe_stats()`. */
+        using typename super::probe_stats_type;
         /** Type of the storage used to store key-value pairs. */
         using storage_type = typename super::storage_type;
         /** Type of the key. */
@@ -410,6 +418,15 @@ namespace hud
          */
         explicit constexpr hashmap() noexcept = default;
 
+        /**
+         * Constructs an empty hashmap using the provided allocator.
+         * @param allocator The allocator instance to use for internal memory management.
+         */
+        constexpr explicit hashmap(const allocator_type &allocator) noexcept
+            : super {allocator}
+        {
+        }
+
         /**
          * Constructor that initializes the hash map with a list of key-value pairs.
          *
@@ -461,6 +478,42 @@ namespace hud
             }
         }
 
+        /**
+         * Constructs a hashmap and inserts the key-value pairs of a slice.
+         * The table is sized once for all pairs before inserting them. If a key is in the slice several times, the first pair is inserted.
+         *
+         * @tparam u_key_t   Type of keys in the slice.
+         * @tparam u_value_t Type of values in the slice.
+         * @param pairs      The key-value pairs to insert.
+         * @param allocator  Allocator to use for memory management (default-constructed if not provided).
+         */
+        template<typename u_key_t, typename u_value_t>
+        requires(hud::is_constructible_v<storage_type, const u_key_t &, const u_value_t &>)
+        constexpr explicit hashmap(const hud::slice<hud::pair<u_key_t, u_value_t>> &pairs, const allocator_type &allocator = allocator_type()) noexcept
+            : super(allocator)
+        {
+            add_range(pairs);
+        }
+
+        /**
+         * Constructs a hashmap and moves the key-value pairs of a vector into it.
+         * The table is sized once for all pairs before inserting them. If a key is in the vector several times, the first pair is inserted.
+         * The vector is empty after the call.
+         *
+         * @tparam u_key_t       Type of keys in the vector.
+         * @tparam u_value_t     Type of values in the vector.
+         * @tparam u_allocator_t Type of the allocator of the vector.
+         * @param pairs          The vector to move key-value pairs from.
+         * @param allocator      Allocator to use for memory management (default-constructed if not provided).
+         */
+        template<typename u_key_t, typename u_value_t, typename u_allocator_t>
+        requires(hud::is_constructible_v<storage_type, u_key_t &&, u_value_t &&>)
+        constexpr explicit hashmap(hud::vector<hud::pair<u_key_t, u_value_t>, u_allocator_t> &&pairs, const allocator_type &allocator = allocator_type()) noexcept
+            : super(allocator)
+        {
+            add_range(hud::move(pairs));
+        }
+
         /**
          * Insert a key-value pair into the hash map by coping keys and values.
          *
@@ -536,6 +589,114 @@ namespace hud
             return super::add_impl(hud::tag_piecewise_construct, hud::forward<key_tuple_t>(key_tuple), hud::forward<value_tuple_t>(value_tuple));
         }
 
+        /**
+         * Insert a key-value pair into the hash map with an already computed hash.
+         *
+         * Same as `add(key, value)` but the hash of the key is not computed.
+         * `hash` must be the value returned by `hash_of(key)`.
+         *
+         * @tparam u_key_t   Type of the key to insert (deduced from arguments).
+         * @tparam u_value_t Type of the value to insert (deduced from arguments).
+         * @param key        The key to insert.
+         * @param value      The value to insert.
+         * @param hash       The hash of the key, as returned by `hash_of(key)`.
+         * @return Iterator pointing to the inserted or existing element.
+         */
+        template<typename u_key_t = key_t, typename u_value_t = value_t>
+        constexpr iterator add_with_hash(u_key_t &&key, u_value_t &&value, const u64 hash) noexcept
+        requires(hud::is_constructible_v<storage_type, u_key_t, u_value_t>)
+        {
+            return super::add_with_hash_impl(hash, hud::forward<u_key_t>(key), hud::forward<u_value_t>(value));
+        }
+
+        /**
+         * Inserts the key-value pairs of a slice in the hash map.
+         * The table grows at most once to store all pairs, then each pair is inserted like `add(pair)`.
+         *
+         * @tparam u_key_t   Type of keys in the slice.
+         * @tparam u_value_t Type of values in the slice.
+         * @param pairs      The key-value pairs to insert.
+         */
+        template<typename u_key_t, typename u_value_t>
+        requires(hud::is_constructible_v<storage_type, const u_key_t &, const u_value_t &>)
+        constexpr void add_range(const hud::slice<hud::pair<u_key_t, u_value_t>> &pairs) noexcept
+        {
+            reserve(super::count() + pairs.count());
+            for (const hud::pair<u_key_t, u_value_t> &pair : pairs)
+            {
+                add(pair);
+            }
+        }
+
+        /**
+         * Moves the key-value pairs of a vector in the hash map.
+         * The table grows at most once to store all pairs, then each pair is moved like `add(hud::move(pair))`.
+         * The vector is empty after the call.
+         *
+         * @tparam u_key_t       Type of keys in the vector.
+         * @tparam u_value_t     Type of values in the vector.
+         * @tparam u_allocator_t Type of the allocator of the vector.
+         * @param pairs          The vector to move key-value pairs from.
+         */
+        template<typename u_key_t, typename u_value_t, typename u_allocator_t>
+        requires(hud::is_constructible_v<storage_type, u_key_t &&, u_value_t &&>)
+        constexpr void add_range(hud::vector<hud::pair<u_key_t, u_value_t>, u_allocator_t> &&pairs) noexcept
+        {
+            reserve(super::count() + pairs.count());
+            for (hud::pair<u_key_t, u_value_t> &pair : pairs)
+            {
+                add(hud::move(pair));
+            }
+            pairs.clear();
+        }
+
+        /**
+         * Inserts the key-value pairs of a slice whose keys are known to be unique and not in the hash map.
+         * The table grows at most once, then each pair is inserted in the first free slot of its probing sequence
+         * without comparing its key to the keys already inserted.
+         *
+         * Important: Keys must be unique and not in the hash map, else the hash map contains them several times.
+         * This is checked in debug only.
+         *
+         * @tparam u_key_t   Type of keys in the slice.
+         * @tparam u_value_t Type of values in the slice.
+         * @param pairs      The key-value pairs with unique keys to insert.
+         */
+        template<typename u_key_t, typename u_value_t>
+        requires(hud::is_constructible_v<storage_type, const u_key_t &, const u_value_t &>)
+        constexpr void add_unique_range(const hud::slice<hud::pair<u_key_t, u_value_t>> &pairs) noexcept
+        {
+            reserve(super::count() + pairs.count());
+            for (const hud::pair<u_key_t, u_value_t> &pair : pairs)
+            {
+                super::add_unique_impl(pair.first, pair.second);
+            }
+        }
+
+        /**
+         * Moves the key-value pairs of a vector whose keys are known to be unique and not in the hash map.
+         * Same as `add_unique_range(slice)` but pairs are moved. The vector is empty after the call.
+         *
+         * Important: Keys must be unique and not in the hash map, else the hash map contains them several times.
+         * This is checked in debug only.
+         *
+         * @tparam u_key_t       Type of keys in the vector.
+         * @tparam u_value_t     Type of values in the vector.
+         * @tparam u_allocator_t Type of the allocator of the vector.
+         * @param pairs          The vector to move key-value pairs with unique keys from.
+         */
+        template<typename u_key_t, typename u_value_t, typename u_allocator_t>
+        requires(hud::is_constructible_v<storage_type, u_key_t &&, u_value_t &&>)
+        constexpr void add_unique_range(hud::vector<hud::pair<u_key_t, u_value_t>, u_allocator_t> &&pairs) noexcept
+        {
+            reserve(super::count() + pairs.count());
+            for (hud::pair<u_key_t, u_value_t> &pair : pairs)
+            {
+                super::add_unique_impl(hud::move(pair.first), hud::move(pair.second));
+            }
+            pairs.clear();
+        }
+
         /**
          * Access or insert a value by key.
          *
@@ -600,6 +761,7 @@ namespace hud
      * @tparam hasher_t    The type of the hasher.
      * @tparam key_equal_t The type of the key equality comparator.
      * @tparam allocator_t The allocator type.
+     * @tparam policy_t The load and growth policy.
      * @param first  First hashmap to swap.
      * @param second Second hashmap to swap.
      *
@@ -610,8 +772,8 @@ namespace hud
      * hud::swap(a, b); // a now has key 3 ; b has keys 1 and 2
      * ```
      */
-    template<typename key_t, typename value_t, typename hasher_t, typename key_equal_t, typename allocator_t>
-    constexpr void swap(hashmap<key_t, value_t, hasher_t, key_equal_t, allocator_t> &first, hashmap<key_t, value_t, hasher_t, key_equal_t, allocator_t> &second) noexcept
+    template<typename key_t, typename value_t, typename hasher_t, typename key_equal_t, typename allocator_t, typename policy_t>
+    constexpr void swap(hashmap<key_t, value_t, hasher_t, key_equal_t, allocator_t, policy_t> &first, hashmap<key_t, value_t, hasher_t, key_equal_t, allocator_t, policy_t> &second) noexcept
     {
         first.swap(second);
     }
@@ -631,6 +793,7 @@ namespace hud
      * @tparam hasher_t    The type of the hasher.
      * @tparam key_equal_t The type of the key equality comparator.
      * @tparam allocator_t The allocator type.
+     * @tparam policy_t The load and growth policy.
      * @param left  First hashmap.
      * @param right Second hashmap.
      * @return `true` if both hashmaps contain the same key-value pairs; `false` otherwise.
@@ -642,8 +805,8 @@ namespace hud
      * bool are_equal = (a == b); // true
      * ```
      */
-    template<typename key_t, typename value_t, typename hasher_t, typename key_equal_t, typename allocator_t>
-    [[nodiscard]] constexpr bool operator==(const hashmap<key_t, value_t, hasher_t, key_equal_t, allocator_t> &left, const hashmap<key_t, value_t, hasher_t, key_equal_t, allocator_t> &right) noexcept
+    template<typename key_t, typename value_t, typename hasher_t, typename key_equal_t, typename allocator_t, typename policy_t>
+    [[nodiscard]] constexpr bool operator==(const hashmap<key_t, value_t, hasher_t, key_equal_t, allocator_t, policy_t> &left, const hashmap<key_t, value_t, hasher_t, key_equal_t, allocator_t, policy_t> &right) noexcept
     {
         // Map are not equal if the counts of elements differ
         if (left.count() != right.count())
@@ -653,8 +816,8 @@ namespace hud
 
         // Speed of find is dependent of the max_slot_count_
         // We want to find in the smallest max_slot_count and iterate on the bigger only once
-        const hashmap<key_t, value_t, hasher_t, key_equal_t, allocator_t> *biggest_capacity = &left;
-        const hashmap<key_t, value_t, hasher_t, key_equal_t, allocator_t> *smallest_capacity = &right;
+        const hashmap<key_t, value_t, hasher_t, key_equal_t, allocator_t, policy_t> *biggest_capacity = &left;
+        const hashmap<key_t, value_t, hasher_t, key_equal_t, allocator_t, policy_t> *smallest_capacity = &right;
         if (smallest_capacity->max_count() > biggest_capacity->max_count())
         {
             hud::swap(biggest_capacity, smallest_capacity);
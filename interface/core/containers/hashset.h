@@ -9,6 +9,7 @@
 #include "pair.h"
 #include "../hash.h"
 #include "../bits.h"
+#include "../atomics.h"
 #include "../traits/is_comparable_with_equal_operator.h"
 #include "../traits/is_trivially_copy_constructible.h"
 #include "tuple_size.h"
@@ -16,8 +17,12 @@
 #include "../traits/is_transparent.h"
 #include "../traits/conditional.h"
 #include "compressed_tuple.h"
+#include "hashset_policy.h"
+#include "vector.h"
+#include "../slice.h"
 
-#if defined(HD_SSSE3)
+#include "../simd.h"
+#if HD_SSSE3
     #include <tmmintrin.h>
 #endif
 
@@ -373,190 +378,209 @@ namespace hud
          *   - Compact metadata: Only one byte per slot is used for control info.
          *
          * Implementation details:
-         *   - hashset_impl provides two implementations of Groups:
+         *   - hashset_impl provides the following implementations of Groups:
          *       1. Portable: Works on all platforms without special CPU instructions.
          *       2. SSE2: Uses SIMD instructions (SSE2) for faster parallel comparisons
          *          of control bytes.
+         *       3. AVX2: Same as SSE2 with groups of 32 control bytes.
+         *       4. WASM SIMD128: Same as SSE2 with WebAssembly SIMD instructions.
+         *       5. NEON: Uses ARM NEON instructions on groups of 8 control bytes.
          *   - In constexpr contexts, the portable implementation is always used,
          *     because constexpr execution cannot use runtime SIMD instructions.
          *
-         * Why both implementations:
-         *   - SSE2 gives a performance boost on supported CPUs in non-constexpr code.
+         * Why all implementations:
+         *   - SIMD gives a performance boost on supported CPUs in non-constexpr code.
          *   - Portable ensures correctness and portability everywhere (constexpr,
-         *     non-SSE2 CPUs, cross-platform builds).
+         *     non-SIMD CPUs, cross-platform builds).
          */
-#if defined(HD_SSE2)
-
         /**
-         * SSE2-optimized Group for hashset_impl.
-         *
-         * A Group is a small fixed-size array of control bytes used internally
-         * to efficiently manage slots. Each byte encodes the state of a slot
-         * (empty, deleted, or occupied) and part of the hash of the stored key.
-         *
-         * This SSE2 version uses SIMD instructions to check multiple slot states
-         * in parallel for faster probing. In constexpr contexts, the portable
-         * implementation is always used instead.
+         * A mask representing active slots within a Group where each slot is represented by one bit.
+         * Used by SIMD groups that extract the most significant bit of each control byte (SSE2, AVX2, WASM SIMD128).
+         * Supports iteration, indexing, and utility functions.
+         * @tparam mask_t The unsigned integral type used to store one bit per slot
          */
-        struct sse2_group
+        template<typename mask_t>
+        struct bit_mask
         {
-            /** Number of slots per Group when using SSE2. */
-            static constexpr usize SLOT_PER_GROUP = 16;
+            /** Construct the mask. */
+            constexpr bit_mask(mask_t mask_value) noexcept
+                : mask_value_ {mask_value}
+            {
+            }
 
-            /**
-             * A mask representing active slots within the Group.
-             * Supports iteration, indexing, and utility functions.
-             */
-            struct mask
+            /** True if any slot is active (bit set). */
+            [[nodiscard]] constexpr operator bool() const noexcept
             {
-                /** Construct the mask. */
-                constexpr mask(u16 mask_value) noexcept
-                    : mask_value_ {mask_value}
-                {
-                }
+                return mask_value_ != 0;
+            }
 
-                /** True if any slot is active (bit set). */
-                [[nodiscard]] constexpr operator bool() const noexcept
-                {
-                    return mask_value_ != 0;
-                }
+            /** Returns the index of the first active slot. */
+            [[nodiscard]] constexpr u32 operator*() const noexcept
+            {
+                return this->first_non_null_index();
+            }
 
-                /** Returns the index of the first active slot. */
-                [[nodiscard]] constexpr u32 operator*() const noexcept
-                {
-                    return first_non_null_index();
-                }
+            /** Advances the mask by removing the least significant set bit. */
+            constexpr bit_mask &operator++() noexcept
+            {
+                mask_value_ &= mask_value_ - 1;
+                return *this;
+            }
 
-                /** Advances the mask by removing the least significant set bit. */
-                constexpr mask &operator++() noexcept
-                {
-                    mask_value_ &= mask_value_ - 1;
-                    return *this;
-                }
+            /** Begin iterator for range-based for loops. */
+            [[nodiscard]]
+            constexpr bit_mask begin() const noexcept
+            {
+                return *this;
+            }
 
-                /** Begin iterator for range-based for loops. */
-                [[nodiscard]]
-                constexpr mask begin() const noexcept
-                {
-                    return *this;
-                }
+            /** End iterator (empty mask) for range-based for loops. */
+            [[nodiscard]]
+            constexpr bit_mask end() const noexcept
+            {
+                return bit_mask(0);
+            };
 
-                /** End iterator (empty mask) for range-based for loops. */
-                [[nodiscard]]
-                constexpr mask end() const noexcept
-                {
-                    return mask(0);
-                };
+            /** Equality comparison. */
+            [[nodiscard]]
+            friend constexpr bool operator==(const bit_mask &a, const bit_mask &b) noexcept
+            {
+                return a.mask_value_ == b.mask_value_;
+            }
 
-                /** Equality comparison. */
-                [[nodiscard]]
-                friend constexpr bool operator==(const mask &a, const mask &b) noexcept
-                {
-                    return a.mask_value_ == b.mask_value_;
-                }
+            /** Inequality comparison. */
+            [[nodiscard]]
+            friend constexpr bool operator!=(const bit_mask &a, const bit_mask &b) noexcept
+            {
+                return !(a == b);
+            }
 
-                /** Inequality comparison. */
-                [[nodiscard]]
-                friend constexpr bool operator!=(const mask &a, const mask &b) noexcept
-                {
-                    return !(a == b);
-                }
+            /** Index of the first active slot (least significant set bit). */
+            [[nodiscard]] constexpr u32 first_non_null_index() const noexcept
+            {
+                // Get number of trailing zero to get the insert offset of the byte
+                return hud::bits::trailing_zeros(mask_value_);
+            }
 
-                /** Index of the first active slot (least significant set bit). */
-                [[nodiscard]] constexpr u32 first_non_null_index() const noexcept
-                {
-                    // Get number of trailing zero to get the insert offset of the byte
-                    return hud::bits::trailing_zeros(mask_value_);
-                }
+            /** Convert mask to underlying value. */
+            [[nodiscard]]
+            constexpr operator mask_t() const noexcept
+            {
+                return mask_value_;
+            }
 
-                /** Convert mask to underlying 16-bit value. */
-                [[nodiscard]]
-                constexpr operator u16() const noexcept
-                {
-                    return mask_value_;
-                }
+        protected:
+            /**
+             * The underlying bitmask representing active slots within a Group.
+             * Each bit corresponds to a slot:
+             *   - 1 indicates the slot is active/matches the condition of the mask.
+             *   - 0 indicates the slot is inactive.
+             *
+             * This value is manipulated by mask operators (++, *, bool conversion)
+             * to iterate over active slots efficiently.
+             */
+            mask_t mask_value_;
+        };
 
-            protected:
-                /**
-                 * The underlying 16-bit bitmask representing active slots within a Group.
-                 * Each bit corresponds to a slot:
-                 *   - 1 indicates the slot is active/matches the condition of the mask.
-                 *   - 0 indicates the slot is inactive.
-                 *
-                 * This value is manipulated by mask operators (++, *, bool conversion)
-                 * to iterate over active slots efficiently.
-                 */
-                u16 mask_value_;
-            };
+        /** Mask specialized for empty slots. */
+        template<typename mask_t>
+        struct bit_empty_mask
+            : bit_mask<mask_t>
+        {
+            using bit_mask<mask_t>::bit_mask;
 
-            /** Mask specialized for empty slots. */
-            struct empty_mask
-                : mask
+            /** True if there is any empty slot. */
+            [[nodiscard]] constexpr bool has_empty_slot() const noexcept
             {
-                using mask::mask;
+                return *this;
+            }
 
-                /** True if there is any empty slot. */
-                [[nodiscard]] constexpr bool has_empty_slot() const noexcept
-                {
-                    return *this;
-                }
+            /** Index of the first empty slot. */
+            [[nodiscard]] constexpr u32 first_empty_index() const noexcept
+            {
+                return this->first_non_null_index();
+            }
 
-                /** Index of the first empty slot. */
-                [[nodiscard]] constexpr u32 first_empty_index() const noexcept
-                {
-                    return first_non_null_index();
-                }
+            /** Count trailing zeros in the mask. */
+            [[nodiscard]] constexpr u32 trailing_zeros() const noexcept
+            {
+                return hud::bits::trailing_zeros(this->mask_value_);
+            }
 
-                /** Count trailing zeros in the mask. */
-                [[nodiscard]] constexpr u32 trailing_zeros() const noexcept
-                {
-                    return hud::bits::trailing_zeros(mask_value_);
-                }
+            /** Count leading zeros in the mask. */
+            [[nodiscard]] constexpr u32 leading_zeros() const noexcept
+            {
+                return hud::bits::leading_zeros(this->mask_value_);
+            }
+        };
 
-                /** Count leading zeros in the mask. */
-                [[nodiscard]] constexpr u32 leading_zeros() const noexcept
-                {
-                    return hud::bits::leading_zeros(mask_value_);
-                }
-            };
+        /** Mask specialized for empty or deleted slots. */
+        template<typename mask_t>
+        struct bit_empty_or_deleted_mask
+            : bit_mask<mask_t>
+        {
+            using bit_mask<mask_t>::bit_mask;
 
-            /** Mask specialized for empty or deleted slots. */
-            struct empty_or_deleted_mask
-                : mask
+            /** True if there is any empty or deleted slot. */
+            [[nodiscard]] constexpr bool has_empty_or_deleted_slot() const noexcept
             {
-                using mask::mask;
+                return *this;
+            }
 
-                /** True if there is any empty or deleted slot. */
-                [[nodiscard]] constexpr bool has_empty_or_deleted_slot() const noexcept
-                {
-                    return *this;
-                }
+            /** Index of the first empty or deleted slot. */
+            [[nodiscard]] constexpr u32 first_empty_or_deleted_index() const noexcept
+            {
+                return this->first_non_null_index();
+            }
+        };
 
-                /** Index of the first empty or deleted slot. */
-                [[nodiscard]] constexpr u32 first_empty_or_deleted_index() const noexcept
-                {
-                    return first_non_null_index();
-                }
-            };
+        /** Mask specialized for full (occupied) slots. */
+        template<typename mask_t>
+        struct bit_full_mask
+            : bit_mask<mask_t>
+        {
+            using bit_mask<mask_t>::bit_mask;
 
-            /** Mask specialized for full (occupied) slots. */
-            struct full_mask
-                : mask
+            /** True if there is any occupied slot. */
+            [[nodiscard]] constexpr bool has_full_slot() const noexcept
             {
-                using mask::mask;
+                return *this;
+            }
 
-                /** True if there is any occupied slot. */
-                [[nodiscard]] constexpr bool has_full_slot() const noexcept
-                {
-                    return *this;
-                }
+            /** Index of the first occupied slot. */
+            [[nodiscard]] constexpr u32 first_full_index() const noexcept
+            {
+                return this->first_non_null_index();
+            }
+        };
 
-                /** Index of the first occupied slot. */
-                [[nodiscard]] constexpr u32 first_full_index() const noexcept
-                {
-                    return first_non_null_index();
-                }
-            };
+
+#if HD_SSE2
+
+        /**
+         * SSE2-optimized Group for hashset_impl.
+         *
+         * A Group is a small fixed-size array of control bytes used internally
+         * to efficiently manage slots. Each byte encodes the state of a slot
+         * (empty, deleted, or occupied) and part of the hash of the stored key.
+         *
+         * This SSE2 version uses SIMD instructions to check multiple slot states
+         * in parallel for faster probing. In constexpr contexts, the portable
+         * implementation is always used instead.
+         */
+        struct sse2_group
+        {
+            /** Number of slots per Group when using SSE2. */
+            static constexpr usize SLOT_PER_GROUP = 16;
+
+            /** Mask of slots, one bit per slot. */
+            using mask = bit_mask<u16>;
+            /** Mask specialized for empty slots. */
+            using empty_mask = bit_empty_mask<u16>;
+            /** Mask specialized for empty or deleted slots. */
+            using empty_or_deleted_mask = bit_empty_or_deleted_mask<u16>;
+            /** Mask specialized for full (occupied) slots. */
+            using full_mask = bit_full_mask<u16>;
 
             /**
              * Load a 16-byte control array into the group.
@@ -590,7 +614,7 @@ namespace hud
              */
             empty_mask mask_of_empty_slot() const noexcept
             {
-    #if defined(HD_SSSE3)
+    #if HD_SSSE3
                 return _mm_movemask_epi8(_mm_sign_epi8(value_, value_));
     #else
                 __m128i match = _mm_set1_epi8(static_cast<char>(empty_byte));
@@ -638,6 +662,156 @@ namespace hud
         };
 #endif
 
+#if HD_AVX2
+        /**
+         * AVX2-optimized Group for hashset_impl.
+         *
+         * Same as `sse2_group` with 32 control bytes per group.
+         * A wider group scan more slots per probe, this reduce the count of probes
+         * when the table has a high load factor or long probe sequences.
+         */
+        struct avx2_group
+        {
+            /** Number of slots per Group when using AVX2. */
+            static constexpr usize SLOT_PER_GROUP = 32;
+
+            /** Mask of slots, one bit per slot. */
+            using mask = bit_mask<u32>;
+            /** Mask specialized for empty slots. */
+            using empty_mask = bit_empty_mask<u32>;
+            /** Mask specialized for empty or deleted slots. */
+            using empty_or_deleted_mask = bit_empty_or_deleted_mask<u32>;
+            /** Mask specialized for full (occupied) slots. */
+            using full_mask = bit_full_mask<u32>;
+
+            /**
+             * Load a 32-byte control array into the group.
+             * @param control Pointer to the control bytes.
+             */
+            avx2_group(const control_type *control) noexcept
+                : value_(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(control)))
+            {
+            }
+
+            /**
+             * Returns a mask where bits corresponding to slots matching the given h2_hash are set to 1,
+             * and all other bits are cleared to 0.
+             *
+             * @param h2_hash The hash fragment to match.
+             */
+            mask match(u8 h2_hash) const noexcept
+            {
+                __m256i match = _mm256_set1_epi8(static_cast<char>(h2_hash));
+                return mask(static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(match, value_))));
+            }
+
+            /** Returns a mask representing empty slots in the group. */
+            empty_mask mask_of_empty_slot() const noexcept
+            {
+                // sign(x, x) keeps the most significant bit only for empty_byte (-128)
+                return static_cast<u32>(_mm256_movemask_epi8(_mm256_sign_epi8(value_, value_)));
+            }
+
+            /** Returns a mask representing empty or deleted slots in the group. */
+            empty_or_deleted_mask mask_of_empty_or_deleted_slot() const noexcept
+            {
+                __m256i special = _mm256_set1_epi8(static_cast<char>(sentinel_byte));
+                return static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(special, value_)));
+            }
+
+            /** Returns a mask representing full (occupied) slots in the group. */
+            full_mask mask_of_full_slot() const noexcept
+            {
+                return static_cast<u32>(_mm256_movemask_epi8(value_)) ^ 0xFFFFFFFFu;
+            }
+
+            /** Counts the number of leading empty or deleted slots in the group. */
+            u32 count_leading_empty_or_deleted() const noexcept
+            {
+                __m256i special = _mm256_set1_epi8(static_cast<char>(sentinel_byte));
+                // Add 1 in 64 bits to not overflow when all slots are empty or deleted
+                u64 mask = static_cast<u64>(static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(special, value_)))) + 1;
+                return static_cast<u32>(hud::bits::trailing_zeros(mask));
+            }
+
+        private:
+            /** The 32-byte value representing the group of slots. */
+            __m256i value_;
+        };
+#endif
+
+#if HD_WASM_SIMD128
+        /**
+         * WebAssembly SIMD128-optimized Group for hashset_impl.
+         *
+         * Same as `sse2_group` with WebAssembly SIMD instructions.
+         * Not selected as `group_type` until it has been built and tested on a WebAssembly target.
+         */
+        struct wasm_simd128_group
+        {
+            /** Number of slots per Group when using WebAssembly SIMD128. */
+            static constexpr usize SLOT_PER_GROUP = 16;
+
+            /** Mask of slots, one bit per slot. */
+            using mask = bit_mask<u16>;
+            /** Mask specialized for empty slots. */
+            using empty_mask = bit_empty_mask<u16>;
+            /** Mask specialized for empty or deleted slots. */
+            using empty_or_deleted_mask = bit_empty_or_deleted_mask<u16>;
+            /** Mask specialized for full (occupied) slots. */
+            using full_mask = bit_full_mask<u16>;
+
+            /**
+             * Load a 16-byte control array into the group.
+             * @param control Pointer to the control bytes.
+             */
+            wasm_simd128_group(const control_type *control) noexcept
+                : value_(wasm_v128_load(control))
+            {
+            }
+
+            /**
+             * Returns a mask where bits corresponding to slots matching the given h2_hash are set to 1,
+             * and all other bits are cleared to 0.
+             *
+             * @param h2_hash The hash fragment to match.
+             */
+            mask match(u8 h2_hash) const noexcept
+            {
+                return mask(static_cast<u16>(wasm_i8x16_bitmask(wasm_i8x16_eq(wasm_i8x16_splat(static_cast<i8>(h2_hash)), value_))));
+            }
+
+            /** Returns a mask representing empty slots in the group. */
+            empty_mask mask_of_empty_slot() const noexcept
+            {
+                return static_cast<u16>(wasm_i8x16_bitmask(wasm_i8x16_eq(wasm_i8x16_splat(empty_byte), value_)));
+            }
+
+            /** Returns a mask representing empty or deleted slots in the group. */
+            empty_or_deleted_mask mask_of_empty_or_deleted_slot() const noexcept
+            {
+                return static_cast<u16>(wasm_i8x16_bitmask(wasm_i8x16_gt(wasm_i8x16_splat(sentinel_byte), value_)));
+            }
+
+            /** Returns a mask representing full (occupied) slots in the group. */
+            full_mask mask_of_full_slot() const noexcept
+            {
+                return static_cast<u16>(wasm_i8x16_bitmask(value_) ^ 0xFFFF);
+            }
+
+            /** Counts the number of leading empty or deleted slots in the group. */
+            u32 count_leading_empty_or_deleted() const noexcept
+            {
+                u32 mask = static_cast<u32>(wasm_i8x16_bitmask(wasm_i8x16_gt(wasm_i8x16_splat(sentinel_byte), value_))) + 1;
+                return hud::bits::trailing_zeros(mask);
+            }
+
+        private:
+            /** The 16-byte value representing the group of slots. */
+            v128_t value_;
+        };
+#endif
+
         struct portable_group
         {
             /** Number of slots per Group in the portable implementation. */
@@ -916,27 +1090,112 @@ namespace hud
                 return (value_ ^ 0x8080808080808080UL) & 0x8080808080808080UL;
             }
 
-            /**
-             * Counts the number of leading empty or deleted slots in the group.
-             *
-             * Uses the MSB of each byte to determine which slots are empty or deleted.
-             *
-             * Returns the number of consecutive empty/deleted slots starting from the first slot.
-             */
-            constexpr u32 count_leading_empty_or_deleted() const noexcept
+            /**
+             * Counts the number of leading empty or deleted slots in the group.
+             *
+             * Uses the MSB of each byte to determine which slots are empty or deleted.
+             *
+             * Returns the number of consecutive empty/deleted slots starting from the first slot.
+             */
+            constexpr u32 count_leading_empty_or_deleted() const noexcept
+            {
+                // ctrl | ~(ctrl >> 7) will have the lowest bit set to zero for kEmpty and
+                // kDeleted. We lower all other bits and count number of trailing zeros.
+                constexpr uint64_t bits {0x0101010101010101ULL};
+                return static_cast<u32>(hud::bits::trailing_zeros((value_ | ~(value_ >> 7)) & bits) >> 3);
+            }
+
+        private:
+            /** The 8 bytes value of the group. */
+            u64 value_;
+        };
+
+#if HD_NEON
+        /**
+         * ARM NEON-optimized Group for hashset_impl.
+         *
+         * Groups have 8 control bytes like `portable_group` and produce the same masks (0x80 per matching slot),
+         * comparisons of the 8 control bytes are done with a single NEON instruction.
+         * Not selected as `group_type` until it has been built and tested on an ARM target.
+         */
+        struct neon_group
+        {
+            /** Number of slots per Group when using NEON. */
+            static constexpr usize SLOT_PER_GROUP = 8;
+
+            /** Mask of slots, 0x80 per slot. */
+            using mask = portable_group::mask;
+            /** Mask specialized for empty slots. */
+            using empty_mask = portable_group::empty_mask;
+            /** Mask specialized for empty or deleted slots. */
+            using empty_or_deleted_mask = portable_group::empty_or_deleted_mask;
+            /** Mask specialized for full (occupied) slots. */
+            using full_mask = portable_group::full_mask;
+
+            /** Load 8 bytes of control values into the group. */
+            neon_group(const control_type *control) noexcept
+                : value_(vld1_s8(control))
+            {
+            }
+
+            /**
+             * Returns a mask where slots whose control byte matches the given h2_hash
+             * have their MSB (0x80) set, and all other slots are cleared (0x00).
+             *
+             * @param h2_hash The hash fragment to match against each slot's control byte.
+             */
+            mask match(u8 h2_hash) const noexcept
+            {
+                return mask(to_mask(vceq_s8(vdup_n_s8(static_cast<i8>(h2_hash)), value_)));
+            }
+
+            /** Returns a mask where empty slots have their MSB (0x80) set and all other slots cleared (0x00). */
+            empty_mask mask_of_empty_slot() const noexcept
+            {
+                return to_mask(vceq_s8(vdup_n_s8(empty_byte), value_));
+            }
+
+            /** Returns a mask where empty or deleted slots have their MSB (0x80) set and all other slots cleared (0x00). */
+            empty_or_deleted_mask mask_of_empty_or_deleted_slot() const noexcept
+            {
+                return to_mask(vcgt_s8(vdup_n_s8(sentinel_byte), value_));
+            }
+
+            /** Returns a mask where full (occupied) slots have their MSB (0x80) set and all other slots cleared (0x00). */
+            full_mask mask_of_full_slot() const noexcept
+            {
+                return to_mask(vcge_s8(value_, vdup_n_s8(0)));
+            }
+
+            /** Counts the number of leading empty or deleted slots in the group. */
+            u32 count_leading_empty_or_deleted() const noexcept
             {
-                // ctrl | ~(ctrl >> 7) will have the lowest bit set to zero for kEmpty and
-                // kDeleted. We lower all other bits and count number of trailing zeros.
-                constexpr uint64_t bits {0x0101010101010101ULL};
-                return static_cast<u32>(hud::bits::trailing_zeros((value_ | ~(value_ >> 7)) & bits) >> 3);
+                // Set 0x80 on slots that are not empty or deleted, trailing zeros of 0 is 64, this gives 8 slots
+                const u64 not_empty_or_deleted = ~to_mask(vcgt_s8(vdup_n_s8(sentinel_byte), value_)) & 0x8080808080808080ULL;
+                return static_cast<u32>(hud::bits::trailing_zeros(not_empty_or_deleted) >> 3);
+            }
+
+        private:
+            /** Convert a NEON comparison result (0xFF per matching byte) to a portable mask (0x80 per matching byte). */
+            [[nodiscard]] static u64 to_mask(uint8x8_t comparison) noexcept
+            {
+                return vget_lane_u64(vreinterpret_u64_u8(comparison), 0) & 0x8080808080808080ULL;
             }
 
         private:
             /** The 8 bytes value of the group. */
-            u64 value_;
+            int8x8_t value_;
         };
+#endif
 
-#if defined(HD_SSE2)
+#if HD_AVX2
+        /**
+         * Type of group used to iterate over the control bytes in a hashset_impl.
+         *
+         * - On AVX2-enabled platforms, `avx2_group` is used to compare 32 control bytes at once.
+         */
+        using group_type = avx2_group;
+#elif HD_SSE2
         /**
          * Type of group used to iterate over the control bytes in a hashset_impl.
          *
@@ -960,8 +1219,8 @@ namespace hud
          * - In `consteval` (compile-time) contexts, always returns the value from
          *   `portable_group`, because SIMD instructions cannot be used in constexpr.
          * - In runtime contexts, returns the value from `group_type`, which may be
-         *   `sse2_group` on SSE2-enabled platforms for faster iteration, or
-         *   `portable_group` otherwise.
+         *   a SIMD group (`avx2_group`, `sse2_group`, ...) on platforms that support it
+         *   for faster iteration, or `portable_group` otherwise.
          *
          * This allows code to generically query the group size while remaining
          * constexpr-friendly and platform-optimized.
@@ -986,7 +1245,8 @@ namespace hud
          * - Each entry is a `control_type` representing the state of a slot:
          *     - `0` (first 16 entries) : reserved / unused padding
          *     - `sentinel_byte` (index 16) : marks the "end" of the valid slots
-         *     - `empty_byte` (indices 17–31) : indicates empty slots ready for insertion
+         *     - `empty_byte` (indices 17–47) : indicates empty slots ready for insertion
+         *       There is enough empty slots after the sentinel to load the widest group (32 bytes with AVX2).
          *
          * This array provides a known initial state for all groups, allowing the
          * hashset to safely iterate and insert elements without undefined behavior.
@@ -998,7 +1258,7 @@ namespace hud
          *
          * Using `alignas(16)` ensures proper alignment for SSE2 vectorized operations.
          */
-        alignas(16) constexpr const control_type INIT_GROUP[32] {
+        alignas(16) constexpr const control_type INIT_GROUP[48] {
             control_type {0}, // 0
             control_type {0},
             control_type {0},
@@ -1030,7 +1290,23 @@ namespace hud
             empty_byte, // 28
             empty_byte,
             empty_byte,
-            empty_byte, // 31
+            empty_byte,
+            empty_byte, // 32
+            empty_byte,
+            empty_byte,
+            empty_byte,
+            empty_byte, // 36
+            empty_byte,
+            empty_byte,
+            empty_byte,
+            empty_byte, // 40
+            empty_byte,
+            empty_byte,
+            empty_byte,
+            empty_byte, // 44
+            empty_byte,
+            empty_byte,
+            empty_byte, // 47
         };
 
         /**
@@ -1057,10 +1333,12 @@ namespace hud
              */
             static constexpr void set(control_type *control_ptr, usize slot_index, control_type value, usize max_slot_count) noexcept
             {
-                constexpr usize COUNT_CLONED_BYTE {SLOT_PER_GROUP() - 1};
+                // Not stored in a constant: its initializer would always be constant-evaluated and use the portable group width
+                // instead of the width of the group used at runtime, leaving the last cloned bytes of wider groups empty
+                usize count_cloned_byte {SLOT_PER_GROUP() - 1};
                 // Save the h2 in the slot and also in the cloned byte
                 control_ptr[slot_index] = value;
-                control_ptr[((slot_index - COUNT_CLONED_BYTE) & max_slot_count) + (COUNT_CLONED_BYTE & max_slot_count)] = value;
+                control_ptr[((slot_index - count_cloned_byte) & max_slot_count) + (count_cloned_byte & max_slot_count)] = value;
             }
 
             /**
@@ -1277,7 +1555,8 @@ namespace hud
                 typename storage_t,
                 typename hasher_t,
                 typename key_equal_t,
-                typename allocator_t>
+                typename allocator_t,
+                typename policy_t>
             friend class hashset_impl;
 
             /** Pointer to the current control byte being iterated. */
@@ -1286,6 +1565,54 @@ namespace hud
             slot_type *slot_ptr_;
         };
 
+        /**
+         * Statistics of a hashset returned by `hashset_impl::stats()`.
+         * Every value is maintained by the hashset, computing them is O(1).
+         *
+         * Probe counters are maintained only if `HD_HASHSET_INSTRUMENTATION` is defined. Each hashset then counts its lookups, insertions
+         * and the groups they scan. The counters change the layout of the hashset, the macro must be defined for the whole program.
+         * They are updated with relaxed atomics so concurrent const lookups can count without a data race, they are meant for diagnostic builds only.
+         */
+        struct hashset_stats
+        {
+            /** Number of elements. */
+            usize count {0};
+            /** Number of slots. */
+            usize max_count {0};
+            /** Number of deleted slots (tombstones). */
+            usize deleted_count {0};
+            /** Ratio of slots that contain an element. */
+            f32 load_factor {0.0f};
+            /** Ratio of slots that contain an element or a deleted slot. Reaching the max load factor triggers a rehash. */
+            f32 used_load_factor {0.0f};
+            /** Number of bytes allocated for the control bytes and the slots. Memory owned by the elements is not included. */
+            usize allocation_size {0};
+            /** Number of lookups and insertions since the last `reset_probe_counters()`. Always 0 if `HD_HASHSET_INSTRUMENTATION` is not defined. */
+            u64 probe_operation_count {0};
+            /** Number of groups scanned by these lookups and insertions. Always 0 if `HD_HASHSET_INSTRUMENTATION` is not defined. */
+            u64 probe_group_count {0};
+        };
+
+        /**
+         * Probe lengths of the elements of a hashset returned by `hashset_impl::probe_stats()`.
+         *
+         * The probe length of an element is the number of groups scanned by a lookup of its key,
+         * 1 means the element is in the first group probed. A high average probe length or a long
+         * tail in the histogram means the hash function clusters keys or the table contains too many deleted slots.
+         */
+        struct hashset_probe_stats
+        {
+            /** Number of entries in `probe_length_histogram`. */
+            static constexpr usize PROBE_LENGTH_HISTOGRAM_SIZE = 8;
+
+            /** Greatest number of groups scanned to find an element. */
+            usize max_probe_length {0};
+            /** Average number of groups scanned to find an element. */
+            f32 average_probe_length {0.0f};
+            /** Number of elements found by scanning 1, 2, ... groups. The last entry also counts elements found after more groups. */
+            usize probe_length_histogram[PROBE_LENGTH_HISTOGRAM_SIZE] {};
+        };
+
         /**
          * A hash set implementation.
          *
@@ -1305,12 +1632,14 @@ namespace hud
          * @tparam hasher_t Type of the hash function.
          * @tparam key_equal_t Type of the equality comparator.
          * @tparam allocator_t Type of the allocator.
+         * @tparam policy_t Max load factor and growth factor of the table. See `hud::hashset_policy`.
          */
         template<
             typename storage_t,
             typename hasher_t,
             typename key_equal_t,
-            typename allocator_t>
+            typename allocator_t,
+            typename policy_t>
         class hashset_impl
         {
         protected:
@@ -1332,6 +1661,10 @@ namespace hud
             using allocator_type = allocator_t;
             /** The type of allocation done by the allocator. */
             using memory_allocation_type = typename allocator_type::template memory_allocation_type<slot_type>;
+            /** Type of the statistics returned by `stats()`. */
+            using stats_type = hud::details::hashset::hashset_stats;
+            /** Type of the statistics returned by `probe_stats()`. */
+            using probe_stats_type = hud::details::hashset::hashset_probe_stats;
 
             static_assert(hud::is_hashable_64_v<key_type>, "key_type is not hashable");
             static_assert(hud::is_comparable_with_equal_v<key_type, key_type>, "key_type is not comparable with equal");
@@ -1344,10 +1677,15 @@ namespace hud
             static constexpr bool is_hashable_and_comparable_v = hud::conjunction_v<hud::is_hashable_64<key_type, K>, hud::is_comparable_with_equal<key_type, K>>;
 
             /** Friend with other hashset_impl of other types. */
-            template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t>
+            template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t, typename u_policy_t>
             friend class hashset_impl;
 
         public:
+            /** Minimum number of elements for which `reserve_parallel()` relocates the elements with the executor. */
+            static constexpr usize PARALLEL_RESIZE_MIN_COUNT {usize {1} << 16};
+            /** Number of slots of the old control array relocated by one task of `reserve_parallel()`. */
+            static constexpr usize PARALLEL_RESIZE_SLOT_PER_TASK {usize {1} << 14};
+
             /**  Default constructor. */
             explicit constexpr hashset_impl() noexcept = default;
 
@@ -1382,7 +1720,7 @@ namespace hud
              * @param other The other array to move
              */
             template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t>
-            constexpr explicit hashset_impl(const hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t> &other) noexcept
+            constexpr explicit hashset_impl(const hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t> &other) noexcept
                 : hashset_impl(other, other.allocator())
             {
             }
@@ -1399,7 +1737,7 @@ namespace hud
              * @param allocator The allocator to use for this hashset_impl.
              */
             template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t>
-            constexpr explicit hashset_impl(const hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t> &other, const allocator_type &allocator) noexcept
+            constexpr explicit hashset_impl(const hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t> &other, const allocator_type &allocator) noexcept
                 : max_slot_count_ {other.max_count()}
                 , count_ {other.count()}
                 , compressed_ {hud::tag_piecewise_construct, hud::forward_as_tuple(allocator), hud::forward_as_tuple(), hud::forward_as_tuple(), hud::forward_as_tuple(other.free_slot_before_grow_compressed())}
@@ -1419,7 +1757,7 @@ namespace hud
              * @param extra_max_count Optional extra slots to allocate beyond other.max_count().
              */
             template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t>
-            constexpr explicit hashset_impl(const hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t> &other, usize extra_max_count) noexcept
+            constexpr explicit hashset_impl(const hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t> &other, usize extra_max_count) noexcept
                 : hashset_impl {other, extra_max_count, other.allocator()}
             {
             }
@@ -1436,7 +1774,7 @@ namespace hud
              * @param extra_max_count Optional extra slots to allocate beyond other.max_count().
              */
             template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t>
-            constexpr explicit hashset_impl(const hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t> &other, usize extra_max_count, const allocator_type &allocator) noexcept
+            constexpr explicit hashset_impl(const hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t> &other, usize extra_max_count, const allocator_type &allocator) noexcept
                 : max_slot_count_ {normalize_max_count(other.max_count() + extra_max_count)}
                 , count_ {other.count()}
                 , compressed_(hud::tag_piecewise_construct, hud::forward_as_tuple(allocator), hud::forward_as_tuple(), hud::forward_as_tuple(), hud::forward_as_tuple(max_slot_before_grow(max_slot_count_) - count_))
@@ -1456,7 +1794,7 @@ namespace hud
              * @param other The other hashset_impl to move from.
              */
             template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t>
-            constexpr explicit hashset_impl(hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t> &&other) noexcept
+            constexpr explicit hashset_impl(hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t> &&other) noexcept
                 : hashset_impl(hud::move(other), other.allocator())
             {
             }
@@ -1473,12 +1811,12 @@ namespace hud
              * @param other The other hashset_impl to move from.
              */
             template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t>
-            constexpr explicit hashset_impl(hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t> &&other, const allocator_type &allocator) noexcept
+            constexpr explicit hashset_impl(hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t> &&other, const allocator_type &allocator) noexcept
                 : max_slot_count_ {other.max_count()}
                 , count_ {other.count()}
                 , compressed_(hud::tag_piecewise_construct, hud::forward_as_tuple(allocator), hud::forward_as_tuple(), hud::forward_as_tuple(), hud::forward_as_tuple(other.free_slot_before_grow_compressed()))
             {
-                move_construct(hud::forward<hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t>>(other));
+                move_construct(hud::forward<hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t>>(other));
             }
 
             /**
@@ -1494,7 +1832,7 @@ namespace hud
              * @param other The other hashset_impl to move from.
              */
             template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t>
-            constexpr explicit hashset_impl(hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t> &&other, usize extra_max_count) noexcept
+            constexpr explicit hashset_impl(hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t> &&other, usize extra_max_count) noexcept
                 : hashset_impl {hud::move(other), extra_max_count, other.allocator()}
             {
             }
@@ -1511,12 +1849,12 @@ namespace hud
              * @param other The other hashset_impl to move from.
              */
             template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t>
-            constexpr explicit hashset_impl(hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t> &&other, usize extra_max_count, const allocator_type &allocator) noexcept
+            constexpr explicit hashset_impl(hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t> &&other, usize extra_max_count, const allocator_type &allocator) noexcept
                 : max_slot_count_ {normalize_max_count(other.max_count() + extra_max_count)}
                 , count_ {other.count()}
                 , compressed_(hud::tag_piecewise_construct, hud::forward_as_tuple(allocator), hud::forward_as_tuple(), hud::forward_as_tuple(), hud::forward_as_tuple(max_slot_before_grow(max_slot_count_) - count_))
             {
-                move_construct(hud::forward<hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t>>(other), extra_max_count);
+                move_construct(hud::forward<hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t>>(other), extra_max_count);
             }
 
             /**
@@ -1563,8 +1901,8 @@ namespace hud
              * @return *this
              */
             template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t>
-            requires(hud::is_copy_constructible_v<slot_type, typename hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t>::slot_type>)
-            constexpr hashset_impl &operator=(const hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t> &other) noexcept
+            requires(hud::is_copy_constructible_v<slot_type, typename hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t>::slot_type>)
+            constexpr hashset_impl &operator=(const hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t> &other) noexcept
             {
                 copy_assign(other);
                 return *this;
@@ -1601,10 +1939,10 @@ namespace hud
              * @param other The other hashset_impl to move
              */
             template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t>
-            requires(hud::is_move_constructible_v<slot_type, typename hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t>::slot_type>)
-            constexpr hashset_impl &operator=(hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t> &&other) noexcept
+            requires(hud::is_move_constructible_v<slot_type, typename hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t>::slot_type>)
+            constexpr hashset_impl &operator=(hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t> &&other) noexcept
             {
-                move_assign(hud::forward<hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t>>(other));
+                move_assign(hud::forward<hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t>>(other));
                 return *this;
             }
 
@@ -1625,6 +1963,41 @@ namespace hud
                 }
             }
 
+            /**
+             * Ensures that the hashset has enough capacity to store at least `count` elements, relocating the elements concurrently.
+             *
+             * Behaves like `reserve()`, but the old control array is partitioned in ranges of `PARALLEL_RESIZE_SLOT_PER_TASK` slots
+             * and the elements of each range are reinserted into the new table by a separate task.
+             * Tasks claim the slots of the new table with an atomic compare-and-set of their control byte and need no other synchronization.
+             *
+             * The hashset does not own threads: `executor(task_count, task)` must call `task(task_index)` once for each `task_index`
+             * in [0, task_count), on any number of threads, and return when all tasks are done.
+             * Elements are hashed and moved concurrently, this is safe as long as the hasher and the move constructor of different elements are.
+             *
+             * If the hashset contains less than `min_parallel_count` elements, the elements are relocated by the calling thread like `reserve()`
+             * and the executor is not called.
+             *
+             * @param count Minimum number of elements the hashset should be able to store.
+             * @param executor The callable that runs the relocation tasks.
+             * @param min_parallel_count Minimum number of elements to relocate them with the executor.
+             */
+            template<typename executor_t>
+            void reserve_parallel(usize count, executor_t &&executor, usize min_parallel_count = PARALLEL_RESIZE_MIN_COUNT) noexcept
+            {
+                const usize max_count = normalize_max_count(min_capacity_for_count(count));
+                if (max_count > max_slot_count_)
+                {
+                    if (count_ > 0 && count_ >= min_parallel_count)
+                    {
+                        resize_parallel(max_count, executor);
+                    }
+                    else
+                    {
+                        resize(max_count);
+                    }
+                }
+            }
+
             /**
              * Removes all elements from the hashset, calling the destructor of each element
              * if they are not trivially destructible, but retains the allocated memory for reuse.
@@ -1641,6 +2014,7 @@ namespace hud
                     hud::memory::set_memory(control_ptr_, control_size_for_max_count(max_slot_count_), empty_byte);
                     control_ptr_[max_slot_count_] = sentinel_byte;
                     count_ = 0;
+                    deleted_count_ = 0;
                 }
             }
 
@@ -1846,6 +2220,180 @@ namespace hud
                 return const_cast<hashset_impl *>(this)->contains(hud::forward<K>(key));
             }
 
+            /**
+             * Finds a batch of keys.
+             *
+             * Calling `find` in a loop serializes the cache misses of each lookup: the hash is computed, then the control group
+             * is loaded, then the slot. `find_batch` hashes the keys by batch and prefetches their control group and slot before
+             * resolving them, so the misses of independent keys overlap. This is faster than `find` when the hashset does not fit in the cache.
+             *
+             * Like `find`, `K` can be any type the `hasher_type` and `key_equal_type` accept. See `find` for details.
+             *
+             * @tparam K Type of the keys to search for.
+             * @param keys The keys to search for.
+             * @param results Receives for each key an iterator to the element found, or the end iterator if not found.
+             *                Must contains at least `keys.count()` elements.
+             */
+            template<typename K>
+            constexpr void find_batch(const hud::slice<K> &keys, hud::slice<iterator> results) noexcept
+            {
+                HUD_CHECK(results.count() >= keys.count() && "results must contains at least keys.count() elements");
+                const auto write_iterator = [&results](usize index, iterator it)
+                {
+                    results[index] = it;
+                };
+                if consteval
+                {
+                    find_batch_impl<portable_group>(keys, write_iterator);
+                }
+                else
+                {
+                    find_batch_impl<group_type>(keys, write_iterator);
+                }
+            }
+
+            /**
+             * Finds a batch of keys.
+             *
+             * See the non-const `find_batch` for details.
+             *
+             * @tparam K Type of the keys to search for.
+             * @param keys The keys to search for.
+             * @param results Receives for each key an iterator to the element found, or the end iterator if not found.
+             *                Must contains at least `keys.count()` elements.
+             */
+            template<typename K>
+            constexpr void find_batch(const hud::slice<K> &keys, hud::slice<const_iterator> results) const noexcept
+            {
+                HUD_CHECK(results.count() >= keys.count() && "results must contains at least keys.count() elements");
+                const auto write_iterator = [&results](usize index, iterator it)
+                {
+                    results[index] = const_iterator {hud::move(it)};
+                };
+                if consteval
+                {
+                    const_cast<hashset_impl *>(this)->template find_batch_impl<portable_group>(keys, write_iterator);
+                }
+                else
+                {
+                    const_cast<hashset_impl *>(this)->template find_batch_impl<group_type>(keys, write_iterator);
+                }
+            }
+
+            /**
+             * Checks whether a batch of keys exists in the hash set.
+             *
+             * See `find_batch` for details.
+             *
+             * @tparam K Type of the keys to search for.
+             * @param keys The keys to search for.
+             * @param results Receives for each key `true` if the key is found, `false` otherwise.
+             *                Must contains at least `keys.count()` elements.
+             * @return The count of keys found.
+             */
+            template<typename K>
+            constexpr usize contains_batch(const hud::slice<K> &keys, hud::slice<bool> results) const noexcept
+            {
+                HUD_CHECK(results.count() >= keys.count() && "results must contains at least keys.count() elements");
+                usize found_count {0};
+                const auto write_found = [this, &results, &found_count](usize index, iterator it)
+                {
+                    const bool is_found {it.control_ptr_ != control_ptr_sentinel()};
+                    results[index] = is_found;
+                    found_count += is_found ? 1 : 0;
+                };
+                if consteval
+                {
+                    const_cast<hashset_impl *>(this)->template find_batch_impl<portable_group>(keys, write_found);
+                }
+                else
+                {
+                    const_cast<hashset_impl *>(this)->template find_batch_impl<group_type>(keys, write_found);
+                }
+                return found_count;
+            }
+
+            /**
+             * Computes the hash of a key with the hasher of the hashset.
+             *
+             * The returned value can be given to `find_with_hash`, `contains_with_hash`, `add_with_hash` or `remove_with_hash`
+             * of any hashset that uses the same hasher, to not compute the hash again. `K` can be any type the `hasher_type` accepts,
+             * if the `hasher_type` is not specialized for `K` a temporary `key_type` is constructed to compute the hash.
+             *
+             * @tparam K Type of the key to hash.
+             * @param key The key to hash.
+             * @return The 64-bit hash of the key.
+             */
+            template<typename K>
+            [[nodiscard]]
+            constexpr u64 hash_of(K &&key) const noexcept
+            {
+                return const_cast<hashset_impl *>(this)->compute_hash(hud::forward<K>(key));
+            }
+
+            /**
+             * Finds an element by key with an already computed hash.
+             *
+             * Same as `find` but the hash of the key is not computed. This is useful when the hash is already known,
+             * for example when it is stored next to the key or when the same key is searched in several hashsets.
+             * Transparent keys are supported the same way as `find`.
+             *
+             * Important: `hash` must be the value returned by `hash_of(key)`, otherwise the key is not found.
+             *
+             * @tparam K Type of the key to search for.
+             * @param key The key to search for.
+             * @param hash The hash of the key, as returned by `hash_of(key)`.
+             * @return An iterator pointing to the found element, or the end iterator if not found.
+             */
+            template<typename K>
+            [[nodiscard]]
+            constexpr iterator find_with_hash(K &&key, const u64 hash) noexcept
+            {
+                HUD_CHECK(hash == hash_of(key) && "hash is not the hash of the key");
+                if consteval
+                {
+                    return find_impl<portable_group>(forward_key(hud::forward<K>(key)), hash);
+                }
+                else
+                {
+                    return find_impl<group_type>(forward_key(hud::forward<K>(key)), hash);
+                }
+            }
+
+            /**
+             * Finds an element by key with an already computed hash.
+             *
+             * See the non-const `find_with_hash` for details.
+             *
+             * @tparam K Type of the key to search for.
+             * @param key The key to search for.
+             * @param hash The hash of the key, as returned by `hash_of(key)`.
+             * @return An iterator pointing to the found element, or the end iterator if not found.
+             */
+            template<typename K>
+            [[nodiscard]]
+            constexpr const_iterator find_with_hash(K &&key, const u64 hash) const noexcept
+            {
+                return const_cast<hashset_impl *>(this)->find_with_hash(hud::forward<K>(key), hash);
+            }
+
+            /**
+             * Checks whether the specified key exists in the hash set with an already computed hash.
+             *
+             * See `find_with_hash` for details.
+             *
+             * @tparam K Type of the key to search for.
+             * @param key The key to search for.
+             * @param hash The hash of the key, as returned by `hash_of(key)`.
+             * @return `true` if the key is found, `false` otherwise.
+             */
+            template<typename K>
+            [[nodiscard]]
+            constexpr bool contains_with_hash(K &&key, const u64 hash) const noexcept
+            {
+                return find_with_hash(hud::forward<K>(key), hash) != end();
+            }
+
             /**
              * Swaps the contents of this hash set with another one.
              * Allocator is swapped only if allowed by allocator_traits.
@@ -1865,6 +2413,7 @@ namespace hud
                 hud::swap(other.slot_ptr_, slot_ptr_);
                 hud::swap(other.max_slot_count_, max_slot_count_);
                 hud::swap(other.free_slot_before_grow_compressed(), free_slot_before_grow_compressed());
+                hud::swap(other.deleted_count_, deleted_count_);
             }
 
             /**
@@ -1899,6 +2448,25 @@ namespace hud
                 }
             }
 
+            /**
+             * Removes an element by key with an already computed hash if it exists.
+             *
+             * Same as `remove` but the hash of the key is not computed. See `find_with_hash` for details.
+             *
+             * @tparam K Type of the key to search for.
+             * @param key The key to search for.
+             * @param hash The hash of the key, as returned by `hash_of(key)`.
+             */
+            template<typename K>
+            constexpr void remove_with_hash(K &&key, const u64 hash) noexcept
+            {
+                iterator it = find_with_hash(hud::forward<K>(key), hash);
+                if (it != end())
+                {
+                    remove_iterator(it);
+                }
+            }
+
             /** Retrieves the allocator. */
             [[nodiscard]] constexpr const allocator_type &allocator() const noexcept
             {
@@ -1928,7 +2496,7 @@ namespace hud
              *
              * Important: This represents the **raw capacity** (number of slots),
              * **not** the growth threshold. The threshold at which a rehash is triggered
-             * depends on the load factor, which is 7/8 by default. This means a resize
+             * depends on the max load factor of `policy_t`, which is 7/8 by default. This means a resize
              * will occur when 7/8 of the slots are occupied.
              */
             [[nodiscard]] constexpr usize max_count() const noexcept
@@ -1936,6 +2504,92 @@ namespace hud
                 return max_slot_count_;
             }
 
+            /**
+             * Returns the number of deleted slots (tombstones) currently in the table.
+             *
+             * Removing an element leaves a deleted slot when a probing sequence may cross it.
+             * Deleted slots are reused by insertions but still count against the load factor
+             * until a rehash drops them.
+             */
+            [[nodiscard]] constexpr usize deleted_count() const noexcept
+            {
+                return deleted_count_;
+            }
+
+            /**
+             * Returns statistics about the memory footprint of the hashset.
+             * The cost is O(1), see `hashset_stats` for the meaning of each value.
+             * Use `probe_stats()` to get the probe lengths of the elements.
+             */
+            [[nodiscard]] constexpr stats_type stats() const noexcept
+            {
+                stats_type stats;
+                stats.count = count_;
+                stats.max_count = max_slot_count_;
+                stats.deleted_count = deleted_count_;
+                stats.allocation_size = max_slot_count_ == 0 ? 0 : current_allocation_size();
+#if defined(HD_HASHSET_INSTRUMENTATION)
+                // Counters are never updated in constant evaluation
+                if (!hud::is_constant_evaluated())
+                {
+                    stats.probe_operation_count = hud::atomics::load(probe_operation_count_, hud::atomics::memory_order_e::relaxed);
+                    stats.probe_group_count = hud::atomics::load(probe_group_count_, hud::atomics::memory_order_e::relaxed);
+                }
+#endif
+                if (max_slot_count_ != 0)
+                {
+                    stats.load_factor = static_cast<f32>(count_) / static_cast<f32>(max_slot_count_);
+                    stats.used_load_factor = static_cast<f32>(count_ + deleted_count_) / static_cast<f32>(max_slot_count_);
+                }
+                return stats;
+            }
+
+            /**
+             * Computes the probe lengths of the elements.
+             *
+             * The probe length of each element is computed by hashing its key again, the cost is O(max_count())
+             * with no allocation. It is meant for sampling or diagnostic, not for every operation.
+             * See `hashset_probe_stats` for the meaning of each value.
+             */
+            [[nodiscard]] constexpr probe_stats_type probe_stats() const noexcept
+            {
+                probe_stats_type stats;
+                usize probe_length_sum {0};
+                for (usize slot_index = 0; slot_index < max_slot_count_; slot_index++)
+                {
+                    if (!control::is_byte_full(control_ptr_[slot_index]))
+                    {
+                        continue;
+                    }
+                    // Groups are probed from the slot given by H1, the probe length is the group that contains the element
+                    const usize probe_start {H1(hash_of(slot_ptr_[slot_index].key())) & max_slot_count_};
+                    const usize probe_length {((slot_index - probe_start) & max_slot_count_) / SLOT_PER_GROUP() + 1};
+                    probe_length_sum += probe_length;
+                    stats.max_probe_length = hud::math::max(stats.max_probe_length, probe_length);
+                    stats.probe_length_histogram[hud::math::min(probe_length, probe_stats_type::PROBE_LENGTH_HISTOGRAM_SIZE) - 1]++;
+                }
+                if (count_ > 0)
+                {
+                    stats.average_probe_length = static_cast<f32>(probe_length_sum) / static_cast<f32>(count_);
+                }
+                return stats;
+            }
+
+            /**
+             * Resets the probe counters reported by `stats()`.
+             * Does nothing if `HD_HASHSET_INSTRUMENTATION` is not defined.
+             */
+            constexpr void reset_probe_counters() noexcept
+            {
+#if defined(HD_HASHSET_INSTRUMENTATION)
+                if (!hud::is_constant_evaluated())
+                {
+                    hud::atomics::store(probe_operation_count_, u64 {0}, hud::atomics::memory_order_e::relaxed);
+                    hud::atomics::store(probe_group_count_, u64 {0}, hud::atomics::memory_order_e::relaxed);
+                }
+#endif
+            }
+
             /** Returns an iterator to the first element in the container. */
             [[nodiscard]] constexpr iterator begin() noexcept
             {
@@ -1966,21 +2620,66 @@ namespace hud
             /**
              * Finds or inserts a slot corresponding to the given key.
              *
-             * If the key is not found, a new slot is created by constructing it with the key followed by `args`.
+             * If the key is not found, a new slot is created by constructing it with the key followed by `args`.
+             *
+             * @param key The key used to find or insert the slot.
+             * @param args The arguments forwarded to the `slot_type` constructor after the key.
+             * @return An iterator to the inserted or existing value.
+             */
+            template<typename K, typename... args_t>
+            constexpr iterator add_impl(K &&key, args_t &&...args) noexcept
+            {
+                hud::pair<iterator, bool> res {find_or_insert_no_construct(hud::forward<K>(key))};
+                if (res.second)
+                {
+                    hud::memory::construct_object_at(res.first.slot_ptr_, hud::forward<K>(key), hud::forward<args_t>(args)...);
+                }
+                return res.first;
+            }
+
+            /**
+             * Finds or inserts a slot corresponding to the given key with an already computed hash.
+             *
+             * Same as `add_impl` but the hash of the key is not computed.
+             *
+             * @param hash The hash of the key, as returned by `hash_of(key)`.
+             * @param key The key used to find or insert the slot.
+             * @param args The arguments forwarded to the `slot_type` constructor after the key.
+             * @return An iterator to the inserted or existing value.
+             */
+            template<typename K, typename... args_t>
+            constexpr iterator add_with_hash_impl(const u64 hash, K &&key, args_t &&...args) noexcept
+            {
+                HUD_CHECK(hash == hash_of(key) && "hash is not the hash of the key");
+                hud::pair<iterator, bool> res {find_or_insert_no_construct(hud::forward<K>(key), hash)};
+                if (res.second)
+                {
+                    hud::memory::construct_object_at(res.first.slot_ptr_, hud::forward<K>(key), hud::forward<args_t>(args)...);
+                }
+                return res.first;
+            }
+
+            /**
+             * Inserts a slot for a key that is not in the container without searching it.
+             *
+             * The probing sequence stops at the first empty or deleted slot, groups are not matched against the key.
+             * This is the bulk path of `add_unique_range`.
+             *
+             * Important: The key must not be in the container, else the container contains it twice.
+             * This is checked in debug only.
              *
-             * @param key The key used to find or insert the slot.
+             * @param key The key used to insert the slot.
              * @param args The arguments forwarded to the `slot_type` constructor after the key.
-             * @return An iterator to the inserted or existing value.
+             * @return An iterator to the inserted value.
              */
             template<typename K, typename... args_t>
-            constexpr iterator add_impl(K &&key, args_t &&...args) noexcept
+            constexpr iterator add_unique_impl(K &&key, args_t &&...args) noexcept
             {
-                hud::pair<iterator, bool> res {find_or_insert_no_construct(hud::forward<K>(key))};
-                if (res.second)
-                {
-                    hud::memory::construct_object_at(res.first.slot_ptr_, hud::forward<K>(key), hud::forward<args_t>(args)...);
-                }
-                return res.first;
+                HUD_CHECK(!contains(key) && "key is already in the container");
+                const u64 hash {hash_of(key)};
+                iterator it {insert_no_construct(H1(hash), H2(hash))};
+                hud::memory::construct_object_at(it.slot_ptr_, hud::forward<K>(key), hud::forward<args_t>(args)...);
+                return it;
             }
 
             /**
@@ -2103,13 +2802,32 @@ namespace hud
             [[nodiscard]]
             constexpr iterator find_impl(K &&key) noexcept
             {
-                u64 hash {hasher()(hud::forward<K>(key))};
+                return find_impl<group_t>(hud::forward<K>(key), hasher()(hud::forward<K>(key)));
+            }
+
+            /**
+             * Searches for a key in the hashset using a given group type and the already computed hash of the key.
+             *
+             * See `find_impl(K &&key)` for the probing logic.
+             *
+             * @tparam group_t Type representing a group of slots/controls in the hashset.
+             * @tparam K Type of the key to search for.
+             * @param key The key to search for.
+             * @param hash The 64-bit hash of the key.
+             * @return An iterator pointing to the found slot, or the end iterator if not found.
+             */
+            template<typename group_t, typename K>
+            [[nodiscard]]
+            constexpr iterator find_impl(K &&key, const u64 hash) noexcept
+            {
                 u64 h1(H1(hash));
                 HUD_CHECK(hud::bits::is_valid_power_of_two_mask(max_slot_count_) && "Not a mask");
                 usize slot_index(h1 & max_slot_count_);
+                count_probe_operation();
 
                 while (true)
                 {
+                    count_probed_group();
                     const group_t group {control_ptr_ + slot_index};
                     const typename group_t::mask group_mask_that_match_h2 {group.match(H2(hash))};
                     for (u32 group_index_that_match_h2 : group_mask_that_match_h2)
@@ -2134,6 +2852,48 @@ namespace hud
                 }
             }
 
+            /**
+             * Searches for a batch of keys in the hashset using a given group type.
+             *
+             * Keys are processed by batch of `FIND_BATCH_SIZE`:
+             *
+             *  - The hash of every key of the batch is computed and the first control group and slot probed by the key are prefetched.
+             *
+             *  - Each key is then resolved with `find_impl`, by then its control group and slot are likely in the cache.
+             *
+             * @tparam group_t Type representing a group of slots/controls in the hashset.
+             * @tparam K Type of the keys to search for.
+             * @param keys The keys to search for.
+             * @param callback Called with the index of the key in `keys` and the iterator returned by `find_impl`.
+             */
+            template<typename group_t, typename K>
+            constexpr void find_batch_impl(const hud::slice<K> &keys, auto callback) noexcept
+            {
+                // Enough keys to hide the memory latency, few enough to keep the prefetched lines in L1
+                constexpr usize FIND_BATCH_SIZE {16};
+                u64 hashes[FIND_BATCH_SIZE];
+
+                for (usize batch_start = 0; batch_start < keys.count(); batch_start += FIND_BATCH_SIZE)
+                {
+                    const usize batch_count {hud::math::min(FIND_BATCH_SIZE, keys.count() - batch_start)};
+                    for (usize index = 0; index < batch_count; index++)
+                    {
+                        hashes[index] = compute_hash(keys[batch_start + index]);
+                        // slot_ptr_ can be uninitialized in a constant-evaluated context, don't touch it
+                        if (!hud::is_constant_evaluated())
+                        {
+                            const usize slot_index {H1(hashes[index]) & max_slot_count_};
+                            hud::memory::prefetch(control_ptr_ + slot_index);
+                            hud::memory::prefetch(slot_ptr_ + slot_index);
+                        }
+                    }
+                    for (usize index = 0; index < batch_count; index++)
+                    {
+                        callback(batch_start + index, find_impl<group_t>(forward_key(keys[batch_start + index]), hashes[index]));
+                    }
+                }
+            }
+
             /**
              * Computes the 64-bit hash of a key.
              *
@@ -2250,7 +3010,7 @@ namespace hud
              *      `free_slot_before_grow_compressed()` is incremented.
              *    - If the slot is part of a probing sequence, it must be marked as `deleted` to
              *      preserve the correctness of lookups. In this case, a flag is set in
-             *      `free_slot_before_grow_compressed()` to indicate that deleted slots exist.
+             *      `free_slot_before_grow_compressed()` to indicate that deleted slots exist and `deleted_count_` is incremented.
              *
              * Finally, the element count (`count_`) is decremented.
              * @param it Iterator pointing to the element to remove.
@@ -2268,6 +3028,7 @@ namespace hud
                 {
                     control::set(control_ptr_, index, deleted_byte, max_slot_count_);
                     free_slot_before_grow_compressed() |= ~((~usize {}) >> 1); // Set the sign bit that represent the presence of delete slots
+                    deleted_count_++;
                 }
                 count_--;
             }
@@ -2285,7 +3046,7 @@ namespace hud
              * @param extra_max_count Optional extra slots to allocate beyond `other.max_count()`.
              */
             template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t>
-            constexpr void copy_construct(const hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t> &other, usize extra_max_count = 0) noexcept
+            constexpr void copy_construct(const hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t> &other, usize extra_max_count = 0) noexcept
             {
                 // If `max_slot_count_` is zero, it returns immediately (nothing to copy).
                 if (max_slot_count_ == 0)
@@ -2305,7 +3066,7 @@ namespace hud
                 //        - Uses `fast_move_or_copy_construct_object_array_then_destroy` to copy
                 //          the control array.
                 //        - If there are elements, copies the slot array directly.
-                if (extra_max_count > 0 || hud::is_constant_evaluated() || !hud::is_bitwise_copy_constructible_v<slot_type, typename hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t>::slot_type>)
+                if (extra_max_count > 0 || hud::is_constant_evaluated() || !hud::is_bitwise_copy_constructible_v<slot_type, typename hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t>::slot_type>)
                 {
                     // Set control to empty ending with sentinel
                     hud::memory::set_memory(control_ptr_, control_size, empty_byte);
@@ -2332,6 +3093,8 @@ namespace hud
                     {
                         hud::memory::fast_move_or_copy_construct_object_array_then_destroy(slot_ptr_, other.slot_ptr_, other.max_count());
                     }
+                    // Controls are copied as is, deleted slots are kept
+                    deleted_count_ = other.deleted_count_;
                 }
             }
 
@@ -2349,7 +3112,7 @@ namespace hud
              * @param extra_max_count Optional extra slots to allocate beyond `other.max_count()`.
              */
             template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t>
-            constexpr void move_construct(hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t> &&other, usize extra_max_count = 0) noexcept
+            constexpr void move_construct(hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t> &&other, usize extra_max_count = 0) noexcept
             {
                 // Nothing to move if max_slot_count_ is zero
                 if (max_slot_count_ == 0)
@@ -2367,7 +3130,7 @@ namespace hud
                 //      - Set control byte and move-construct slot in place.
                 // Else (trivial types in runtime context):
                 //      - Take ownership of the other set's control and slot arrays.
-                if (extra_max_count > 0 || hud::is_constant_evaluated() || !hud::is_bitwise_move_constructible_v<slot_type, typename hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t>::slot_type>)
+                if (extra_max_count > 0 || hud::is_constant_evaluated() || !hud::is_bitwise_move_constructible_v<slot_type, typename hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t>::slot_type>)
                 {
                     // Set control to empty ending with sentinel
                     hud::memory::set_memory(control_ptr_, control_size, empty_byte);
@@ -2398,6 +3161,8 @@ namespace hud
                     other.max_slot_count_ = 0;
                     other.count_ = 0;
                     other.free_slot_before_grow_compressed() = 0;
+                    deleted_count_ = other.deleted_count_;
+                    other.deleted_count_ = 0;
                 }
             }
 
@@ -2440,7 +3205,7 @@ namespace hud
              * @param other The other hashset_impl to copy from.
              */
             template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t>
-            constexpr void copy_assign(const hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t> &other) noexcept
+            constexpr void copy_assign(const hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t> &other) noexcept
             {
                 // Destroy all slots
                 destroy_all_slots();
@@ -2467,6 +3232,7 @@ namespace hud
                     count_ = other.count_;
                     // Compute the free slot count before growing
                     free_slot_before_grow_compressed() = max_slot_before_grow(max_slot_count_) - count_;
+                    deleted_count_ = 0;
                 }
                 else // If we don't have enough memory
                 {
@@ -2484,6 +3250,7 @@ namespace hud
                     max_slot_count_ = normalize_max_count(count_);
                     // Compute the free slot count before growing
                     free_slot_before_grow_compressed() = max_slot_before_grow(max_slot_count_) - count_;
+                    deleted_count_ = 0;
                     // Allocate the control and slot
                     usize control_size {allocate_control_and_slot(max_slot_count_)};
 
@@ -2556,7 +3323,7 @@ namespace hud
              * @param other The other hashset_impl to move from.
              */
             template<typename u_storage_t, typename u_hasher_t, typename u_key_equal_t, typename u_allocator_t>
-            constexpr void move_assign(hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t> &&other) noexcept
+            constexpr void move_assign(hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t> &&other) noexcept
             {
                 // Destroy all slots but don't touch the allocated memory now
                 // If we can just move control and slot pointers we do it
@@ -2565,7 +3332,7 @@ namespace hud
                 // Second, we don't have enough memory and we reallacte memory and add elements by moving them one by one
                 destroy_all_slots();
 
-                if (hud::is_constant_evaluated() || !hud::is_bitwise_move_constructible_v<slot_type, typename hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t>::slot_type>)
+                if (hud::is_constant_evaluated() || !hud::is_bitwise_move_constructible_v<slot_type, typename hashset_impl<u_storage_t, u_hasher_t, u_key_equal_t, u_allocator_t, policy_t>::slot_type>)
                 {
                     // We don't keep the max count of the copied array
                     // The requested memory is the number of element in the copied array, not the max slot count.
@@ -2588,6 +3355,7 @@ namespace hud
                         count_ = other.count_;
                         // Compute the free slot count before growing
                         free_slot_before_grow_compressed() = max_slot_before_grow(max_slot_count_) - count_;
+                        deleted_count_ = 0;
                     }
                     else // If we don't have enough memory
                     {
@@ -2605,6 +3373,7 @@ namespace hud
                         max_slot_count_ = normalize_max_count(count_);
                         // Compute the free slot count before growing
                         free_slot_before_grow_compressed() = max_slot_before_grow(max_slot_count_) - count_;
+                        deleted_count_ = 0;
                         // Allocate the control and slot
                         usize control_size {allocate_control_and_slot(max_slot_count_)};
 
@@ -2652,6 +3421,8 @@ namespace hud
                     other.max_slot_count_ = 0;
                     free_slot_before_grow_compressed() = other.free_slot_before_grow_compressed();
                     other.free_slot_before_grow_compressed() = 0;
+                    deleted_count_ = other.deleted_count_;
+                    other.deleted_count_ = 0;
                 }
             }
 
@@ -2694,6 +3465,32 @@ namespace hud
                 }
             }
 
+            /**
+             * Finds a key or prepares a slot for insertion without constructing the value, with an already computed hash.
+             *
+             * See `find_or_insert_no_construct(K &&key)` for details.
+             *
+             * @tparam K Type of the key to find or insert.
+             * @param key The key to find or prepare for insertion.
+             * @param hash The hash of the key, as returned by `hash_of(key)`.
+             * @return A pair of iterator and bool:
+             *         - iterator: points to the existing element if found, or to the prepared slot if not found.
+             *         - bool: true if insertion is required, false if key was found.
+             */
+            template<typename K>
+            [[nodiscard]]
+            constexpr hud::pair<iterator, bool> find_or_insert_no_construct(K &&key, const u64 hash) noexcept
+            {
+                if consteval
+                {
+                    return find_or_insert_no_construct_impl<portable_group>(forward_key(hud::forward<K>(key)), hash);
+                }
+                else
+                {
+                    return find_or_insert_no_construct_impl<group_type>(forward_key(hud::forward<K>(key)), hash);
+                }
+            }
+
             /**
              * Finds a key or prepares a slot for insertion without constructing the value.
              *
@@ -2725,12 +3522,32 @@ namespace hud
             template<typename group_t, typename K>
             [[nodiscard]] constexpr hud::pair<iterator, bool> find_or_insert_no_construct_impl(K &&key) noexcept
             {
-                u64 hash {compute_hash(key)};
+                return find_or_insert_no_construct_impl<group_t>(hud::forward<K>(key), compute_hash(key));
+            }
+
+            /**
+             * Finds a key or prepares a slot for insertion without constructing the value, with an already computed hash.
+             *
+             * See `find_or_insert_no_construct_impl(K &&key)` for the probing logic.
+             *
+             * @tparam group_t The control group type used for probing.
+             * @tparam K Type of the key to find or insert.
+             * @param key The key to find or prepare for insertion.
+             * @param hash The 64-bit hash of the key.
+             * @return A pair of iterator and bool:
+             *         - iterator: points to the existing element if found, or to the prepared slot if not found.
+             *         - bool: true if insertion is required, false if key was found.
+             */
+            template<typename group_t, typename K>
+            [[nodiscard]] constexpr hud::pair<iterator, bool> find_or_insert_no_construct_impl(K &&key, const u64 hash) noexcept
+            {
                 u64 h1(H1(hash));
                 HUD_CHECK(hud::bits::is_valid_power_of_two_mask(max_slot_count_) && "Not a mask");
                 usize slot_index(h1 & max_slot_count_);
+                count_probe_operation();
                 while (true)
                 {
+                    count_probed_group();
                     // Find the key if present, return iterator to it if not prepare for insertion
                     const group_t group {control_ptr_ + slot_index};
                     const typename group_t::mask group_mask_that_match_h2 {group.match(H2(hash))};
@@ -2776,15 +3593,19 @@ namespace hud
              */
             [[nodiscard]] constexpr iterator insert_no_construct(u64 h1, u8 h2) noexcept
             {
-                // If we reach the load factor grow the table and retrieves the new slot, else use the given slot
+                // If we reach the load factor drop deleted slots or grow the table
                 if (free_slot_before_grow() == 0)
                 {
-                    resize(next_capacity());
+                    rehash_and_grow_if_necessary();
                 }
 
                 // Find the first empty of deleted slot that can be used for this h1 hash
                 usize slot_index {find_first_empty_or_deleted(control_ptr_, max_slot_count_, h1)};
                 count_++;
+                if (control::is_byte_deleted(control_ptr_[slot_index]))
+                {
+                    deleted_count_--;
+                }
                 control::set(control_ptr_, slot_index, h2, max_slot_count_);
 
                 free_slot_before_grow_compressed()--;
@@ -2834,6 +3655,7 @@ namespace hud
 
                 // Update number of slot we should put into the table before a resizing rehash
                 free_slot_before_grow_compressed() = max_slot_before_grow(max_slot_count_) - count_;
+                deleted_count_ = 0;
 
                 // Set control to empty ending with sentinel
                 hud::memory::set_memory(control_ptr_, control_size, empty_byte);
@@ -2861,6 +3683,167 @@ namespace hud
                 }
             }
 
+            /**
+             * Resizes the hashset to a new maximum number of slots, relocating the elements with tasks run by `executor`.
+             *
+             * Like `resize()`, but the old control array is split in ranges of `PARALLEL_RESIZE_SLOT_PER_TASK` slots and each task
+             * reinserts the elements of one range. Slots of the new table are claimed with `claim_first_empty()`, so tasks can run concurrently.
+             * The cloned bytes are written once all tasks are done.
+             *
+             * The hashset must contain at least one element.
+             *
+             * @param new_max_slot_count The new maximum number of slots (must be a power-of-2 minus 1 mask).
+             * @param executor The callable that runs the relocation tasks, see `reserve_parallel()`.
+             */
+            template<typename executor_t>
+            void resize_parallel(usize new_max_slot_count, executor_t &executor) noexcept
+            {
+                HUD_CHECK(hud::bits::is_valid_power_of_two_mask(new_max_slot_count) && "Not a mask");
+                HUD_CHECK(count_ > 0 && "Parallel resize of an empty hashset");
+
+                control_type *old_control_ptr {control_ptr_};
+                slot_type *old_slot_ptr {slot_ptr_};
+                usize old_max_slot_count {max_slot_count_};
+
+                max_slot_count_ = new_max_slot_count;
+                usize control_size {allocate_control_and_slot(max_slot_count_)};
+                free_slot_before_grow_compressed() = max_slot_before_grow(max_slot_count_) - count_;
+                deleted_count_ = 0;
+                hud::memory::set_memory(control_ptr_, control_size, empty_byte);
+                control_ptr_[max_slot_count_] = sentinel_byte;
+
+                // Each task relocates the elements of a range of the old control array
+                const usize old_slot_count {old_max_slot_count + 1};
+                const usize task_count {(old_slot_count + PARALLEL_RESIZE_SLOT_PER_TASK - 1) / PARALLEL_RESIZE_SLOT_PER_TASK};
+                auto relocate_range = [this, old_control_ptr, old_slot_ptr, old_slot_count](usize task_index) noexcept
+                {
+                    const usize first_slot_index {task_index * PARALLEL_RESIZE_SLOT_PER_TASK};
+                    const usize end_slot_index {hud::math::min(first_slot_index + PARALLEL_RESIZE_SLOT_PER_TASK, old_slot_count)};
+                    for (usize old_slot_index = first_slot_index; old_slot_index < end_slot_index; old_slot_index++)
+                    {
+                        if (control::is_byte_full(old_control_ptr[old_slot_index]))
+                        {
+                            slot_type *old_slot {old_slot_ptr + old_slot_index};
+                            u64 hash {compute_hash(old_slot->key())};
+                            usize slot_index {claim_first_empty(control_ptr_, max_slot_count_, H1(hash), static_cast<control_type>(H2(hash)))};
+                            hud::memory::move_or_copy_construct_object_then_destroy(slot_ptr_ + slot_index, hud::move(*old_slot));
+                        }
+                    }
+                };
+                executor(task_count, relocate_range);
+
+                // Tasks only write the control byte of the claimed slots, write the cloned bytes of the first slots
+                usize count_cloned_byte {SLOT_PER_GROUP() - 1};
+                for (usize slot_index = 0; slot_index < count_cloned_byte && slot_index <= max_slot_count_; slot_index++)
+                {
+                    control::set(control_ptr_, slot_index, control_ptr_[slot_index], max_slot_count_);
+                }
+                free_control_and_slot(old_control_ptr, old_slot_ptr, old_max_slot_count);
+            }
+
+            /**
+             * Makes room for an insertion when no free slot is left before a grow.
+             *
+             * When the load factor is reached because of deleted slots rather than elements, the elements are rehashed in place
+             * with `drop_deleted_without_resize()`, reusing the current allocation. Otherwise the table grows to `next_capacity()`.
+             *
+             * Dropping deleted slots is only done at runtime. In a constant-evaluated context the table always grows.
+             */
+            constexpr void rehash_and_grow_if_necessary() noexcept
+            {
+                // Rehash in place when the elements use at most 25/28 of the max load factor, 25/32 of the slots with the default 7/8.
+                // Above this ratio the table is almost full of elements and would need to grow soon anyway
+                constexpr usize numerator {policy_t::MAX_LOAD_FACTOR_NUMERATOR};
+                constexpr usize denominator {policy_t::MAX_LOAD_FACTOR_DENOMINATOR};
+                if (!hud::is_constant_evaluated() && has_deleted_slot() && max_slot_count_ > SLOT_PER_GROUP() && count_ * denominator * 28 <= max_slot_count_ * numerator * 25)
+                {
+                    drop_deleted_without_resize();
+                }
+                else
+                {
+                    resize(next_capacity());
+                }
+            }
+
+            /**
+             * Rehashes all elements in place to drop deleted slots without allocating.
+             *
+             * Details of the operation:
+             *  - Marks full slots as deleted and deleted slots as empty. From now, deleted means "element to rehash".
+             *  - For each slot to rehash, finds the first empty or deleted slot of its probing sequence:
+             *      - If it is in the same group than the current slot, the element stays in place.
+             *      - If it is empty, the element is moved there and the current slot becomes empty.
+             *      - If it is deleted, both elements are swapped and the current slot is processed again.
+             *  - Resets the free slot counter since no deleted slot remains.
+             *
+             * This relocates elements within the existing buffer, it is only called at runtime.
+             */
+            void drop_deleted_without_resize() noexcept
+            {
+                // Mark full slots as deleted and deleted slots as empty, then update the cloned bytes
+                for (usize slot_index = 0; slot_index < max_slot_count_; slot_index++)
+                {
+                    control_ptr_[slot_index] = control::is_byte_full(control_ptr_[slot_index]) ? deleted_byte : empty_byte;
+                }
+                hud::memory::copy_memory(control_ptr_ + max_slot_count_ + 1, control_ptr_, SLOT_PER_GROUP() - 1);
+
+                // Storage used to swap two slots
+                alignas(slot_type) unsigned char temp_storage[sizeof(slot_type)];
+                slot_type *temp_slot {reinterpret_cast<slot_type *>(temp_storage)};
+
+                for (usize slot_index = 0; slot_index < max_slot_count_; slot_index++)
+                {
+                    if (!control::is_byte_deleted(control_ptr_[slot_index]))
+                    {
+                        continue;
+                    }
+                    const u64 hash {compute_hash(slot_ptr_[slot_index].key())};
+                    const u64 h1 {H1(hash)};
+                    const usize new_slot_index {find_first_empty_or_deleted(control_ptr_, max_slot_count_, h1)};
+
+                    // If both slots are in the same probed group, the element is already at the best position
+                    const usize probe_start {h1 & max_slot_count_};
+                    const auto probe_group_index = [this, probe_start](usize index)
+                    {
+                        return ((index - probe_start) & max_slot_count_) / SLOT_PER_GROUP();
+                    };
+                    if (probe_group_index(new_slot_index) == probe_group_index(slot_index))
+                    {
+                        control::set(control_ptr_, slot_index, H2(hash), max_slot_count_);
+                        continue;
+                    }
+
+                    const bool is_new_slot_empty {control::is_byte_empty(control_ptr_[new_slot_index])};
+                    control::set(control_ptr_, new_slot_index, H2(hash), max_slot_count_);
+                    if (is_new_slot_empty)
+                    {
+                        hud::memory::move_or_copy_construct_object_then_destroy(slot_ptr_ + new_slot_index, hud::move(slot_ptr_[slot_index]));
+                        control::set(control_ptr_, slot_index, empty_byte, max_slot_count_);
+                    }
+                    else
+                    {
+                        // The new slot contains an element not rehashed yet, swap them and process the current slot again
+                        hud::memory::move_or_copy_construct_object_then_destroy(temp_slot, hud::move(slot_ptr_[slot_index]));
+                        hud::memory::move_or_copy_construct_object_then_destroy(slot_ptr_ + slot_index, hud::move(slot_ptr_[new_slot_index]));
+                        hud::memory::move_or_copy_construct_object_then_destroy(slot_ptr_ + new_slot_index, hud::move(*temp_slot));
+                        slot_index--;
+                    }
+                }
+
+                // No more deleted slots
+                free_slot_before_grow_compressed() = max_slot_before_grow(max_slot_count_) - count_;
+                deleted_count_ = 0;
+            }
+
+            /**
+             * Checks whether the table contains deleted slots.
+             * The information is stored in the sign bit of `free_slot_before_grow_compressed()`.
+             */
+            [[nodiscard]] constexpr bool has_deleted_slot() const noexcept
+            {
+                return (free_slot_before_grow_compressed() & ~((~usize {}) >> 1)) != 0;
+            }
+
             /**
              * Returns the number of slots available before a rehash is triggered.
              *
@@ -2877,15 +3860,15 @@ namespace hud
             /**
              * Computes the next capacity for the hashset when growing.
              *
-             * This function doubles the current max slot count and adds one to ensure the
-             * new capacity remains a power-of-two-minus-one mask (0, 1, 3, 7, 15, 31, ...).
+             * This function multiplies the current number of slots by the growth factor of `policy_t` (2 by default)
+             * to ensure the new capacity remains a power-of-two-minus-one mask (0, 1, 3, 7, 15, 31, ...).
              *
              * @return The new max slot count after grow.
              */
             [[nodiscard]] constexpr usize next_capacity() const noexcept
             {
                 // Value are always power of two mask 0,1,3,7,15,31,63, etc...
-                return max_slot_count_ * 2 + 1;
+                return (max_slot_count_ + 1) * policy_t::GROWTH_FACTOR - 1;
             }
 
             /**
@@ -2902,6 +3885,29 @@ namespace hud
                 return max_slot_count ? ~usize {} >> hud::bits::leading_zeros(max_slot_count) : 0;
             }
 
+            /** Counts a lookup or an insertion in the probe counters if `HD_HASHSET_INSTRUMENTATION` is defined. */
+            constexpr void count_probe_operation() const noexcept
+            {
+#if defined(HD_HASHSET_INSTRUMENTATION)
+                // Do not modify the hashset in constant evaluation, it can be a const object
+                if (!hud::is_constant_evaluated())
+                {
+                    static_cast<void>(hud::atomics::fetch_add(probe_operation_count_, u64 {1}, hud::atomics::memory_order_e::relaxed));
+                }
+#endif
+            }
+
+            /** Counts a group scanned by a lookup or an insertion in the probe counters if `HD_HASHSET_INSTRUMENTATION` is defined. */
+            constexpr void count_probed_group() const noexcept
+            {
+#if defined(HD_HASHSET_INSTRUMENTATION)
+                if (!hud::is_constant_evaluated())
+                {
+                    static_cast<void>(hud::atomics::fetch_add(probe_group_count_, u64 {1}, hud::atomics::memory_order_e::relaxed));
+                }
+#endif
+            }
+
             /**
              * Computes the total allocation size needed for the current max slot count.
              * This includes the control bytes (aligned appropriately) and the slots themselves.
@@ -2978,6 +3984,46 @@ namespace hud
                 }
             }
 
+            /**
+             * Claims the first empty slot for the given H1 hash by setting its control byte to `h2` with an atomic compare-and-set.
+             *
+             * Slots are probed in the same order as `find_first_empty_or_deleted()`. A group is left only when all its slots are claimed,
+             * and a claimed slot is never released, so a lookup never stops at an empty slot before the slot of an element.
+             * Several threads can claim slots of the same table concurrently: control bytes are only accessed with atomic operations.
+             * The cloned bytes are not written.
+             *
+             * WARNING: This function assumes that the table contains no deleted slot and at least one empty slot.
+             *
+             * @param control_ptr Pointer to the control array.
+             * @param max_slot_count Maximum number of slots in the table (must be a power-of-two-minus-one mask).
+             * @param h1 The H1 hash of the key.
+             * @param h2 The H2 hash of the key to store in the control byte of the claimed slot.
+             * @return The index of the claimed slot.
+             */
+            [[nodiscard]] static usize claim_first_empty(control_type *control_ptr, usize max_slot_count, u64 h1, control_type h2) noexcept
+            {
+                HUD_CHECK(hud::bits::is_valid_power_of_two_mask(max_slot_count) && "Not a mask");
+                usize group_slot_index(h1 & max_slot_count);
+                while (true)
+                {
+                    // Other threads claim slots of the same group, so control bytes are read one by one with an atomic load instead of a group load.
+                    // The load only gives a candidate and the compare-and-set decides. A claimed slot is never released,
+                    // so a group without empty slot stays without empty slot
+                    for (usize offset = 0; offset < group_type::SLOT_PER_GROUP; offset++)
+                    {
+                        const usize slot_index {(group_slot_index + offset) & max_slot_count};
+                        control_type expected {empty_byte};
+                        if (hud::atomics::load(control_ptr[slot_index], hud::atomics::memory_order_e::relaxed) == empty_byte
+                            && hud::atomics::compare_and_set(control_ptr[slot_index], expected, h2, hud::atomics::memory_order_e::relaxed))
+                        {
+                            return slot_index;
+                        }
+                    }
+                    group_slot_index += group_type::SLOT_PER_GROUP;
+                    group_slot_index &= max_slot_count;
+                }
+            }
+
             /**
              * Finds the first occupied (full) slot in the hashset.
              *
@@ -3042,7 +4088,7 @@ namespace hud
                     const typename group_t::full_mask group_mask {group.mask_of_full_slot()};
                     if (group_mask.has_full_slot())
                     {
-                        u32 first_full_index {group_mask.first_full_index()};
+                        usize first_full_index {slot_index + group_mask.first_full_index()};
                         return {control_ptr_ + first_full_index, slot_ptr_ + first_full_index};
                     }
 
@@ -3057,13 +4103,15 @@ namespace hud
              * The returned value represents the number of slots that can be occupied before hitting the
              * load factor threshold. To compute the number of slots still available, subtract `count()`.
              *
-             * The load factor used is 7/8, meaning the table will resize when 7/8 of the slots are occupied.
+             * The max load factor is given by `policy_t`, 7/8 by default, meaning the table will resize when 7/8 of the slots are occupied.
+             * The count of slots that stay free is rounded down: `capacity - capacity * (1 - max load factor)`.
              *
              * Special case:
-             * - When `SLOT_PER_GROUP() == 8` and `capacity == 7`, the formula `capacity - capacity / 8` would return 7,
-             *   which would exceed the maximum allowed. In this case, the function returns 6.
+             * - When the table is at least as large as a group minus the sentinel, at least one slot must stay empty,
+             *   else a probing sequence that scans only full groups never stops.
+             *   For example with `SLOT_PER_GROUP() == 8` and `capacity == 7`, the 7/8 load factor would return 7, the function returns 6.
              *
-             * Example:
+             * Example with the default 7/8 max load factor:
              * | Capacity | capacity - capacity / 8 | Result (max slots before grow) |
              * |----------|------------------------|-------------------------------|
              * | 7        | -                      | 6                             |
@@ -3074,30 +4122,47 @@ namespace hud
              */
             [[nodiscard]] constexpr usize max_slot_before_grow(usize capacity) const noexcept
             {
-                return (SLOT_PER_GROUP() == 8 && capacity == 7) ? 6 : capacity - capacity / 8;
+                constexpr usize numerator {policy_t::MAX_LOAD_FACTOR_NUMERATOR};
+                constexpr usize denominator {policy_t::MAX_LOAD_FACTOR_DENOMINATOR};
+                // Split the capacity to not overflow when multiplying large capacities
+                const usize free_slot {(capacity / denominator) * (denominator - numerator) + ((capacity % denominator) * (denominator - numerator)) / denominator};
+                const usize max_slot {capacity - free_slot};
+                if (capacity >= SLOT_PER_GROUP() - 1 && max_slot == capacity)
+                {
+                    return capacity - 1;
+                }
+                return max_slot;
             }
 
             /**
              * Compute the minimum capacity needed to store `count` elements while respecting the load factor.
              *
-             * This ensures that the table is not overfilled based on the 7/8 load factor.
+             * This ensures that the table is not overfilled based on the max load factor of `policy_t`.
+             * It is the inverse of `max_slot_before_grow`: `count + (count - 1) * (1 - max load factor) / max load factor`.
              *
              * Special case:
-             * - When `SLOT_PER_GROUP() == 8` and `count == 7`, the formula `(count + (count-1)/7)` would not work correctly,
-             *   so the function explicitly returns 8.
+             * - When the normalized capacity can not store `count` elements because `max_slot_before_grow` keeps one slot empty,
+             *   the next capacity is returned. For example with the 7/8 max load factor, `SLOT_PER_GROUP() == 8` and `count == 7`
+             *   the function returns 8.
              *
              * @param count Number of elements to store
              * @return Minimum capacity that ensures the table can hold `count` elements without resizing immediately.
              */
             [[nodiscard]] constexpr usize min_capacity_for_count(usize count) const noexcept
             {
-                // `count*8/7`
-                if (SLOT_PER_GROUP() == 8 && count == 7)
+                if (count == 0)
+                {
+                    return 0;
+                }
+                constexpr usize numerator {policy_t::MAX_LOAD_FACTOR_NUMERATOR};
+                constexpr usize denominator {policy_t::MAX_LOAD_FACTOR_DENOMINATOR};
+                const usize capacity {count + ((count - 1) / numerator) * (denominator - numerator) + (((count - 1) % numerator) * (denominator - numerator)) / numerator};
+                const usize normalized_capacity {normalize_max_count(capacity)};
+                if (max_slot_before_grow(normalized_capacity) < count)
                 {
-                    // x+(x-1)/7 does not work when x==7.
-                    return 8;
+                    return normalized_capacity + 1;
                 }
-                return count + static_cast<usize>((static_cast<i64>(count) - 1) / 7);
+                return capacity;
             }
 
             /**
@@ -3217,7 +4282,7 @@ namespace hud
              * - Resets the internal pointers and counters to their default values:
              *     - `control_ptr_` points to the static `INIT_GROUP` sentinel.
              *     - `slot_ptr_` is set to nullptr by the allocator during next allocation.
-             *     - `max_slot_count_` and `count_` are set to 0.
+             *     - `max_slot_count_`, `count_` and `deleted_count_` are set to 0.
              *     - `free_slot_before_grow_compressed()` is reset to 0.
              */
             constexpr void reset_control_and_slot() noexcept
@@ -3226,6 +4291,7 @@ namespace hud
                 control_ptr_ = const_cast<control_type *>(&INIT_GROUP[16]);
                 max_slot_count_ = 0;
                 count_ = 0;
+                deleted_count_ = 0;
                 free_slot_before_grow_compressed() = 0;
             }
 
@@ -3383,6 +4449,9 @@ namespace hud
             /** The count of values in the hashmap. */
             usize count_ {0};
 
+            /** The count of deleted slots (tombstones) in the control. */
+            usize deleted_count_ {0};
+
             /**
              * 0 - The allocator
              * 1 - The hasher
@@ -3396,6 +4465,14 @@ namespace hud
 
             /** Pointer to the slot segment. */
             slot_type *slot_ptr_ {nullptr};
+
+#if defined(HD_HASHSET_INSTRUMENTATION)
+            /** Number of lookups and insertions since the last `reset_probe_counters()`. Updated by const lookups. */
+            mutable u64 probe_operation_count_ {0};
+
+            /** Number of groups scanned by these lookups and insertions. Updated by const lookups. */
+            mutable u64 probe_group_count_ {0};
+#endif
         };
 
     } // namespace details::hashset
@@ -3418,7 +4495,7 @@ namespace hud
      *    other than the stored `element_t` as long as `hasher_t` and `key_equal_t` are specialized
      *    to handle the alternative type `K`.
      * 4. Supports piecewise construction for complex keys. Piecewise construction allows in-place initialization of complex keys.
-     * 5. Automatic resizing according to a 7/8 load factor.
+     * 5. Automatic resizing according to a 7/8 load factor by default, configurable with `policy_t`.
      *
      * Heterogeneous lookup with alternative key types `K`:
      * -----------------------------------------------------
@@ -3436,7 +4513,10 @@ namespace hud
      * - `clear_shrink()` destroys all elements and frees memory.
      * - `rehash(max_count)` resizes the underlying table; if `max_count` is less than current capacity, nothing happens.
      * - `shrink_to_fit()` reduces the table to fit the current number of elements exactly.
+     * - `add_range(keys)` and `add_unique_range(keys)` grow the table once to insert many elements.
      * - `free_slot_before_grow()` returns the number of free slots before the next resizing.
+     * - `policy_t` sets the max load factor and the growth factor, see `hud::hashset_policy`.
+     *   The default grows at 7/8 of the slots and doubles the number of slots.
      *
      * Iterators:
      * ----------
@@ -3471,12 +4551,13 @@ namespace hud
         typename element_t,
         typename hasher_t = hud::hash_64<element_t>,
         typename key_equal_t = hud::equal<element_t>,
-        typename allocator_t = hud::heap_allocator>
+        typename allocator_t = hud::heap_allocator,
+        typename policy_t = hud::default_hashset_policy>
     class hashset
-        : public details::hashset::hashset_impl<details::hashset::hashset_storage<element_t>, hasher_t, key_equal_t, allocator_t>
+        : public details::hashset::hashset_impl<details::hashset::hashset_storage<element_t>, hasher_t, key_equal_t, allocator_t, policy_t>
     {
     private:
-        using super = details::hashset::hashset_impl<details::hashset::hashset_storage<element_t>, hasher_t, key_equal_t, allocator_t>;
+        using super = details::hashset::hashset_impl<details::hashset::hashset_storage<element_t>, hasher_t, key_equal_t, allocator_t, policy_t>;
 
     public:
         /** Type of the hash function. */
@@ -3489,6 +4570,10 @@ namespace hud
         using typename super::const_iterator;
         /**  Type of the allocator. */
         using typename super::allocator_type;
+        /** Type of the statistics returned by `stats()`. */
+        using typename super::stats_type;
+        /** Type of the statistics returned by `probe_stats()`. */
+        using typename super::probe_stats_type;
         /** Type of the storage used to store key. */
         using storage_type = typename super::storage_type;
         /** Type of the key. */
@@ -3558,6 +4643,40 @@ namespace hud
             }
         }
 
+        /**
+         * Constructs a hashset and inserts the keys of a slice.
+         * The table is sized once for all keys before inserting them. A key that is in the slice several times is inserted once.
+         *
+         * @tparam u_key_t Type of the keys in the slice.
+         * @param keys The keys to insert.
+         * @param allocator Optional allocator instance (defaults to `allocator_type()`).
+         */
+        template<typename u_key_t>
+        requires(hud::is_constructible_v<storage_type, const u_key_t &>)
+        constexpr explicit hashset(const hud::slice<u_key_t> &keys, const allocator_type &allocator = allocator_type()) noexcept
+            : super {allocator}
+        {
+            add_range(keys);
+        }
+
+        /**
+         * Constructs a hashset and moves the keys of a vector into it.
+         * The table is sized once for all keys before inserting them. A key that is in the vector several times is inserted once.
+         * The vector is empty after the call.
+         *
+         * @tparam u_key_t Type of the keys in the vector.
+         * @tparam u_allocator_t Type of the allocator of the vector.
+         * @param keys The vector to move keys from.
+         * @param allocator Optional allocator instance (defaults to `allocator_type()`).
+         */
+        template<typename u_key_t, typename u_allocator_t>
+        requires(hud::is_constructible_v<storage_type, u_key_t &&>)
+        constexpr explicit hashset(hud::vector<u_key_t, u_allocator_t> &&keys, const allocator_type &allocator = allocator_type()) noexcept
+            : super {allocator}
+        {
+            add_range(hud::move(keys));
+        }
+
         /**
          * Insert a key in the hashset.
          *
@@ -3619,6 +4738,108 @@ namespace hud
         {
             return super::add_impl(hud::tag_piecewise_construct, hud::forward<key_tuple_t>(key_tuple));
         }
+
+        /**
+         * Inserts the keys of a slice in the hashset.
+         * The table grows at most once to store all keys, then each key is inserted like `add(key)`.
+         *
+         * @tparam u_key_t Type of the keys in the slice.
+         * @param keys The keys to insert.
+         */
+        template<typename u_key_t>
+        requires(hud::is_constructible_v<storage_type, const u_key_t &>)
+        constexpr void add_range(const hud::slice<u_key_t> &keys) noexcept
+        {
+            reserve(super::count() + keys.count());
+            for (const u_key_t &key : keys)
+            {
+                add(key);
+            }
+        }
+
+        /**
+         * Moves the keys of a vector in the hashset.
+         * The table grows at most once to store all keys, then each key is moved like `add(hud::move(key))`.
+         * The vector is empty after the call.
+         *
+         * @tparam u_key_t Type of the keys in the vector.
+         * @tparam u_allocator_t Type of the allocator of the vector.
+         * @param keys The vector to move keys from.
+         */
+        template<typename u_key_t, typename u_allocator_t>
+        requires(hud::is_constructible_v<storage_type, u_key_t &&>)
+        constexpr void add_range(hud::vector<u_key_t, u_allocator_t> &&keys) noexcept
+        {
+            reserve(super::count() + keys.count());
+            for (u_key_t &key : keys)
+            {
+                add(hud::move(key));
+            }
+            keys.clear();
+        }
+
+        /**
+         * Inserts the keys of a slice that are known to be unique and not in the hashset.
+         * The table grows at most once, then each key is inserted in the first free slot of its probing sequence
+         * without comparing it to the keys already inserted.
+         *
+         * Important: Keys must be unique and not in the hashset, else the hashset contains them several times.
+         * This is checked in debug only.
+         *
+         * @tparam u_key_t Type of the keys in the slice.
+         * @param keys The unique keys to insert.
+         */
+        template<typename u_key_t>
+        requires(hud::is_constructible_v<storage_type, const u_key_t &>)
+        constexpr void add_unique_range(const hud::slice<u_key_t> &keys) noexcept
+        {
+            reserve(super::count() + keys.count());
+            for (const u_key_t &key : keys)
+            {
+                super::add_unique_impl(key);
+            }
+        }
+
+        /**
+         * Moves the keys of a vector that are known to be unique and not in the hashset.
+         * Same as `add_unique_range(slice)` but keys are moved. The vector is empty after the call.
+         *
+         * Important: Keys must be unique and not in the hashset, else the hashset contains them several times.
+         * This is checked in debug only.
+         *
+         * @tparam u_key_t Type of the keys in the vector.
+         * @tparam u_allocator_t Type of the allocator of the vector.
+         * @param keys The vector to move unique keys from.
+         */
+        template<typename u_key_t, typename u_allocator_t>
+        requires(hud::is_constructible_v<storage_type, u_key_t &&>)
+        constexpr void add_unique_range(hud::vector<u_key_t, u_allocator_t> &&keys) noexcept
+        {
+            reserve(super::count() + keys.count());
+            for (u_key_t &key : keys)
+            {
+                super::add_unique_impl(hud::move(key));
+            }
+            keys.clear();
+        }
+
+        /**
+         * Inserts a key in the hashset with an already computed hash.
+         *
+         * Same as `add(key)` but the hash of the key is not computed.
+         * `hash` must be the value returned by `hash_of(key)`.
+         *
+         * @tparam u_key_t Type of the key to insert.
+         * @param key The key to insert.
+         * @param hash The hash of the key, as returned by `hash_of(key)`.
+         * @return Iterator pointing to the inserted or existing element.
+         */
+        template<typename u_key_t = key_type>
+        constexpr iterator add_with_hash(u_key_t &&key, const u64 hash) noexcept
+        requires(hud::is_constructible_v<storage_type, u_key_t>)
+        {
+            return super::add_with_hash_impl(hash, hud::forward<u_key_t>(key));
+        }
     };
 
     /**
@@ -3668,6 +4889,7 @@ namespace hud
      * @tparam hasher_t The type of the hasher.
      * @tparam key_equal_t The type of the key equality comparator.
      * @tparam allocator_t The allocator type.
+     * @tparam policy_t The load and growth policy.
      * @param first First hashset to swap.
      * @param second Second hashset to swap.
      *
@@ -3678,8 +4900,8 @@ namespace hud
      * hud::swap(a, b); // a now has 4,5 ; b has 1,2,3
      * ```
      */
-    template<typename key_t, typename hasher_t, typename key_equal_t, typename allocator_t>
-    constexpr void swap(hashset<key_t, hasher_t, key_equal_t, allocator_t> &first, hashset<key_t, hasher_t, key_equal_t, allocator_t> &second) noexcept
+    template<typename key_t, typename hasher_t, typename key_equal_t, typename allocator_t, typename policy_t>
+    constexpr void swap(hashset<key_t, hasher_t, key_equal_t, allocator_t, policy_t> &first, hashset<key_t, hasher_t, key_equal_t, allocator_t, policy_t> &second) noexcept
     {
         first.swap(second);
     }
@@ -3697,6 +4919,7 @@ namespace hud
      * @tparam hasher_t The hasher type.
      * @tparam key_equal_t The key equality comparator type.
      * @tparam allocator_t The allocator type.
+     * @tparam policy_t The load and growth policy.
      * @param left First hashset.
      * @param right Second hashset.
      * @return `true` if the hashsets contain the same elements; `false` otherwise.
@@ -3708,8 +4931,8 @@ namespace hud
      * bool are_equal = (a == b); // true
      * ```
      */
-    template<typename key_t, typename hasher_t, typename key_equal_t, typename allocator_t>
-    [[nodiscard]] constexpr bool operator==(const hashset<key_t, hasher_t, key_equal_t, allocator_t> &left, const hashset<key_t, hasher_t, key_equal_t, allocator_t> &right) noexcept
+    template<typename key_t, typename hasher_t, typename key_equal_t, typename allocator_t, typename policy_t>
+    [[nodiscard]] constexpr bool operator==(const hashset<key_t, hasher_t, key_equal_t, allocator_t, policy_t> &left, const hashset<key_t, hasher_t, key_equal_t, allocator_t, policy_t> &right) noexcept
     {
         // Map are not equal if the counts of elements differ
         if (left.count() != right.count())
@@ -3719,8 +4942,8 @@ namespace hud
 
         // Speed of find is dependent of the max_slot_count_
         // We want to find in the smallest max_slot_count and iterate on the bigger only once
-        const hashset<key_t, hasher_t, key_equal_t, allocator_t> *biggest_capacity = &left;
-        const hashset<key_t, hasher_t, key_equal_t, allocator_t> *smallest_capacity = &right;
+        const hashset<key_t, hasher_t, key_equal_t, allocator_t, policy_t> *biggest_capacity = &left;
+        const hashset<key_t, hasher_t, key_equal_t, allocator_t, policy_t> *smallest_capacity = &right;
         if (smallest_capacity->max_count() > biggest_capacity->max_count())
         {
             hud::swap(biggest_capacity, smallest_capacity);
@@ -0,0 +1,47 @@
+#ifndef HD_INC_CORE_HASHSET_POLICY_H
+#define HD_INC_CORE_HASHSET_POLICY_H
+#include "../types.h"
+
+namespace hud
+{
+    /**
+     * Load and growth policy of `hud::hashset` and `hud::hashmap`.
+     *
+     * The table grows when its elements and deleted slots reach `max_load_factor_numerator / max_load_factor_denominator` of the slots.
+     * The number of slots is then multiplied by `growth_factor`.
+     * A high max load factor saves memory but makes probing longer. A low max load factor makes probing shorter but uses more memory.
+     *
+     * The policy is validated against the group size:
+     * - The max load factor can not exceed 15/16, a group of 16 slots keeps at least one empty slot on average
+     *   so a lookup of a missing key stops after few groups.
+     * - Whatever the max load factor, a table of at least one group always keeps one empty slot.
+     * - The growth factor is a power of two because the number of slots is always a power of two.
+     *
+     * @tparam max_load_factor_numerator The numerator of the max load factor
+     * @tparam max_load_factor_denominator The denominator of the max load factor
+     * @tparam growth_factor The factor applied to the number of slots when the table grows
+     */
+    template<usize max_load_factor_numerator, usize max_load_factor_denominator, usize growth_factor = 2u>
+    requires(max_load_factor_numerator > 0u && max_load_factor_numerator * 16u <= max_load_factor_denominator * 15u && growth_factor >= 2u && (growth_factor & (growth_factor - 1u)) == 0u)
+    struct hashset_policy
+    {
+        /** The numerator of the max load factor. */
+        static constexpr usize MAX_LOAD_FACTOR_NUMERATOR = max_load_factor_numerator;
+        /** The denominator of the max load factor. */
+        static constexpr usize MAX_LOAD_FACTOR_DENOMINATOR = max_load_factor_denominator;
+        /** The factor applied to the number of slots when the table grows. */
+        static constexpr usize GROWTH_FACTOR = growth_factor;
+    };
+
+    /** Policy that grows at 7/8 of the slots and doubles the number of slots. */
+    using default_hashset_policy = hashset_policy<7u, 8u>;
+
+    /** Policy that grows at 9/10 of the slots, for large tables that are mostly read and must use less memory. */
+    using dense_hashset_policy = hashset_policy<9u, 10u>;
+
+    /** Policy that grows at half of the slots, for latency-critical tables that must probe as few groups as possible. */
+    using sparse_hashset_policy = hashset_policy<1u, 2u>;
+
+} // namespace hud
+
+#endif // HD_INC_CORE_HASHSET_POLICY_H
@@ -549,6 +549,33 @@ namespace hud
         }
     };
 
+    template<typename FirstType, typename SecondType>
+    struct wyhash_64<hud::pair<FirstType, SecondType>>
+    {
+        [[nodiscard]] constexpr u64 operator()(const hud::pair<FirstType, SecondType> &t) const noexcept
+        {
+            wyhasher_64 hasher;
+            hasher.hash(t.first);
+            hasher.hash(t.second);
+            return hasher.result();
+        }
+    };
+
+    template<typename FirstType, typename SecondType>
+    struct keyed_hash_64<hud::pair<FirstType, SecondType>>
+        : details::keyed_hash_64_seed
+    {
+        using details::keyed_hash_64_seed::keyed_hash_64_seed;
+
+        [[nodiscard]] constexpr u64 operator()(const hud::pair<FirstType, SecondType> &t) const noexcept
+        {
+            keyed_hasher_64 hasher {seed()};
+            hasher.hash(t.first);
+            hasher.hash(t.second);
+            return hasher.result();
+        }
+    };
+
 } // namespace hud
 
 #endif // HD_INC_CORE_PAIR_H
\ No newline at end of file
@@ -0,0 +1,361 @@
+#ifndef HD_INC_CORE_READ_MOSTLY_HASHMAP_H
+#define HD_INC_CORE_READ_MOSTLY_HASHMAP_H
+#include "hashmap.h"
+#include "concurrent_hashmap.h"
+#include "unique_pointer.h"
+#include "vector.h"
+
+namespace hud
+{
+    namespace details::read_mostly_hashmap
+    {
+        /**
+         * Slot owned by a reader.
+         * Each slot is alone on its cache line: a reader only writes its own slot and never a cache line shared with other threads.
+         */
+        struct alignas(64) reader_slot
+        {
+            /** Epoch pinned by the reader while it reads the map, 0 when it does not read. */
+            hud::atomic<u64> epoch {0};
+            /** 1 when the slot is owned by a reader, 0 otherwise. */
+            hud::atomic<u32> is_used {0};
+        };
+
+        /**
+         * A version of the map replaced by a writer, waiting for the readers that may still read it.
+         * @tparam map_t The hash map type
+         */
+        template<typename map_t>
+        struct retired_map
+        {
+            /** The replaced map. */
+            map_t *map;
+            /** Epoch of the map when it was replaced. Readers that pinned a greater epoch cannot read it. */
+            u64 epoch;
+        };
+
+    } // namespace details::read_mostly_hashmap
+
+    /**
+     * A hash map optimized for many concurrent readers and rare writers.
+     *
+     * Readers never take a lock and never write a shared cache line: they read an immutable version of the map.
+     * Writers are serialized, each write copies the current version, modifies the copy and publishes it atomically.
+     * A write costs a copy of the whole map, use `update` to apply several modifications with a single copy.
+     *
+     * Replaced versions are reclaimed with an epoch based scheme. The map has a global epoch incremented by each write.
+     * A reader announces the epoch it reads in its own slot before loading the current version.
+     * A version replaced at epoch E is freed by a writer once no reader has announced an epoch lower or equal to E.
+     *
+     * Readers must register to get a `reader` handle owning a slot. A handle is used by one thread at a time,
+     * usually a handle is registered once per thread. At most `max_reader_count_v` handles exist at the same time.
+     *
+     * Example:
+     * ```cpp
+     * hud::read_mostly_hashmap<u32, route> routes;
+     * routes.add(42, route {...});             // Writer thread
+     *
+     * auto reader = routes.register_reader(); // Reader thread
+     * hud::optional<route> r = reader.find(42);
+     * ```
+     *
+     * @tparam key_t The key type
+     * @tparam value_t The value type
+     * @tparam hasher_t The hasher type
+     * @tparam key_equal_t The key equality comparator type
+     * @tparam allocator_t The allocator type used by each version of the map
+     * @tparam max_reader_count_v Maximum number of reader handles that exist at the same time
+     */
+    template<
+        typename key_t,
+        typename value_t,
+        typename hasher_t = hud::hash_64<key_t>,
+        typename key_equal_t = hud::equal<key_t>,
+        typename allocator_t = hud::heap_allocator,
+        usize max_reader_count_v = 64>
+    class read_mostly_hashmap
+    {
+    public:
+        /** Type of a version of the map. */
+        using map_type = hud::hashmap<key_t, value_t, hasher_t, key_equal_t, allocator_t>;
+        /** Type of the key. */
+        using key_type = typename map_type::key_type;
+        /** Type of the value. */
+        using value_type = typename map_type::value_type;
+
+        /** Maximum number of reader handles that exist at the same time. */
+        static constexpr usize MAX_READER_COUNT {max_reader_count_v};
+
+        /**
+         * Handle used by a thread to read the map.
+         * Obtained with `register_reader()`, the handle releases its slot when destroyed and must not outlive the map.
+         */
+        class reader
+        {
+        public:
+            /** Move constructor. The moved handle becomes invalid. */
+            reader(reader &&other) noexcept
+                : map_(other.map_)
+                , slot_(other.slot_)
+            {
+                other.slot_ = nullptr;
+            }
+
+            /** Releases the slot of the handle. */
+            ~reader() noexcept
+            {
+                if (slot_ != nullptr)
+                {
+                    slot_->is_used.store(0, hud::atomics::memory_order_e::release);
+                }
+            }
+
+            /** Checks whether the handle owns a slot. A handle is invalid if `MAX_READER_COUNT` readers are already registered. */
+            [[nodiscard]] bool is_valid() const noexcept
+            {
+                return slot_ != nullptr;
+            }
+
+            /**
+             * Calls a function with the current version of the map.
+             *
+             * The version is immutable and stays alive until `function` returns, a function can do several lookups in the same version.
+             * `function` must not call `read` with the same handle. It can write to the map, the writes are not visible in the version it reads.
+             *
+             * @param function Called with `const map_type &`.
+             * @return The value returned by `function`.
+             */
+            template<typename function_t>
+            decltype(auto) read(function_t &&function) noexcept
+            {
+                HUD_CHECK(is_valid() && "Reader is not registered");
+                // Announce the epoch before loading the version.
+                // The fence pairs with the fence of the writer: either the writer sees this epoch, or this reader sees the new version.
+                slot_->epoch.store(map_->epoch_.load(hud::atomics::memory_order_e::acquire), hud::atomics::memory_order_e::relaxed);
+                hud::atomics::thread_fence(hud::atomics::memory_order_e::seq_cst);
+                unpin_guard guard {slot_};
+                return function(*static_cast<const map_type *>(map_->current_.load(hud::atomics::memory_order_e::acquire)));
+            }
+
+            /**
+             * Finds an element by key and returns a copy of its value.
+             * @param key The key to search for.
+             * @return A copy of the value if the key is found, an empty optional otherwise.
+             */
+            template<typename K>
+            [[nodiscard]] hud::optional<value_type> find(K &&key) noexcept
+            {
+                return read([&key](const map_type &map) -> hud::optional<value_type> {
+                    const auto it {map.find(hud::forward<K>(key))};
+                    if (it == map.end())
+                    {
+                        return hud::nullopt;
+                    }
+                    return it->value();
+                });
+            }
+
+            /**
+             * Checks whether the key exists in the map.
+             * @param key The key to search for.
+             * @return `true` if the key is found, `false` otherwise.
+             */
+            template<typename K>
+            [[nodiscard]] bool contains(K &&key) noexcept
+            {
+                return read([&key](const map_type &map) {
+                    return map.contains(hud::forward<K>(key));
+                });
+            }
+
+        private:
+            friend class read_mostly_hashmap;
+
+            /** Construct a handle owning `slot`, invalid if `slot` is nullptr. */
+            reader(read_mostly_hashmap *map, details::read_mostly_hashmap::reader_slot *slot) noexcept
+                : map_(map)
+                , slot_(slot)
+            {
+            }
+
+            /** Clears the epoch announced by a reader at the end of the scope. */
+            struct unpin_guard
+            {
+                details::read_mostly_hashmap::reader_slot *slot;
+
+                ~unpin_guard() noexcept
+                {
+                    slot->epoch.store(0, hud::atomics::memory_order_e::release);
+                }
+            };
+
+            /** Not copyable. */
+            reader(const reader &) = delete;
+            reader &operator=(const reader &) = delete;
+
+        private:
+            /** The map read by the handle. */
+            read_mostly_hashmap *map_;
+            /** The slot owned by the handle. */
+            details::read_mostly_hashmap::reader_slot *slot_;
+        };
+
+        /** Default constructor. Constructs an empty map. */
+        explicit read_mostly_hashmap() noexcept
+            : current_(hud::make_unique<map_type>().leak())
+        {
+        }
+
+        /** Destroys the map. No reader must be reading it. */
+        ~read_mostly_hashmap() noexcept
+        {
+            reclaim();
+            HUD_CHECK(retired_.count() == 0 && "A reader is still reading the map");
+            hud::default_deleter<map_type> {}(current_.load(hud::atomics::memory_order_e::relaxed));
+        }
+
+        /** Not copyable, not movable. */
+        read_mostly_hashmap(const read_mostly_hashmap &) = delete;
+        read_mostly_hashmap &operator=(const read_mostly_hashmap &) = delete;
+
+        /**
+         * Registers a reader.
+         * @return A handle owning a reader slot, invalid if `MAX_READER_COUNT` handles already exist.
+         */
+        [[nodiscard]] reader register_reader() noexcept
+        {
+            for (details::read_mostly_hashmap::reader_slot &slot : reader_slots_)
+            {
+                u32 is_used {0};
+                if (slot.is_used.compare_exchange(is_used, 1, hud::atomics::memory_order_e::acquire))
+                {
+                    return reader {this, &slot};
+                }
+            }
+            return reader {this, nullptr};
+        }
+
+        /**
+         * Modifies the map.
+         *
+         * `function` receives a copy of the current version, the copy is published when `function` returns.
+         * Writers are serialized, readers keep reading the previous version until the copy is published.
+         *
+         * @param function Called with `map_type &`.
+         */
+        template<typename function_t>
+        void update(function_t &&function) noexcept
+        {
+            details::concurrent_hashmap::unique_lock_guard guard {writer_lock_};
+            map_type *old_map {current_.load(hud::atomics::memory_order_e::relaxed)};
+            hud::unique_pointer<map_type> new_map {hud::make_unique<map_type>(*old_map)};
+            function(*new_map);
+            current_.store(new_map.leak(), hud::atomics::memory_order_e::release);
+
+            // Readers that announce an epoch from now read the new version
+            const u64 epoch {epoch_.load(hud::atomics::memory_order_e::relaxed)};
+            retired_.emplace_back(old_map, epoch);
+            epoch_.store(epoch + 1, hud::atomics::memory_order_e::release);
+            reclaim_retired_maps();
+        }
+
+        /**
+         * Inserts a key-value pair if the key does not exist.
+         * @param key The key to insert.
+         * @param value The value to insert.
+         * @return `true` if the pair is inserted, `false` if the key already exists.
+         */
+        template<typename u_key_t = key_t, typename u_value_t = value_t>
+        bool add(u_key_t &&key, u_value_t &&value) noexcept
+        {
+            bool is_added {false};
+            update([&](map_type &map) {
+                const usize count_before {map.count()};
+                map.add(hud::forward<u_key_t>(key), hud::forward<u_value_t>(value));
+                is_added = map.count() != count_before;
+            });
+            return is_added;
+        }
+
+        /**
+         * Removes an element by key if it exists.
+         * @param key The key to remove.
+         * @return `true` if the key is removed, `false` if it does not exist.
+         */
+        template<typename K>
+        bool remove(K &&key) noexcept
+        {
+            bool is_removed {false};
+            update([&](map_type &map) {
+                const usize count_before {map.count()};
+                map.remove(hud::forward<K>(key));
+                is_removed = map.count() != count_before;
+            });
+            return is_removed;
+        }
+
+        /**
+         * Frees the replaced versions that no reader can read anymore.
+         * Writes already do it, call it to release memory when no write is expected.
+         */
+        void reclaim() noexcept
+        {
+            details::concurrent_hashmap::unique_lock_guard guard {writer_lock_};
+            reclaim_retired_maps();
+        }
+
+        /** Retrieves the number of replaced versions not freed yet. */
+        [[nodiscard]] usize retired_count() noexcept
+        {
+            details::concurrent_hashmap::unique_lock_guard guard {writer_lock_};
+            return retired_.count();
+        }
+
+    private:
+        /** Frees the replaced versions that no reader can read anymore. The writer lock must be held. */
+        void reclaim_retired_maps() noexcept
+        {
+            // Pairs with the fence of the readers, see `reader::read`
+            hud::atomics::thread_fence(hud::atomics::memory_order_e::seq_cst);
+            u64 min_reader_epoch {hud::u64_max};
+            for (const details::read_mostly_hashmap::reader_slot &slot : reader_slots_)
+            {
+                const u64 epoch {slot.epoch.load(hud::atomics::memory_order_e::acquire)};
+                if (epoch != 0 && epoch < min_reader_epoch)
+                {
+                    min_reader_epoch = epoch;
+                }
+            }
+
+            // A version replaced at epoch E can be read by readers that announced an epoch lower or equal to E
+            usize kept_count {0};
+            for (usize index = 0; index < retired_.count(); index++)
+            {
+                if (retired_[index].epoch < min_reader_epoch)
+                {
+                    hud::default_deleter<map_type> {}(retired_[index].map);
+                }
+                else
+                {
+                    retired_[kept_count++] = retired_[index];
+                }
+            }
+            retired_.resize(kept_count);
+        }
+
+    private:
+        /** Slots of the readers, written only by the reader that owns it. */
+        details::read_mostly_hashmap::reader_slot reader_slots_[MAX_READER_COUNT];
+        /** The current version of the map. */
+        alignas(64) hud::atomic<map_type *> current_;
+        /** The global epoch, incremented by each write. Starts at 1, 0 means "not reading" in a reader slot. */
+        hud::atomic<u64> epoch_ {1};
+        /** Serializes writers. */
+        alignas(64) details::concurrent_hashmap::shared_spin_lock writer_lock_;
+        /** Replaced versions not freed yet, ordered by epoch. Accessed only with the writer lock. */
+        hud::vector<details::read_mostly_hashmap::retired_map<map_type>> retired_;
+    };
+
+} // namespace hud
+
+#endif // HD_INC_CORE_READ_MOSTLY_HASHMAP_H
@@ -22,6 +22,7 @@
 #include "../traits/void_t.h"
 
 #include "../allocators/memory_allocation.h"
+#include "../allocators/pool_allocator.h"
 #include "../hash.h"
 #include "../templates/declval.h"
 #include "../templates/default_deleter.h"
@@ -96,6 +97,12 @@ namespace hud
             /** Override this function to destroyed the owned object. */
             constexpr virtual void destroy_object() = 0;
 
+            /** Override this function to change how the controller is deleted when the weak counter reach 0. */
+            constexpr virtual void delete_controller() noexcept
+            {
+                delete this;
+            }
+
             /** Retrieves the shared counter. */
             [[nodiscard]] constexpr u32 get_shared_count() const noexcept
             {
@@ -150,7 +157,7 @@ namespace hud
 
                 if (--(controller->weak_count) == 0u)
                 {
-                    delete controller;
+                    controller->delete_controller();
                 }
             }
 
@@ -185,6 +192,12 @@ namespace hud
             /** Override this function to destroyed the owned object. */
             constexpr virtual void destroy_object() = 0;
 
+            /** Override this function to change how the controller is deleted when the weak counter reach 0. */
+            virtual void delete_controller() noexcept
+            {
+                delete this;
+            }
+
             /** Retrieves the shared counter. */
             [[nodiscard]] u32 get_shared_count() const noexcept
             {
@@ -239,7 +252,7 @@ namespace hud
 
                 if (controller->weak_count.decrement() == 0u)
                 {
-                    delete controller;
+                    controller->delete_controller();
                 }
             }
 
@@ -340,6 +353,45 @@ namespace hud
             aligned_buffer<sizeof(type_t), alignof(type_t)> buffer;
         };
 
+        /**
+         * The reference controller that contains type_t and is allocated with an allocator instead of new.
+         * The controller keeps a copy of the allocator to free itself.
+         * @tparam type_t Type of the pointer to own
+         * @tparam thread_safety The reference counting thread safety to use while counting shared and weak references
+         * @tparam allocator_t Type of the allocator used to allocate the controller
+         */
+        template<typename type_t, thread_safety_e thread_safety, typename allocator_t>
+        class reference_controller_no_deleter_with_allocator
+            : public reference_controller_no_deleter<type_t, thread_safety>
+        {
+
+        public:
+            /**
+             * Construct a reference_controller_no_deleter_with_allocator from the allocator and a list or arguments forward to the type_t constructor.
+             * @tparam Args Types of arguments forward to the type_t constructor
+             * @param allocator The allocator used to allocate the controller
+             * @param args Arguments forward to the type_t constructor
+             */
+            template<typename... args_t>
+            explicit reference_controller_no_deleter_with_allocator(const allocator_t &allocator, args_t &&...args) noexcept
+                : reference_controller_no_deleter<type_t, thread_safety>(hud::forward<args_t>(args)...)
+                , allocator_(allocator)
+            {
+            }
+
+            /** Destroy the controller and free it with the allocator. */
+            void delete_controller() noexcept final
+            {
+                allocator_t allocator = allocator_;
+                hud::memory::destroy_object(this);
+                allocator.free(hud::memory_allocation<reference_controller_no_deleter_with_allocator>(this, 1u));
+            }
+
+        private:
+            /** The allocator used to allocate the controller. */
+            allocator_t allocator_;
+        };
+
         /**
          * The reference controller that contains an aligned pointer to an array of type_t.
          * @tparam type_t Type of the pointer to own
@@ -1079,6 +1131,9 @@ namespace hud
         template<typename u_type_t, thread_safety_e thread_safety_1, typename... args_t>
         // requires(!is_array_v<u_type_t>)
         friend shared_pointer<u_type_t, thread_safety_1> make_shared(args_t &&...args) noexcept;
+        template<typename u_type_t, thread_safety_e thread_safety_1, typename... args_t>
+        requires(!hud::is_array_v<u_type_t>)
+        friend shared_pointer<u_type_t, thread_safety_1> make_shared(hud::pool_allocator allocator, args_t &&...args) noexcept;
         template<typename u_type_t, thread_safety_e thread_safety_1>
         requires(hud::is_unbounded_array_v<u_type_t>)
         friend shared_pointer<u_type_t, thread_safety_1> make_shared(const usize count) noexcept;
@@ -1413,6 +1468,30 @@ namespace hud
         return shared_pointer<type_t, thread_safety>(new (std::nothrow) details::reference_controller_no_deleter<type_t, thread_safety>(count));
     }
 
+    /**
+     * Constructs a shared_pointer that owns a pointer of type type_t allocated in a pool. The arguments are forward to the constructor of type_t.
+     * The object and its reference controller are allocated in a single block of the pool and are freed in the pool.
+     * The block is freed by the thread that releases the last reference, use `thread_safety_e::safe` to share the object between threads.
+     * This overload only participates in overload resolution if type_t is not an array type
+     * @tparam type_t Type of the shared_pointer's pointer
+     * @tparam thread_safety The thread safety of SharePointer
+     * @tparam args_t Types of arguments forward to the type_t constructor
+     * @param allocator The pool allocator used to allocate the object
+     * @param args Arguments forward to the type_t constructor
+     * @return shared_pointer<type_t, thread_safety> pointing to a object of type type_t construct by passing args arguments to its constructor, empty if the allocation failed
+     */
+    template<typename type_t, thread_safety_e thread_safety = thread_safety_e::not_safe, typename... args_t>
+    requires(!hud::is_array_v<type_t>)
+    [[nodiscard]] HD_FORCEINLINE shared_pointer<type_t, thread_safety> make_shared(hud::pool_allocator allocator, args_t &&...args) noexcept
+    {
+        using controller_type = details::reference_controller_no_deleter_with_allocator<type_t, thread_safety, hud::pool_allocator>;
+        const hud::memory_allocation<controller_type> allocation = allocator.template allocate<controller_type>(1u);
+        if (allocation.is_empty()) [[unlikely]] {
+            return shared_pointer<type_t, thread_safety>();
+        }
+        return shared_pointer<type_t, thread_safety>(hud::memory::construct_object_at(allocation.data(), allocator, hud::forward<args_t>(args)...));
+    }
+
     /** Specialization of the hash function for shared_pointer */
     template<typename type_t, thread_safety_e thread_safety>
     struct hash_32<shared_pointer<type_t, thread_safety>>
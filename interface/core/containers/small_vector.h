@@ -0,0 +1,823 @@
+#ifndef HD_INC_CORE_SMALL_VECTOR_H
+#define HD_INC_CORE_SMALL_VECTOR_H
+#include "../minimal.h"
+#include "../allocators/aligned_heap_allocator.h"
+#include "../allocators/allocator_traits.h"
+#include "../memory.h"
+#include "../traits/is_constructible.h"
+#include "../traits/is_copy_constructible.h"
+#include "../traits/is_move_constructible.h"
+#include "../traits/is_bitwise_move_constructible.h"
+#include "../traits/is_nothrow_swappable.h"
+#include "../traits/is_comparable_with_equal_operator.h"
+#include "../slice.h"
+#include "../assert.h"
+#include "../templates/forward.h"
+#include "../templates/move.h"
+#include "../iterators/random_access_iterator.h"
+#include "aligned_buffer.h"
+#include "compressed_pair.h"
+#include <initializer_list>
+
+namespace hud
+{
+
+    /**
+     * small_vector is a sequence of elements of the same type that keeps the first `inline_count` elements inside the object itself.
+     * While the count of elements fit in the inline storage, no allocation is done.
+     * When the small_vector need to grow beyond the inline storage, elements are relocated in an allocation done with the allocator
+     * and the new capacity is given by the `growth_policy` of the allocator traits.
+     * Because the inline storage is an array of bytes, small_vector is not usable in a constant evaluated expression.
+     * @tparam type_t The element type
+     * @tparam inline_count The count of elements stored inline
+     * @tparam allocator_t The allocator to use when the elements do not fit in the inline storage
+     */
+    template<typename type_t, usize inline_count, typename allocator_t = hud::aligned_heap_allocator<alignof(type_t)>>
+    requires(inline_count > 0u)
+    class small_vector
+    {
+
+    public:
+        /** the type contained in the small_vector. */
+        using value_type = type_t;
+
+        /** The type of the allocator used. */
+        using allocator_type = allocator_t;
+
+        /** The type of allocation done by the allocator. */
+        using memory_allocation_type = typename allocator_type::template memory_allocation_type<type_t>;
+
+        /** Mutable small_vector iterator type. */
+        using iterator = random_access_iterator<type_t *>;
+
+        /** Constant small_vector iterator type. */
+        using const_iterator = random_access_iterator<const type_t *>;
+
+        /** The count of elements stored inline. */
+        static constexpr usize INLINE_COUNT = inline_count;
+
+        /**  Default constructor. */
+        small_vector() noexcept
+            : compressed_allocator_(allocator_type(), inline_count)
+            , begin_ptr(inline_data())
+            , end_ptr(begin_ptr)
+        {
+        }
+
+        /**
+         * Construct an empty small_vector with the given allocator.
+         * @param allocator The allocator instance to use. Copy the allocator.
+         */
+        explicit small_vector(const allocator_type &allocator) noexcept
+            : compressed_allocator_(allocator, inline_count)
+            , begin_ptr(inline_data())
+            , end_ptr(begin_ptr)
+        {
+        }
+
+        /**
+         * Copy construct from a std::initializer_list of u_type_t.
+         * @tparam u_type_t The element type of the std::initializer_list
+         * @param list The std::initializer_list to copy
+         * @param allocator (Optional) The allocator instance to use. Copy the allocator.
+         */
+        template<typename u_type_t>
+        requires(hud::is_copy_constructible_v<type_t, u_type_t>)
+        small_vector(std::initializer_list<u_type_t> list, const allocator_type &allocator = allocator_type()) noexcept
+            : small_vector(allocator)
+        {
+            reserve(list.size());
+            hud::memory::copy_construct_array(begin_ptr, list.begin(), list.size());
+            end_ptr = begin_ptr + list.size();
+        }
+
+        /**
+         * Copy construct from another small_vector.
+         * @param other The other small_vector to copy
+         */
+        small_vector(const small_vector &other) noexcept
+        requires(hud::is_copy_constructible_v<type_t>)
+            : small_vector(other.allocator())
+        {
+            reserve(other.count());
+            hud::memory::copy_construct_array(begin_ptr, other.data(), other.count());
+            end_ptr = begin_ptr + other.count();
+        }
+
+        /**
+         * Move construct from another small_vector.
+         * If the other small_vector is allocated, the allocation is stolen, else elements are relocated in the inline storage.
+         * @param other The other small_vector to move
+         */
+        small_vector(small_vector &&other) noexcept
+        requires(hud::is_move_constructible_v<type_t> || hud::is_copy_constructible_v<type_t>)
+            : compressed_allocator_(hud::move(other.allocator_()), inline_count)
+            , begin_ptr(inline_data())
+            , end_ptr(begin_ptr)
+        {
+            // The allocator is moved, the allocation of the other small_vector can be stolen
+            take_elements_of(other, true);
+        }
+
+        /**
+         * Destructor.
+         * Call all the destructor of each element in the small_vector if not trivially destructible, then free the allocated memory if any.
+         */
+        ~small_vector() noexcept
+        {
+            hud::memory::destroy_object_array(begin_ptr, count());
+            free_allocation();
+        }
+
+        /**
+         * Copy assign another small_vector.
+         * @param other The other small_vector to copy
+         * @return *this
+         */
+        small_vector &operator=(const small_vector &other) noexcept
+        requires(hud::is_copy_constructible_v<type_t>)
+        {
+            if (this != &other) [[likely]] {
+                clear();
+                if constexpr (hud::allocator_traits<allocator_type>::copy_when_container_copy_assigned::value) {
+                    shrink_to_fit();
+                    allocator_() = other.allocator();
+                }
+                reserve(other.count());
+                hud::memory::copy_construct_array(begin_ptr, other.data(), other.count());
+                end_ptr = begin_ptr + other.count();
+            }
+            return *this;
+        }
+
+        /**
+         * Move assign another small_vector.
+         * If the other small_vector is allocated and the allocation can be freed by this allocator, the allocation is stolen, else elements are moved.
+         * @param other The other small_vector to move
+         * @return *this
+         */
+        small_vector &operator=(small_vector &&other) noexcept
+        requires(hud::is_move_constructible_v<type_t> || hud::is_copy_constructible_v<type_t>)
+        {
+            if (this != &other) [[likely]] {
+                clear();
+                shrink_to_fit();
+                if constexpr (hud::allocator_traits<allocator_type>::move_when_container_move_assigned::value) {
+                    allocator_() = hud::move(other.allocator_());
+                    take_elements_of(other, true);
+                }
+                else {
+                    take_elements_of(other, hud::allocator_traits<allocator_type>::is_always_equal::value);
+                }
+            }
+            return *this;
+        }
+
+        /**
+         * Appends a new element to the end of the container by calling the constructor in-place.
+         * If the new count() is greater than max_count() then all iterators and references are invalidated.
+         * @tparam args_t The type_t constructor arguments
+         * @param args Arguments to forward to the constructor of the element
+         * @return Index of the newly created element
+         */
+        template<typename... args_t>
+        requires(hud::is_constructible_v<type_t, args_t...>)
+        usize emplace_back(args_t &&...args) noexcept
+        {
+            const usize old_count = count();
+            const usize new_count = old_count + 1u;
+
+            // If we don't have enough place in the storage we need to allocate.
+            if (new_count > max_count()) [[unlikely]] {
+                memory_allocation_type new_allocation = allocator_().template allocate<type_t>(grow_max_count(new_count));
+                // Construct the element before relocating, arguments can reference an element of the small_vector
+                hud::memory::construct_object_at(new_allocation.data_at(old_count), hud::forward<args_t>(args)...);
+                hud::memory::fast_move_or_copy_construct_object_array_then_destroy(new_allocation.data(), begin_ptr, old_count);
+                replace_storage(hud::move(new_allocation), new_count);
+            }
+            else {
+                hud::memory::construct_object_at(end_ptr, hud::forward<args_t>(args)...);
+                end_ptr++;
+            }
+            return old_count;
+        }
+
+        /**
+         * Appends a new element to the end of the container by calling the constructor in-place.
+         * If the new count() is greater than max_count() then all iterators and references are invalidated.
+         * @tparam args_t The type_t constructor arguments
+         * @param args Arguments to forward to the constructor of the element
+         * @return Reference to the newly created element
+         */
+        template<typename... args_t>
+        requires(hud::is_constructible_v<type_t, args_t...>)
+        [[nodiscard]] type_t &emplace_back_to_ref(args_t &&...args) noexcept
+        {
+            const usize element_index = emplace_back(hud::forward<args_t>(args)...);
+            return begin_ptr[element_index];
+        }
+
+        /**
+         * Emplace a new element at the given index of the small_vector by calling the constructor in-place.
+         * If the new count() is greater than max_count() then all iterators and references are invalidated, else only the iterator after the given index are invalidated.
+         * @tparam args_t The type_t constructor arguments
+         * @param index The index of insertion
+         * @param args Arguments to forward to the constructor of the element
+         */
+        template<typename... args_t>
+        requires(hud::is_constructible_v<type_t, args_t...>)
+        void emplace_at(const usize index, args_t &&...args) noexcept
+        {
+            check(index <= count());
+            const usize old_count = count();
+            const usize new_count = old_count + 1u;
+
+            // If we don't have enough place in the storage we need to allocate.
+            if (new_count > max_count()) [[unlikely]] {
+                memory_allocation_type new_allocation = allocator_().template allocate<type_t>(grow_max_count(new_count));
+                // Construct the element before relocating, arguments can reference an element of the small_vector
+                hud::memory::construct_object_at(new_allocation.data_at(index), hud::forward<args_t>(args)...);
+                // Relocate others before and after the emplaced element
+                hud::memory::fast_move_or_copy_construct_object_array_then_destroy(new_allocation.data(), begin_ptr, index);
+                hud::memory::fast_move_or_copy_construct_object_array_then_destroy(new_allocation.data_at(index + 1u), begin_ptr + index, old_count - index);
+                replace_storage(hud::move(new_allocation), new_count);
+            }
+            else {
+                // Relocate others after the emplaced element
+                type_t *emplace_ptr = begin_ptr + index;
+                hud::memory::move_or_copy_construct_object_array_then_destroy_backward(emplace_ptr + 1, emplace_ptr, old_count - index);
+                hud::memory::construct_object_at(emplace_ptr, hud::forward<args_t>(args)...);
+                end_ptr++;
+            }
+        }
+
+        /**
+         * Emplace a new element at the given index of the small_vector by calling the constructor in-place.
+         * If the new count() is greater than max_count() then all iterators and references are invalidated, else only the iterator after the given index are invalidated.
+         * @tparam args_t The type_t constructor arguments
+         * @param index The index of insertion
+         * @param args Arguments to forward to the constructor of the element
+         * @return Reference to the newly created element
+         */
+        template<typename... args_t>
+        requires(hud::is_constructible_v<type_t, args_t...>)
+        [[nodiscard]] type_t &emplace_at_to_ref(const usize index, args_t &&...args) noexcept
+        {
+            emplace_at(index, hud::forward<args_t>(args)...);
+            return begin_ptr[index];
+        }
+
+        /**
+         * Append by copying a new element to the end of the container.
+         * If the new count() is greater than max_count() then all iterators and references are invalidated.
+         * @param element The element to copy to the end of the container
+         * @return Index of the newly added element
+         */
+        usize add(const type_t &element) noexcept
+        {
+            return emplace_back(element);
+        }
+
+        /**
+         * Append by moving a new element to the end of the container.
+         * If the new count() is greater than max_count() then all iterators and references are invalidated.
+         * @param element The element to move to the end of the container
+         * @return Index of the newly added element
+         */
+        usize add(type_t &&element) noexcept
+        {
+            return emplace_back(hud::move(element));
+        }
+
+        /**
+         * Add number of elements at the end of the small_vector and grow the storage if needed but do not call any constructor or setting memory to zero.
+         * If the new count() is greater than max_count() then all iterators and references are invalidated.
+         * Use this with caution, elements constructor are not called but destructor will be called on elements that do not call their constructor, this can lead to UB or crash.
+         * @param element_number Number of element to add
+         * @return Index of the first element added
+         */
+        usize add_no_construct(const usize element_number) noexcept
+        {
+            const usize old_count = count();
+            const usize new_count = old_count + element_number;
+            if (new_count > max_count()) {
+                reserve(grow_max_count(new_count));
+            }
+            end_ptr = begin_ptr + new_count;
+            return old_count;
+        }
+
+        /**
+         * Remove number of elements in the small_vector from a given index.
+         * Elements after the removed elements are relocated, the storage is not shrink.
+         * @param index The index to remove
+         * @param count_to_remove (Optional) Count of elements to remove. Default is 1.
+         */
+        void remove_at(const usize index, const usize count_to_remove = 1) noexcept
+        {
+            check(index < count());
+            check(count_to_remove <= count() - index); // Remove more elements than possible
+            type_t *first_item_to_remove = begin_ptr + index;
+            type_t *first_item_to_relocate = first_item_to_remove + count_to_remove;
+            hud::memory::destroy_object_array(first_item_to_remove, count_to_remove);
+
+            // Relocate elements after the removed elements in forward order, buffers can overlap
+            const usize count_to_relocate = static_cast<usize>(end_ptr - first_item_to_relocate);
+            if constexpr (hud::is_bitwise_move_constructible_v<type_t>) {
+                hud::memory::move_memory(first_item_to_remove, first_item_to_relocate, count_to_relocate * sizeof(type_t));
+            }
+            else {
+                for (usize relocated = 0; relocated < count_to_relocate; relocated++) {
+                    hud::memory::move_or_copy_construct_object_then_destroy(first_item_to_remove + relocated, hud::move(first_item_to_relocate[relocated]));
+                }
+            }
+            end_ptr -= count_to_remove;
+        }
+
+        /**
+         * Resize the small_vector to ensure it contains a number of elements.
+         * Call defaut constructor or set memory to zero depending if the type is trivially constructible or not.
+         * @param element_number Number of element the small_vector must contains
+         */
+        void resize(const usize element_number) noexcept
+        {
+            const usize old_count = count();
+            if (element_number > old_count) {
+                add_no_construct(element_number - old_count);
+                hud::memory::default_construct_array(begin_ptr + old_count, end_ptr);
+            }
+            else if (element_number < old_count) {
+                remove_at(element_number, old_count - element_number);
+            }
+        }
+
+        /**
+         * Reserve enough memory to ensure the small_vector can contains a number of elements without reallocating.
+         * Do nothing if the given element number is less or equal the maximum element count.
+         * The growth policy is not applied, the small_vector allocates exactly `element_number` elements.
+         * @param element_number Number of element the small_vector must be able to contains in memory
+         */
+        void reserve(const usize element_number) noexcept
+        {
+            if (element_number > max_count()) {
+                const usize old_count = count();
+                memory_allocation_type new_allocation = allocator_().template allocate<type_t>(element_number);
+                hud::memory::fast_move_or_copy_construct_object_array_then_destroy(new_allocation.data(), begin_ptr, old_count);
+                replace_storage(hud::move(new_allocation), old_count);
+            }
+        }
+
+        /**
+         * Move elements back in the inline storage if they fit, or in an allocation that fit the number of elements otherwise.
+         * Do nothing if elements are already inline.
+         */
+        void shrink_to_fit() noexcept
+        {
+            if (is_inline()) {
+                return;
+            }
+            const usize old_count = count();
+            if (old_count <= INLINE_COUNT) {
+                type_t *inline_ptr = inline_data();
+                hud::memory::fast_move_or_copy_construct_object_array_then_destroy(inline_ptr, begin_ptr, old_count);
+                free_allocation();
+                begin_ptr = inline_ptr;
+                end_ptr = begin_ptr + old_count;
+                max_count_() = INLINE_COUNT;
+            }
+            else if (old_count < max_count()) {
+                memory_allocation_type new_allocation = allocator_().template allocate<type_t>(old_count);
+                hud::memory::fast_move_or_copy_construct_object_array_then_destroy(new_allocation.data(), begin_ptr, old_count);
+                replace_storage(hud::move(new_allocation), old_count);
+            }
+        }
+
+        /**
+         * Remove all elements from the small_vector.
+         * Call all the destructor of each element in the small_vector if not trivially destructible but do not free the allocated memory.
+         */
+        HD_FORCEINLINE void clear() noexcept
+        {
+            hud::memory::destroy_object_array(begin_ptr, count());
+            end_ptr = begin_ptr;
+        }
+
+        /** Retrieves number of elements in the small_vector. */
+        [[nodiscard]] HD_FORCEINLINE usize count() const noexcept
+        {
+            return static_cast<usize>(end_ptr - begin_ptr);
+        }
+
+        /** Retrieves number of elements in the small_vector in bytes. */
+        [[nodiscard]] HD_FORCEINLINE usize byte_count() const noexcept
+        {
+            return count() * sizeof(type_t);
+        }
+
+        /** Retrieves maximum number of elements the small_vector can contains without allocating. */
+        [[nodiscard]] HD_FORCEINLINE usize max_count() const noexcept
+        {
+            return compressed_allocator_.second();
+        }
+
+        /** Retrieves the number of elements the small_vector can contains before growing. */
+        [[nodiscard]] HD_FORCEINLINE usize slack() const noexcept
+        {
+            return max_count() - count();
+        }
+
+        /** Checks whether elements are stored in the inline storage. */
+        [[nodiscard]] HD_FORCEINLINE bool is_inline() const noexcept
+        {
+            return begin_ptr == inline_data();
+        }
+
+        /** Retrieves a reference to the allocator. */
+        [[nodiscard]] HD_FORCEINLINE const allocator_type &allocator() const noexcept
+        {
+            return allocator_();
+        }
+
+        /** Retrieves a pointer to the raw data. */
+        [[nodiscard]] HD_FORCEINLINE const type_t *data() const noexcept
+        {
+            return begin_ptr;
+        }
+
+        /** Retrieves a pointer to the raw data. */
+        [[nodiscard]] HD_FORCEINLINE type_t *data() noexcept
+        {
+            return begin_ptr;
+        }
+
+        /** Checks whether index is in valid range or not. */
+        [[nodiscard]] HD_FORCEINLINE bool is_valid_index(const usize index) const noexcept
+        {
+            return index < count();
+        }
+
+        /** Checks whether the small_vector is empty of not. */
+        [[nodiscard]] HD_FORCEINLINE bool is_empty() const noexcept
+        {
+            return end_ptr == begin_ptr;
+        }
+
+        /**
+         * Retrieves reference on the element at the given index.
+         * @param index The index of the element to retrieve
+         * @return Reference on the element at the given index
+         */
+        [[nodiscard]] HD_FORCEINLINE type_t &operator[](const usize index) noexcept
+        {
+            check(is_valid_index(index));
+            return begin_ptr[index];
+        }
+
+        /**
+         * Retrieves reference on the element at the given index.
+         * @param index The index of the element to retrieve
+         * @return Reference on the element at the given index
+         */
+        [[nodiscard]] HD_FORCEINLINE const type_t &operator[](const usize index) const noexcept
+        {
+            check(is_valid_index(index));
+            return begin_ptr[index];
+        }
+
+        /**
+         * Retrieves a sub-slice of the small_vector.
+         * @param first_index The index of the first element in the slice sequence
+         * @param count The number of elements the slice sequence must contains
+         * @return The sub-slice from data()+first_index over a sequence of count elements
+         */
+        [[nodiscard]] HD_FORCEINLINE slice<type_t> sub_slice(const usize first_index, const usize count) noexcept
+        {
+            return as_slice().sub_slice(first_index, count);
+        }
+
+        /**
+         * Retrieves a sub-slice of the small_vector.
+         * @param first_index The index of the first element in the slice sequence
+         * @param count The number of elements the slice sequence must contains
+         * @return The sub-slice from data()+first_index over a sequence of count elements
+         */
+        [[nodiscard]] HD_FORCEINLINE slice<const type_t> sub_slice(const usize first_index, const usize count) const noexcept
+        {
+            return as_slice().sub_slice(first_index, count);
+        }
+
+        /** Retrieves a slice over the elements of the small_vector. */
+        [[nodiscard]] HD_FORCEINLINE slice<type_t> as_slice() noexcept
+        {
+            return slice<type_t>(begin_ptr, count());
+        }
+
+        /** Retrieves a slice over the elements of the small_vector. */
+        [[nodiscard]] HD_FORCEINLINE slice<const type_t> as_slice() const noexcept
+        {
+            return slice<const type_t>(begin_ptr, count());
+        }
+
+        /** Retrieves reference on the first element. */
+        [[nodiscard]] HD_FORCEINLINE type_t &first() noexcept
+        {
+            return (*this)[0];
+        }
+
+        /** Retrieves reference on the first element. */
+        [[nodiscard]] HD_FORCEINLINE const type_t &first() const noexcept
+        {
+            return (*this)[0];
+        }
+
+        /** Retrieves reference on the last element. */
+        [[nodiscard]] HD_FORCEINLINE type_t &last() noexcept
+        {
+            return (*this)[count() - 1];
+        }
+
+        /** Retrieves reference on the last element. */
+        [[nodiscard]] HD_FORCEINLINE const type_t &last() const noexcept
+        {
+            return (*this)[count() - 1];
+        }
+
+        /**
+         * Swap with another small_vector.
+         * Inline elements are relocated, allocations are swapped.
+         * @param other The small_vector to swap with
+         */
+        void swap(small_vector &other) noexcept
+        {
+            static_assert(hud::is_nothrow_swappable_v<type_t>, "swap(small_vector<type_t>&) is throwable. small_vector is not designed to allow throwable swappable components");
+            if (this == &other) [[unlikely]] {
+                return;
+            }
+            small_vector tmp(hud::move(*this));
+            *this = hud::move(other);
+            other = hud::move(tmp);
+        }
+
+        /**
+         * Find the fist index of a given element where the predicate small_vector[index] == to_find is true.
+         * Given comparand must be comparable with type_t operator==.
+         * @param compared_t The comparand type used to compare
+         * @param to_find The element to find
+         * @return first index of the element where the predicate small_vector[index] == element is true, hud::index_none otherwise
+         */
+        template<typename compared_t>
+        requires(hud::is_comparable_with_equal_operator_v<type_t, compared_t>)
+        [[nodiscard]] usize find_first_index(const compared_t &to_find) const
+        {
+            return find_first_index_by_predicate([&to_find](const type_t &element)
+                                                 { return element == to_find; });
+        }
+
+        /**
+         * Find the last index of an element where the predicate small_vector[index] == to_find is true.
+         * Given comparand must be comparable with type_t operator==.
+         * @param compared_t The comparand type used to compare
+         * @param to_find The element to find
+         * @return last index of the element where the predicate small_vector[index] == element is true, hud::index_none otherwise
+         */
+        template<typename compared_t>
+        requires(hud::is_comparable_with_equal_operator_v<type_t, compared_t>)
+        [[nodiscard]] usize find_last_index(const compared_t &to_find) const
+        {
+            return find_last_index_by_predicate([&to_find](const type_t &element)
+                                                { return element == to_find; });
+        }
+
+        /**
+         * Find the fist index of an element where the user-defined predicate return true.
+         * @tparam unary_t The Unary predicate to use
+         * @param predicate The predicate to use
+         * @return first index of the element matching the predicate, hud::index_none otherwise
+         */
+        template<typename unary_t>
+        [[nodiscard]] usize find_first_index_by_predicate(const unary_t predicate) const
+        {
+            for (const type_t *HD_RESTRICT cur = begin_ptr; cur != end_ptr; cur++) {
+                if (predicate(*cur)) {
+                    return static_cast<usize>(cur - begin_ptr);
+                }
+            }
+            return hud::index_none;
+        }
+
+        /**
+         * Find the last index of a given element where the user-defined predicate return true.
+         * @tparam unary_t The Unary predicate to use
+         * @param predicate The predicate to use
+         * @return last index of the element matching the predicate, hud::index_none otherwise
+         */
+        template<typename unary_t>
+        [[nodiscard]] usize find_last_index_by_predicate(const unary_t predicate) const
+        {
+            const type_t *HD_RESTRICT cur = end_ptr;
+            while (cur != begin_ptr) {
+                cur--;
+                if (predicate(*cur)) {
+                    return static_cast<usize>(cur - begin_ptr);
+                }
+            }
+            return hud::index_none;
+        }
+
+        /**
+         * Checks whether an element is contained in the small_vector or not.
+         * @param compared_t The comparand type used to compare
+         * @param to_find The element to find
+         * @return true if the element is contained in the small_vector, false otherwise
+         */
+        template<typename compared_t>
+        requires(hud::is_comparable_with_equal_operator_v<type_t, compared_t>)
+        [[nodiscard]] bool contains(const compared_t &to_find) const
+        {
+            return find_first_index(to_find) != hud::index_none;
+        }
+
+        /**
+         * Checks whether an element match the user-defined predicate is contained in the small_vector or not.
+         * @tparam unary_t The Unary predicate to use
+         * @param predicate The predicate to use
+         * @return true if an element match the user-defined predicate is contained in the small_vector, false otherwise
+         */
+        template<typename unary_t>
+        [[nodiscard]] bool contains_by_predicate(const unary_t predicate) const
+        {
+            return find_first_index_by_predicate(predicate) != hud::index_none;
+        }
+
+        /** Retrieves an iterator to the beginning of the small_vector. */
+        [[nodiscard]] HD_FORCEINLINE iterator begin() noexcept
+        {
+            return iterator(begin_ptr);
+        }
+
+        /** Retrieves an const iterator to the beginning of the small_vector. */
+        [[nodiscard]] HD_FORCEINLINE const_iterator begin() const noexcept
+        {
+            return const_iterator(begin_ptr);
+        }
+
+        /** Retrieves an iterator to the end of the small_vector. */
+        [[nodiscard]] HD_FORCEINLINE iterator end() noexcept
+        {
+            return iterator(end_ptr);
+        }
+
+        /** Retrieves an const iterator to the end of the small_vector. */
+        [[nodiscard]] HD_FORCEINLINE const_iterator end() const noexcept
+        {
+            return const_iterator(end_ptr);
+        }
+
+    private:
+        /**
+         * Take the elements of another small_vector that is left empty and inline.
+         * The allocation of the other small_vector is stolen if allowed, else elements are relocated.
+         * Must be called when this small_vector is empty and inline.
+         * @param other The small_vector to take elements from
+         * @param can_steal_allocation Whether this allocator can free the allocation of the other small_vector
+         */
+        void take_elements_of(small_vector &other, const bool can_steal_allocation) noexcept
+        {
+            const usize other_count = other.count();
+            if (!other.is_inline() && can_steal_allocation) {
+                begin_ptr = other.begin_ptr;
+                end_ptr = other.end_ptr;
+                max_count_() = other.max_count_();
+            }
+            else {
+                reserve(other_count);
+                hud::memory::fast_move_or_copy_construct_object_array_then_destroy(begin_ptr, other.begin_ptr, other_count);
+                end_ptr = begin_ptr + other_count;
+                other.free_allocation();
+            }
+            other.begin_ptr = other.inline_data();
+            other.end_ptr = other.begin_ptr;
+            other.max_count_() = INLINE_COUNT;
+        }
+
+        /**
+         * Free the allocation if any and use the new allocation as storage.
+         * Elements must be relocated in the new allocation before.
+         * @param new_allocation The new allocation to use
+         * @param new_count_of_element The new count of elements to set
+         */
+        void replace_storage(memory_allocation_type &&new_allocation, const usize new_count_of_element) noexcept
+        {
+            free_allocation();
+            begin_ptr = new_allocation.data();
+            max_count_() = new_allocation.count();
+            end_ptr = begin_ptr + new_count_of_element;
+            new_allocation.leak();
+        }
+
+        /** Free the allocation if elements are not inline. Elements must be destroyed or relocated before. */
+        void free_allocation() noexcept
+        {
+            if (!is_inline()) {
+                allocator_().free(memory_allocation_type(begin_ptr, max_count_()));
+            }
+        }
+
+        /**
+         * Compute the capacity to allocate when the small_vector need to grow.
+         * The capacity is given by the `growth_policy` of the allocator traits.
+         * @param required_count The count of elements the small_vector must be able to contains
+         * @return The new capacity, always greater or equal to `required_count`
+         */
+        [[nodiscard]] usize grow_max_count(const usize required_count) const noexcept
+        {
+            return hud::allocator_traits<allocator_type>::growth_policy::grow(max_count(), required_count);
+        }
+
+        /** Retrieves a pointer to the inline storage. */
+        [[nodiscard]] HD_FORCEINLINE type_t *inline_data() noexcept
+        {
+            return inline_storage_.template pointer_as<type_t>();
+        }
+
+        /** Retrieves a pointer to the inline storage. */
+        [[nodiscard]] HD_FORCEINLINE const type_t *inline_data() const noexcept
+        {
+            return static_cast<const type_t *>(inline_storage_.pointer());
+        }
+
+        /** Retrieves the allocator. */
+        [[nodiscard]] HD_FORCEINLINE allocator_type &allocator_() noexcept
+        {
+            return compressed_allocator_.first();
+        }
+
+        /** Retrieves the allocator. */
+        [[nodiscard]] HD_FORCEINLINE const allocator_type &allocator_() const noexcept
+        {
+            return compressed_allocator_.first();
+        }
+
+        /** Retrieves the count of elements the storage can contains. */
+        [[nodiscard]] HD_FORCEINLINE usize &max_count_() noexcept
+        {
+            return compressed_allocator_.second();
+        }
+
+    private:
+        /** The allocator and the count of elements the storage can contains. */
+        hud::compressed_pair<allocator_type, usize> compressed_allocator_;
+
+        /** The inline storage of the first `inline_count` elements. */
+        hud::aligned_buffer<sizeof(type_t) * inline_count, alignof(type_t)> inline_storage_;
+
+        /** Pointer to the first element, point to the inline storage or to the allocation. */
+        type_t *begin_ptr;
+
+        /** Pointer to the end of the element sequence. */
+        type_t *end_ptr;
+    };
+
+    /**
+     * Swap first small_vector with the second small_vector.
+     * Same as first.swap(second).
+     * @tparam type_t The element type
+     * @tparam inline_count The count of elements stored inline
+     * @tparam allocator_t The allocator type of both small_vector
+     * @param first The first small_vector to swap
+     * @param second The second small_vector to swap
+     */
+    template<typename type_t, usize inline_count, typename allocator_t>
+    HD_FORCEINLINE void swap(small_vector<type_t, inline_count, allocator_t> &first, small_vector<type_t, inline_count, allocator_t> &second) noexcept
+    {
+        first.swap(second);
+    }
+
+    /**
+     * Checks whether right and left small_vector are equal.
+     * small_vector are equal if both contains same number of elements and all values are equal.
+     * @param left The left small_vector to compare
+     * @param right The right small_vector to compare
+     * @param true if right and left are equal, false otherwise
+     */
+    template<typename left_t, usize left_inline_count, typename left_allocator_t, typename right_t, usize right_inline_count, typename right_allocator_t>
+    [[nodiscard]] HD_FORCEINLINE bool operator==(const small_vector<left_t, left_inline_count, left_allocator_t> &left, const small_vector<right_t, right_inline_count, right_allocator_t> &right) noexcept
+    {
+        return left.count() == right.count() && hud::memory::is_object_array_equal(left.data(), right.data(), left.count());
+    }
+
+    /**
+     * Checks whether right and left small_vector are not equals.
+     * @param left The left small_vector to compare
+     * @param right The right small_vector to compare
+     * @param true if right and left are not equals, false otherwise
+     */
+    template<typename left_t, usize left_inline_count, typename left_allocator_t, typename right_t, usize right_inline_count, typename right_allocator_t>
+    [[nodiscard]] HD_FORCEINLINE bool operator!=(const small_vector<left_t, left_inline_count, left_allocator_t> &left, const small_vector<right_t, right_inline_count, right_allocator_t> &right) noexcept
+    {
+        return !(left == right);
+    }
+
+} // namespace hud
+
+#endif // HD_INC_CORE_SMALL_VECTOR_H
@@ -1177,6 +1177,29 @@ namespace hud
         }
     };
 
+    template<typename... types_t>
+    struct wyhash_64<hud::tuple<types_t...>>
+    {
+        [[nodiscard]] constexpr u64 operator()(const hud::tuple<types_t...> &t) const noexcept
+        {
+            wyhasher_64 hasher;
+            return details::tuple::tuple_hash<sizeof...(types_t)> {}(hasher, t);
+        }
+    };
+
+    template<typename... types_t>
+    struct keyed_hash_64<hud::tuple<types_t...>>
+        : details::keyed_hash_64_seed
+    {
+        using details::keyed_hash_64_seed::keyed_hash_64_seed;
+
+        [[nodiscard]] constexpr u64 operator()(const hud::tuple<types_t...> &t) const noexcept
+        {
+            keyed_hasher_64 hasher {seed()};
+            return details::tuple::tuple_hash<sizeof...(types_t)> {}(hasher, t);
+        }
+    };
+
 } // namespace hud
 
 namespace std
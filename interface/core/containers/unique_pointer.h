@@ -36,6 +36,7 @@
 #include "../templates/swap.h"
 #include "../templates/less.h"
 
+#include "../allocators/pool_allocator.h"
 #include "../containers/compressed_pair.h"
 #include "../hash.h"
 
@@ -1049,6 +1050,27 @@ namespace hud
         return unique_pointer<type_t>(new (std::nothrow) hud::remove_extent_t<type_t>[size]());
     }
 
+    /**
+     * Constructs a unique_pointer that owns a pointer of type type_t allocated in a pool.
+     * The returned unique_pointer use a pool_deleter that destroys the object and frees it in the pool, the unique_pointer can be destroyed by any thread.
+     * This overload only participates in overload resolution if type_t is not an array type
+     * @tparam type_t Type of the unique_pointer's pointer
+     * @tparam args_t The type_t constructor arguments
+     * @param allocator The pool allocator used to allocate the object
+     * @param args Arguments hud::forward to the type_t constructor
+     * @return unique_pointer<type_t, hud::pool_deleter<type_t>> pointing to a object of type type_t construct by passing args arguments to its constructor, empty if the allocation failed
+     */
+    template<typename type_t, typename... args_t>
+    requires(hud::negation_v<hud::is_array<type_t>>)
+    [[nodiscard]] unique_pointer<type_t, hud::pool_deleter<type_t>> make_unique(hud::pool_allocator allocator, args_t &&...args) noexcept
+    {
+        const hud::memory_allocation<type_t> allocation = allocator.template allocate<type_t>(1u);
+        if (allocation.is_empty()) [[unlikely]] {
+            return unique_pointer<type_t, hud::pool_deleter<type_t>>(nullptr, hud::pool_deleter<type_t>(allocator));
+        }
+        return unique_pointer<type_t, hud::pool_deleter<type_t>>(hud::memory::construct_object_at(allocation.data(), hud::forward<args_t>(args)...), hud::pool_deleter<type_t>(allocator));
+    }
+
     /** Construction of arrays of known bound is disallowed. */
     template<typename type_t, typename... args_t>
     requires(hud::is_bounded_array_v<type_t>)
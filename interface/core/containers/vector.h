@@ -35,6 +35,7 @@ namespace hud
      * vector is a fast and memory efficient sequence of elements of the same type.
      * vector is dynamically resizable and is responsible for the ownership of all elements it contains.
      * Elements are in a contiguous in memory in a well-define order.
+     * When the vector need to grow, the new capacity is given by the `growth_policy` of the allocator traits (geometric by default).
      * @tparam type_t The element type
      * @tparam allocator_t The allocator to use.
      */
@@ -61,6 +62,15 @@ namespace hud
         /**  Default constructor. */
         explicit constexpr vector() noexcept = default;
 
+        /**
+         * Construct an empty vector with the given allocator.
+         * @param allocator The allocator instance to use. Copy the allocator.
+         */
+        constexpr explicit vector(const allocator_type &allocator) noexcept
+            : compressed_allocator_(allocator)
+        {
+        }
+
         /**
          * Copy construct from a raw buffer of continuous elements of type u_type_t.
          * @tparam u_type_t the element type of the raw data to copy.
@@ -503,7 +513,17 @@ namespace hud
 
             // If we don't have enough place in allocated memory we need to reallocate.
             if (new_count > max_count()) {
-                memory_allocation_type new_allocation = allocator_().template allocate<type_t>(new_count);
+                if constexpr (is_reallocatable) {
+                    if (!hud::is_constant_evaluated()) {
+                        // Arguments can reference an element of the vector, construct the element before the allocation is reallocated
+                        type_t element(hud::forward<args_t>(args)...);
+                        reallocate_allocation(grow_max_count(new_count));
+                        hud::memory::construct_object_at(allocation_().data_at(old_count), hud::move(element));
+                        end_ptr = allocation_().data_at(new_count);
+                        return old_count;
+                    }
+                }
+                memory_allocation_type new_allocation = allocator_().template allocate<type_t>(grow_max_count(new_count));
                 // Construct the element in-place
                 hud::memory::construct_object_at(new_allocation.data_at(old_count), hud::forward<args_t>(args)...);
                 // Relocate the element that are before the newly added element if any
@@ -552,7 +572,18 @@ namespace hud
 
             // if we don't have enough place in allocated memory we need to reallocate.
             if (new_count > max_count()) {
-                memory_allocation_type new_allocation = allocator_().template allocate<type_t>(new_count);
+                if constexpr (is_reallocatable) {
+                    // Arguments can reference an element of the vector, construct the element before the allocation is reallocated
+                    type_t element(hud::forward<args_t>(args)...);
+                    reallocate_allocation(grow_max_count(new_count));
+                    // Relocate others after the emplaced element
+                    type_t *emplace_ptr = allocation_().data_at(idx);
+                    hud::memory::move_or_copy_construct_object_array_then_destroy_backward(emplace_ptr + 1, emplace_ptr, static_cast<usize>(end_ptr - emplace_ptr));
+                    hud::memory::construct_object_at(emplace_ptr, hud::move(element));
+                    end_ptr++;
+                    return;
+                }
+                memory_allocation_type new_allocation = allocator_().template allocate<type_t>(grow_max_count(new_count));
                 // Construct the element in-place
                 hud::memory::construct_object_at(new_allocation.data_at(idx), hud::forward<args_t>(args)...);
                 // Relocate elements if any
@@ -647,7 +678,9 @@ namespace hud
             const usize old_count = count();
             const usize new_count = count() + element_number;
 
-            reserve(new_count);
+            if (new_count > max_count()) {
+                reserve(grow_max_count(new_count));
+            }
             end_ptr = data_at(new_count);
             return old_count;
         }
@@ -750,11 +783,18 @@ namespace hud
          * Reserve enough memory to ensure the vector can contains a number of elements without reallocating.
          * Only grow the allocation and relocate object if the number of elements requested is bigger than the current max number of elements.
          * Do nothing if the given element number is less or equal the maximum element count.
+         * The growth policy is not applied, the vector allocates exactly `element_number` elements.
          * @param element_number Number of element th vector must be able to contains in memory
          */
         constexpr void reserve(const usize element_number) noexcept
         {
             if (element_number > max_count()) {
+                if constexpr (is_reallocatable) {
+                    if (!hud::is_constant_evaluated()) {
+                        reallocate_allocation(element_number);
+                        return;
+                    }
+                }
                 memory_allocation_type new_allocation = allocator_().template allocate<type_t>(element_number);
                 if (count() > 0u) {
                     hud::memory::fast_move_or_copy_construct_object_array_then_destroy(new_allocation.data(), data(), count());
@@ -1340,6 +1380,42 @@ namespace hud
             end_ptr = allocation_().data_at(new_count_of_element);
         }
 
+        /**
+         * Compute the capacity to allocate when the vector need to grow.
+         * The capacity is given by the `growth_policy` of the allocator traits.
+         * @param required_count The count of elements the vector must be able to contains
+         * @return The new capacity, always greater or equal to `required_count`
+         */
+        [[nodiscard]] constexpr usize grow_max_count(const usize required_count) const noexcept
+        {
+            return hud::allocator_traits<allocator_type>::growth_policy::grow(max_count(), required_count);
+        }
+
+        /**
+         * Reallocate the allocation with the allocator `reallocate` to contains `new_max_count` elements.
+         * The allocation can be extended in place, elements are kept and no constructor or destructor is called.
+         * If the reallocation fails the old allocation is still valid, a new allocation is made and elements are moved into it.
+         * Must be used only if `is_reallocatable` is true and not in a constant evaluated expression.
+         * @param new_max_count The new maximum count of elements
+         */
+        void reallocate_allocation(const usize new_max_count) noexcept
+        {
+            const usize old_count = count();
+            memory_allocation_type new_allocation = allocator_().template reallocate<type_t>(allocation_(), new_max_count);
+            if (new_allocation.is_empty()) {
+                new_allocation = allocator_().template allocate<type_t>(new_max_count);
+                if (old_count > 0u) {
+                    hud::memory::fast_move_or_copy_construct_object_array_then_destroy(new_allocation.data(), data(), old_count);
+                }
+                free_allocation_and_replace_it(hud::move(new_allocation), old_count);
+                return;
+            }
+            // The old allocation is invalidated by the reallocation, don't free it
+            allocation_().leak();
+            allocation_() = hud::move(new_allocation);
+            end_ptr = allocation_().data_at(old_count);
+        }
+
         /** Free the allocation and set everything to default */
         constexpr void free_to_null() noexcept
         {
@@ -1393,6 +1469,12 @@ namespace hud
         friend class vector; // Friend with other vector of other types
 
     private:
+        /**
+         * Whether the allocation can grow with the allocator `reallocate` instead of allocate, relocate and free.
+         * Only trivially relocatable elements are reallocated because no constructor or destructor is called during the reallocation.
+         */
+        static constexpr bool is_reallocatable = hud::allocator_traits<allocator_type>::can_reallocate::value && hud::is_bitwise_move_constructible_v<type_t> && hud::is_trivially_destructible_v<type_t>;
+
         /** The type of the allocator used. */
         hud::compressed_pair<allocator_type, memory_allocation_type> compressed_allocator_;
 
@@ -5,6 +5,8 @@
 #include "traits/underlying_type.h"
 #include "traits/is_integral.h"
 #include "hash/city_hash.h"
+#include "hash/wyhash.h"
+#include "traits/is_floating_point.h"
 #include "templates/bit_cast.h"
 #include "cstring.h"
 #include "traits/decay.h"
@@ -390,6 +392,16 @@ namespace hud
         }
     };
 
+    /** Retrieves the 64 bits hash of a key given by fragments, same as the hash of the fragments put end to end. */
+    template<usize fragment_capacity>
+    struct hash_64<hud::hash_algorithm::city_hash_64_stream<fragment_capacity>>
+    {
+        [[nodiscard]] constexpr u64 operator()(const hud::hash_algorithm::city_hash_64_stream<fragment_capacity> &stream) const
+        {
+            return stream.finalize();
+        }
+    };
+
     /** Retrieves the 64 bits hash of a pointer of a type type_t. */
     template<>
     struct hash_64<void *>
@@ -469,6 +481,15 @@ namespace hud
     struct hasher_64
     {
     public:
+        /** Construct a `hasher_64` with a 0 seed. */
+        constexpr hasher_64() noexcept = default;
+
+        /** Construct a `hasher_64` with a seed, the same values give different hashes with different seeds. */
+        constexpr explicit hasher_64(u64 seed) noexcept
+            : state_ {seed}
+        {
+        }
+
         /** Hash the value and combine the value with the current hasher value. */
         template<typename... type_t>
         [[nodiscard]] constexpr hasher_64 &operator()(type_t &&...values) noexcept
@@ -500,6 +521,341 @@ namespace hud
         u64 state_ {0}; // Default is 0, but can be a seed
     };
 
+    /**
+     * Retrieves the 64 bits hash of a value with wyhash.
+     * `wyhash_64` is a faster alternative to `hud::hash_64` that can be given as `hasher_t` to `hud::hashset` and `hud::hashmap`.
+     * Integral, floating point and pointer values are mixed with one 128 bits multiplication instead of being used as is,
+     * strings are hashed with `hud::hash_algorithm::wyhash`.
+     * `hud::pair` and `hud::tuple` combine the wyhash of their elements with a `hud::wyhasher_64`.
+     * Other types use `hud::hash_64`.
+     */
+    template<typename type_t>
+    struct wyhash_64
+        : hud::hash_64<type_t>
+    {
+    };
+
+    /** Retrieves the 64 bits wyhash of an integral value. */
+    template<typename type_t>
+    requires(hud::is_integral_v<type_t> && sizeof(type_t) <= sizeof(u64))
+    struct wyhash_64<type_t>
+    {
+        [[nodiscard]] constexpr u64 operator()(const type_t value) const
+        {
+            return hud::hash_algorithm::wyhash::hash_64(static_cast<u64>(value));
+        }
+    };
+
+    /** Retrieves the 64 bits wyhash of a floating point value. */
+    template<typename type_t>
+    requires(hud::is_floating_point_v<type_t>)
+    struct wyhash_64<type_t>
+    {
+        [[nodiscard]] constexpr u64 operator()(const type_t value) const
+        {
+            if constexpr (sizeof(type_t) == sizeof(u32)) {
+                return hud::hash_algorithm::wyhash::hash_64(static_cast<u64>(hud::bit_cast<u32>(value)));
+            }
+            else {
+                return hud::hash_algorithm::wyhash::hash_64(hud::bit_cast<u64>(value));
+            }
+        }
+    };
+
+    /** Retrieves the 64 bits wyhash of a pointer. */
+    template<typename type_t>
+    struct wyhash_64<type_t *>
+    {
+        [[nodiscard]] inline u64 operator()(const type_t *const pointer) const
+        {
+            return hud::hash_algorithm::wyhash::hash_64(static_cast<u64>(reinterpret_cast<uptr>(pointer)));
+        }
+    };
+
+    /** Retrieves the 64 bits wyhash of a char8 string. */
+    template<>
+    struct wyhash_64<char8 *>
+    {
+        [[nodiscard]] constexpr u64 operator()(const char8 *value, usize length) const
+        {
+            return hud::hash_algorithm::wyhash::hash_64(value, length);
+        }
+
+        [[nodiscard]] constexpr u64 operator()(const char8 *value) const
+        {
+            return hud::hash_algorithm::wyhash::hash_64(value, cstring::length(value));
+        }
+    };
+
+    /** Retrieves the 64 bits wyhash of a wchar string. */
+    template<>
+    struct wyhash_64<wchar *>
+    {
+        [[nodiscard]] inline u64 operator()(const wchar *value, usize length) const
+        {
+            return hud::hash_algorithm::wyhash::hash_64(reinterpret_cast<const char8 *>(value), length * sizeof(wchar));
+        }
+
+        [[nodiscard]] inline u64 operator()(const wchar *value) const
+        {
+            return (*this)(value, cstring::length(value));
+        }
+    };
+
+    template<typename type_t>
+    struct wyhash_64<const type_t *>
+        : wyhash_64<type_t *>
+    {
+    };
+
+    /**
+     * A 64 bit hasher class like `hasher_64` that hash values with `hud::wyhash_64` and combine them with `hud::hash_algorithm::wyhash::combine_64`.
+     * Combining a value costs one 128 bits multiplication instead of the full mixing round of `hud::combine_64`.
+     * Like `hasher_64`, it accumulates the values it hashes, so it is not a `hasher_t` of `hud::hashset` or `hud::hashmap`:
+     * use `hud::wyhash_64` that hashes each key with a new `wyhasher_64`.
+     */
+    class wyhasher_64
+    {
+    public:
+        /** Construct a `wyhasher_64` with a 0 seed. */
+        constexpr wyhasher_64() noexcept = default;
+
+        /** Construct a `wyhasher_64` with a seed, the same values give different hashes with different seeds. */
+        constexpr explicit wyhasher_64(u64 seed) noexcept
+            : state_ {seed}
+        {
+        }
+
+        /** Hash the value and combine the value with the current hasher value. */
+        template<typename type_t, typename... args_t>
+        [[nodiscard]] constexpr wyhasher_64 &operator()(type_t &&value, args_t &&...args) noexcept
+        {
+            state_ = hud::hash_algorithm::wyhash::combine_64(state_, hud::wyhash_64<hud::decay_t<type_t>> {}(hud::forward<type_t>(value), hud::forward<args_t>(args)...));
+            return *this;
+        }
+
+        /** Retrieves the value of the `wyhasher_64`. */
+        [[nodiscard]] constexpr operator u64() const noexcept
+        {
+            return state_;
+        }
+
+        /** Retrieves the value of the `wyhasher_64`. */
+        [[nodiscard]] constexpr u64 result() const noexcept
+        {
+            return state_;
+        }
+
+        /** Hash the value and combine the value with the current hasher value. */
+        template<typename... type_t>
+        constexpr wyhasher_64 &hash(type_t &&...values) noexcept
+        {
+            return (*this)(hud::forward<type_t>(values)...);
+        }
+
+    private:
+        u64 state_ {0}; // Default is 0, but can be a seed
+    };
+
+    /**
+     * Retrieves the random 64 bits seed of the process.
+     * The seed is read once from the OS random generator, like `hud::uuid::create`, and does not change until the process exits.
+     */
+    [[nodiscard]] HD_CORE_DLL u64 process_hash_seed() noexcept;
+
+    namespace details
+    {
+        /** Seed of `hud::keyed_hash_64`. */
+        class keyed_hash_64_seed
+        {
+        public:
+            /** Construct with the seed of the process, or 0 in constant evaluation where the OS random generator is not available. */
+            constexpr keyed_hash_64_seed() noexcept
+            {
+                if !consteval
+                {
+                    seed_ = hud::process_hash_seed();
+                }
+            }
+
+            /** Construct with a seed. */
+            constexpr explicit keyed_hash_64_seed(u64 seed) noexcept
+                : seed_ {seed}
+            {
+            }
+
+            /** Retrieves the seed. */
+            [[nodiscard]] constexpr u64 seed() const noexcept
+            {
+                return seed_;
+            }
+
+        private:
+            u64 seed_ {0};
+        };
+    } // namespace details
+
+    /**
+     * Retrieves the 64 bits hash of a value keyed with a random seed.
+     * Give it as `hasher_t` to `hud::hashset` and `hud::hashmap` when keys come from untrusted sources:
+     * `hud::hash_64` does not depend on a secret, so keys that collide can be computed offline and make probing O(n).
+     * Integral, floating point, pointer and string values are hashed with `hud::hash_algorithm::wyhash` that mixes the seed in every round.
+     * `hud::pair` and `hud::tuple` hash each element with its keyed hash and combine them with a `hud::keyed_hasher_64`.
+     * Other types are hashed with `hud::hash_64` then combined with the seed: keys that collide with `hud::hash_64` still collide,
+     * specialize `keyed_hash_64` for such types when they are used as keys from untrusted sources.
+     * The default seed is `hud::process_hash_seed()`.
+     */
+    template<typename type_t>
+    struct keyed_hash_64
+        : details::keyed_hash_64_seed
+    {
+        using details::keyed_hash_64_seed::keyed_hash_64_seed;
+
+        template<typename... args_t>
+        [[nodiscard]] constexpr u64 operator()(args_t &&...args) const
+        {
+            return hud::combine_64(seed(), hud::hash_64<type_t> {}(hud::forward<args_t>(args)...));
+        }
+    };
+
+    /** Retrieves the 64 bits keyed hash of an integral value. */
+    template<typename type_t>
+    requires(hud::is_integral_v<type_t> && sizeof(type_t) <= sizeof(u64))
+    struct keyed_hash_64<type_t>
+        : details::keyed_hash_64_seed
+    {
+        using details::keyed_hash_64_seed::keyed_hash_64_seed;
+
+        [[nodiscard]] constexpr u64 operator()(const type_t value) const
+        {
+            return hud::hash_algorithm::wyhash::hash_64(static_cast<u64>(value), seed());
+        }
+    };
+
+    /** Retrieves the 64 bits keyed hash of a floating point value. */
+    template<typename type_t>
+    requires(hud::is_floating_point_v<type_t>)
+    struct keyed_hash_64<type_t>
+        : details::keyed_hash_64_seed
+    {
+        using details::keyed_hash_64_seed::keyed_hash_64_seed;
+
+        [[nodiscard]] constexpr u64 operator()(const type_t value) const
+        {
+            if constexpr (sizeof(type_t) == sizeof(u32)) {
+                return hud::hash_algorithm::wyhash::hash_64(static_cast<u64>(hud::bit_cast<u32>(value)), seed());
+            }
+            else {
+                return hud::hash_algorithm::wyhash::hash_64(hud::bit_cast<u64>(value), seed());
+            }
+        }
+    };
+
+    /** Retrieves the 64 bits keyed hash of a pointer. */
+    template<typename type_t>
+    struct keyed_hash_64<type_t *>
+        : details::keyed_hash_64_seed
+    {
+        using details::keyed_hash_64_seed::keyed_hash_64_seed;
+
+        [[nodiscard]] inline u64 operator()(const type_t *const pointer) const
+        {
+            return hud::hash_algorithm::wyhash::hash_64(static_cast<u64>(reinterpret_cast<uptr>(pointer)), seed());
+        }
+    };
+
+    /** Retrieves the 64 bits keyed hash of a char8 string. */
+    template<>
+    struct keyed_hash_64<char8 *>
+        : details::keyed_hash_64_seed
+    {
+        using details::keyed_hash_64_seed::keyed_hash_64_seed;
+
+        [[nodiscard]] constexpr u64 operator()(const char8 *value, usize length) const
+        {
+            return hud::hash_algorithm::wyhash::hash_64(value, length, seed());
+        }
+
+        [[nodiscard]] constexpr u64 operator()(const char8 *value) const
+        {
+            return hud::hash_algorithm::wyhash::hash_64(value, cstring::length(value), seed());
+        }
+    };
+
+    /** Retrieves the 64 bits keyed hash of a wchar string. */
+    template<>
+    struct keyed_hash_64<wchar *>
+        : details::keyed_hash_64_seed
+    {
+        using details::keyed_hash_64_seed::keyed_hash_64_seed;
+
+        [[nodiscard]] inline u64 operator()(const wchar *value, usize length) const
+        {
+            return hud::hash_algorithm::wyhash::hash_64(reinterpret_cast<const char8 *>(value), length * sizeof(wchar), seed());
+        }
+
+        [[nodiscard]] inline u64 operator()(const wchar *value) const
+        {
+            return (*this)(value, cstring::length(value));
+        }
+    };
+
+    template<typename type_t>
+    struct keyed_hash_64<const type_t *>
+        : keyed_hash_64<type_t *>
+    {
+        using keyed_hash_64<type_t *>::keyed_hash_64;
+    };
+
+    /**
+     * A 64 bit hasher class like `wyhasher_64` that hash values with `hud::keyed_hash_64` and the seed of the hasher.
+     * The seed is mixed in the hash of every value, not only in the combined result,
+     * so keys made of several values are not easier to collide than each of their values.
+     */
+    class keyed_hasher_64
+    {
+    public:
+        /** Construct a `keyed_hasher_64` with a seed. */
+        constexpr explicit keyed_hasher_64(u64 seed) noexcept
+            : seed_ {seed}
+            , state_ {seed}
+        {
+        }
+
+        /** Hash the value with the seed and combine the value with the current hasher value. */
+        template<typename type_t, typename... args_t>
+        [[nodiscard]] constexpr keyed_hasher_64 &operator()(type_t &&value, args_t &&...args) noexcept
+        {
+            state_ = hud::hash_algorithm::wyhash::combine_64(state_, hud::keyed_hash_64<hud::decay_t<type_t>> {seed_}(hud::forward<type_t>(value), hud::forward<args_t>(args)...));
+            return *this;
+        }
+
+        /** Retrieves the value of the `keyed_hasher_64`. */
+        [[nodiscard]] constexpr operator u64() const noexcept
+        {
+            return state_;
+        }
+
+        /** Retrieves the value of the `keyed_hasher_64`. */
+        [[nodiscard]] constexpr u64 result() const noexcept
+        {
+            return state_;
+        }
+
+        /** Hash the value with the seed and combine the value with the current hasher value. */
+        template<typename... type_t>
+        constexpr keyed_hasher_64 &hash(type_t &&...values) noexcept
+        {
+            return (*this)(hud::forward<type_t>(values)...);
+        }
+
+    private:
+        /** The seed given to the keyed hash of every value */
+        u64 seed_;
+        /** The combined hash */
+        u64 state_;
+    };
+
     // Traits used to check if a type is hashable
     template<typename type_t, typename u_type_t = type_t, typename = void>
     struct is_hashable_64
@@ -65,6 +65,8 @@
 #include "../memory.h"
 #include "../templates/swap.h"
 #include "../templates/bit_cast.h"
+#include "../slice.h"
+#include "../containers/vector.h"
 
 namespace hud::hash_algorithm
 {
@@ -377,6 +379,62 @@ namespace hud::hash_algorithm
             return hash_128_to_64(u128 {a, b});
         }
 
+        /** The 56 bytes of state of the 64 bits hash of a key of more than 64 bytes. */
+        struct hash_64_long_state
+        {
+            u64 x;
+            u64 y;
+            u64 z;
+            u128 v;
+            u128 w;
+        };
+
+        /**
+         * Initialise the state of the 64 bits hash of a key of more than 64 bytes.
+         * The end of the key is hashed first.
+         * @param last_64_bytes Pointer to the last 64 bytes of the key
+         * @param first_8_bytes The first 8 bytes of the key
+         * @param length The length of the key, more than 64
+         * @return The state before hashing the 64 bytes blocks of the key
+         */
+        [[nodiscard]] static constexpr hash_64_long_state hash_64_long_init(const char8 *last_64_bytes, u64 first_8_bytes, usize length) noexcept
+        {
+            u64 x = fetch_64(last_64_bytes + 24);
+            u64 y = fetch_64(last_64_bytes + 48) + fetch_64(last_64_bytes + 8);
+            u64 z = hash_64_len_16(fetch_64(last_64_bytes + 16) + length, fetch_64(last_64_bytes + 40));
+            u128 v = weak_hash_len_32_with_seeds(last_64_bytes, length, z);
+            u128 w = weak_hash_len_32_with_seeds(last_64_bytes + 32, y + K1, x);
+            x = x * K1 + first_8_bytes;
+            return hash_64_long_state {x, y, z, v, w};
+        }
+
+        /**
+         * Hash a 64 bytes block of a key of more than 64 bytes.
+         * @param state The state to update
+         * @param block Pointer to the 64 bytes of the block
+         */
+        static constexpr void hash_64_long_update(hash_64_long_state &state, const char8 *block) noexcept
+        {
+            state.x = hud::bits::rotate_right(state.x + state.y + state.v.low() + fetch_64(block + 8), 37) * K1;
+            state.y = hud::bits::rotate_right(state.y + state.v.high() + fetch_64(block + 48), 42) * K1;
+            state.x ^= state.w.high();
+            state.y += state.v.low() + fetch_64(block + 40);
+            state.z = hud::bits::rotate_right(state.z + state.w.low(), 33) * K1;
+            state.v = weak_hash_len_32_with_seeds(block, state.v.high() * K1, state.x + state.w.low());
+            state.w = weak_hash_len_32_with_seeds(block + 32, state.z + state.w.high(), state.y + fetch_64(block + 16));
+            swap(state.z, state.x);
+        }
+
+        /**
+         * Retrieves the 64 bits hash of a key of more than 64 bytes once all blocks are hashed.
+         * @param state The state after the last block
+         * @return The 64 bits hash of the key
+         */
+        [[nodiscard]] static constexpr u64 hash_64_long_finalize(const hash_64_long_state &state) noexcept
+        {
+            return hash_64_len_16(hash_64_len_16(state.v.low(), state.w.low()) + shift_mix(state.y) * K1 + state.z, hash_64_len_16(state.v.high(), state.w.high()) + state.x);
+        }
+
     } // namespace details
 
     struct city_hash
@@ -490,28 +548,16 @@ namespace hud::hash_algorithm
 
             // For strings over 64 bytes we hash the end first, and then as we
             // loop we keep 56 bytes of state: v, w, x, y, and z.
-            u64 x = details::fetch_64(buffer + length - 40);
-            u64 y = details::fetch_64(buffer + length - 16) + details::fetch_64(buffer + length - 56);
-            u64 z = details::hash_64_len_16(details::fetch_64(buffer + length - 48) + length, details::fetch_64(buffer + length - 24));
-            u128 v = details::weak_hash_len_32_with_seeds(buffer + length - 64, length, z);
-            u128 w = details::weak_hash_len_32_with_seeds(buffer + length - 32, y + details::K1, x);
-            x = x * details::K1 + details::fetch_64(buffer);
+            details::hash_64_long_state state = details::hash_64_long_init(buffer + length - 64, details::fetch_64(buffer), length);
 
             // Decrease len to the nearest multiple of 64, and operate on 64-byte chunks.
             length = (length - 1) & ~static_cast<usize>(63);
             do {
-                x = hud::bits::rotate_right(x + y + v.low() + details::fetch_64(buffer + 8), 37) * details::K1;
-                y = hud::bits::rotate_right(y + v.high() + details::fetch_64(buffer + 48), 42) * details::K1;
-                x ^= w.high();
-                y += v.low() + details::fetch_64(buffer + 40);
-                z = hud::bits::rotate_right(z + w.low(), 33) * details::K1;
-                v = details::weak_hash_len_32_with_seeds(buffer, v.high() * details::K1, x + w.low());
-                w = details::weak_hash_len_32_with_seeds(buffer + 32, z + w.high(), y + details::fetch_64(buffer + 16));
-                swap(z, x);
+                details::hash_64_long_update(state, buffer);
                 buffer += 64;
                 length -= 64;
             } while (length != 0);
-            return details::hash_64_len_16(details::hash_64_len_16(v.low(), w.low()) + details::shift_mix(y) * details::K1 + z, details::hash_64_len_16(v.high(), w.high()) + x);
+            return details::hash_64_long_finalize(state);
         }
 
         /**
@@ -526,6 +572,202 @@ namespace hud::hash_algorithm
         }
     };
 
+    /**
+     * Streaming CityHash64 of a key given by fragments.
+     * The result of `finalize()` is the same as `city_hash::hash_64()` of the fragments put end to end.
+     *
+     * CityHash64 starts by hashing the end of the key, so fragments can't be hashed as they come.
+     * `update()` only keeps a view of the fragment and `finalize()` hashes them in place: bytes are never copied,
+     * except the 64 bytes blocks that overlap 2 fragments and the last 64 bytes of the key.
+     * Fragments must stay valid until `finalize()` is called.
+     *
+     * When more than `fragment_capacity` fragments are added, the last fragment and the following ones are copied
+     * to a buffer owned by the stream: the result is the same, only the fragments after the capacity are not zero-copy.
+     *
+     * @tparam fragment_capacity The maximum count of fragments hashed in place
+     */
+    template<usize fragment_capacity = 16>
+    class city_hash_64_stream
+    {
+        static_assert(fragment_capacity > 0, "city_hash_64_stream need at least one fragment");
+
+    public:
+        /**
+         * Add a fragment at the end of the key
+         * @param buffer Pointer to the first byte of the fragment, must stay valid until `finalize()` is called
+         * @param length Length of the fragment in bytes
+         * @return *this
+         */
+        constexpr city_hash_64_stream &update(const char8 *buffer, usize length) noexcept
+        {
+            if (length == 0) {
+                return *this;
+            }
+            if (fragment_count_ < fragment_capacity) {
+                fragments_[fragment_count_].buffer = buffer;
+                fragments_[fragment_count_].length = length;
+                fragment_count_++;
+            }
+            else {
+                // All fragments are used, the last one and the new one are put end to end in the overflow buffer
+                fragment &last = fragments_[fragment_capacity - 1];
+                if (overflow_.count() == 0) {
+                    append_to_overflow(last.buffer, last.length);
+                }
+                append_to_overflow(buffer, length);
+                last.length += length;
+            }
+            length_ += length;
+            return *this;
+        }
+
+        /**
+         * Add a fragment at the end of the key
+         * @param fragment The fragment, must stay valid until `finalize()` is called
+         * @return *this
+         */
+        constexpr city_hash_64_stream &update(const hud::slice<const char8> &fragment) noexcept
+        {
+            return update(fragment.data(), fragment.count());
+        }
+
+        /** Retrieves the length in bytes of the key */
+        [[nodiscard]] constexpr usize length() const noexcept
+        {
+            return length_;
+        }
+
+        /** Retrieves the count of fragments of the key, fragments after the capacity are counted in the last one */
+        [[nodiscard]] constexpr usize fragment_count() const noexcept
+        {
+            return fragment_count_;
+        }
+
+        /** Remove all fragments */
+        constexpr void reset() noexcept
+        {
+            fragment_count_ = 0;
+            length_ = 0;
+            overflow_.clear();
+        }
+
+        /**
+         * Retrieves the 64 bits hash of the key
+         * @return The same value as `city_hash::hash_64()` of the fragments put end to end
+         */
+        [[nodiscard]] constexpr u64 finalize() const noexcept
+        {
+            char8 bytes[64] {};
+            if (length_ <= 64) {
+                cursor key_cursor;
+                read(key_cursor, bytes, length_);
+                return city_hash::hash_64(bytes, length_);
+            }
+
+            // Hash the end first like `city_hash::hash_64()`
+            char8 first_bytes[8] {};
+            cursor first_cursor;
+            read(first_cursor, first_bytes, 8);
+            cursor last_cursor;
+            skip(last_cursor, length_ - 64);
+            read(last_cursor, bytes, 64);
+            details::hash_64_long_state state = details::hash_64_long_init(bytes, details::fetch_64(first_bytes), length_);
+
+            // Hash the 64 bytes blocks in place when a fragment contains the whole block
+            cursor block_cursor;
+            usize block_count = (length_ - 1) / 64;
+            while (block_count != 0) {
+                const fragment &current = fragments_[block_cursor.fragment_index];
+                const usize in_place_count = hud::math::min((current.length - block_cursor.offset) / 64, block_count);
+                const char8 *block = fragment_buffer(block_cursor.fragment_index) + block_cursor.offset;
+                for (usize index = 0; index < in_place_count; index++) {
+                    details::hash_64_long_update(state, block);
+                    block += 64;
+                }
+                block_count -= in_place_count;
+                skip(block_cursor, in_place_count * 64);
+                if (in_place_count == 0) {
+                    read(block_cursor, bytes, 64);
+                    details::hash_64_long_update(state, bytes);
+                    block_count--;
+                }
+            }
+            return details::hash_64_long_finalize(state);
+        }
+
+    private:
+        /** A fragment of the key */
+        struct fragment
+        {
+            /** Pointer to the first byte of the fragment */
+            const char8 *buffer {nullptr};
+            /** Length of the fragment in bytes */
+            usize length {0};
+        };
+
+        /** Position of a byte in the fragments */
+        struct cursor
+        {
+            /** Index of the fragment */
+            usize fragment_index {0};
+            /** Offset of the byte in the fragment */
+            usize offset {0};
+        };
+
+        /** Retrieves the first byte of a fragment, the last fragment is in the overflow buffer if the fragments overflowed */
+        [[nodiscard]] constexpr const char8 *fragment_buffer(usize fragment_index) const noexcept
+        {
+            if (fragment_index == fragment_capacity - 1 && overflow_.count() != 0) {
+                return overflow_.data();
+            }
+            return fragments_[fragment_index].buffer;
+        }
+
+        /** Copy `count` bytes at the end of the overflow buffer */
+        constexpr void append_to_overflow(const char8 *buffer, usize count) noexcept
+        {
+            const usize offset = overflow_.add_no_construct(count);
+            hud::memory::copy_memory(overflow_.data() + offset, buffer, count);
+        }
+
+        /** Move the cursor `count` bytes forward */
+        constexpr void skip(cursor &position, usize count) const noexcept
+        {
+            while (count != 0) {
+                const usize available = hud::math::min(fragments_[position.fragment_index].length - position.offset, count);
+                position.offset += available;
+                count -= available;
+                if (position.offset == fragments_[position.fragment_index].length) {
+                    position.fragment_index++;
+                    position.offset = 0;
+                }
+            }
+        }
+
+        /** Copy `count` bytes at the cursor to `destination` and move the cursor after them */
+        constexpr void read(cursor &position, char8 *destination, usize count) const noexcept
+        {
+            while (count != 0) {
+                const fragment &current = fragments_[position.fragment_index];
+                const usize available = hud::math::min(current.length - position.offset, count);
+                hud::memory::copy_memory(destination, fragment_buffer(position.fragment_index) + position.offset, available);
+                destination += available;
+                skip(position, available);
+                count -= available;
+            }
+        }
+
+    private:
+        /** The fragments of the key */
+        fragment fragments_[fragment_capacity] {};
+        /** Count of fragments */
+        usize fragment_count_ {0};
+        /** Length of the key in bytes */
+        usize length_ {0};
+        /** The last fragment and the following ones put end to end when there are more fragments than `fragment_capacity` */
+        hud::vector<char8> overflow_;
+    };
+
 } // namespace hud::hash_algorithm
 
 #endif // HD_INC_CORE_HASH_ALGORITHM_CITY_HASH_H
\ No newline at end of file
@@ -1,5 +1,6 @@
 #ifndef HD_INC_CORE_HASH_ALGORITHM_CRC32_HASH_H
 #define HD_INC_CORE_HASH_ALGORITHM_CRC32_HASH_H
+#include "../containers/vector.h"
 
 namespace hud::hash_algorithm
 {
@@ -28,8 +29,10 @@ namespace hud::hash_algorithm
         static const u32 X2N_TABLE[32];
 
         /**
-         * CRC32 hash based on Intel slice-by-8 algorithm
+         * CRC32 hash
          * Polynomial used is 0x04C11DB7
+         * Buffers of at least 64 bytes are folded with carry-less multiplications when the CPU supports PCLMULQDQ,
+         * other buffers use the Intel slice-by-8 algorithm. Both give the same result.
          * @param buffer Pointer to the first byte to hash
          * @param count Number of bit to hash
          * @param seed The seed to use. Default is 0.
@@ -37,6 +40,22 @@ namespace hud::hash_algorithm
          */
         [[nodiscard]] static HD_CORE_DLL u32 hash(const u8 *buffer, usize count, const u32 seed = 0) noexcept;
 
+        /**
+         * CRC32 hash based on Intel slice-by-8 algorithm, whatever the CPU supports
+         * Polynomial used is 0x04C11DB7
+         * @param buffer Pointer to the first byte to hash
+         * @param count Number of bit to hash
+         * @param seed The seed to use. Default is 0.
+         * @return The CRC32 of the buffer
+         */
+        [[nodiscard]] static HD_CORE_DLL u32 hash_slice_by_8(const u8 *buffer, usize count, const u32 seed = 0) noexcept;
+
+        /**
+         * Check if `hash` folds buffers with carry-less multiplications
+         * @return true if the CPU supports PCLMULQDQ and the library is compiled with it, false otherwise
+         */
+        [[nodiscard]] static HD_CORE_DLL bool is_pclmul_supported() noexcept;
+
         /**
          * Combine 2 crc32 hash
          * @param crc1 The first crc
@@ -44,6 +63,109 @@ namespace hud::hash_algorithm
          * @param count_crc2 The count of bytes used to compute the crc2
          */
         [[nodiscard]] static HD_CORE_DLL u32 combine(u32 crc1, u32 crc2, usize count_crc2) noexcept;
+
+        /**
+         * Combine the crc32 of consecutive chunks of a buffer
+         * All chunks have `chunk_size` bytes except the last one that has the remaining bytes of the `count` bytes buffer.
+         * @param chunk_crcs The crc32 of each chunk, only the first chunk is hashed with the seed, the others are hashed with 0
+         * @param chunk_count Number of chunks, must not be 0
+         * @param chunk_size Number of bytes of a chunk
+         * @param count Number of bytes of the whole buffer
+         * @return The CRC32 of the buffer
+         */
+        [[nodiscard]] static HD_CORE_DLL u32 combine_chunks(const u32 *chunk_crcs, usize chunk_count, usize chunk_size, usize count) noexcept;
+
+        /**
+         * CRC32 hash of a large buffer computed by chunks with tasks run by an executor
+         * The buffer is split in chunks of `chunk_size` bytes, the last chunk may be smaller.
+         * Each chunk is hashed by a task and the chunks are merged with `combine_chunks`.
+         * The result is the same as `hash` with the same buffer and seed.
+         *
+         * The library does not own threads: `executor(task_count, task)` must call `task(task_index)` once for each `task_index`
+         * in [0, task_count), on any number of threads, and return when all tasks are done.
+         * If there is only one chunk, the buffer is hashed by the calling thread with `hash` and the executor is not called.
+         * @param buffer Pointer to the first byte to hash
+         * @param count Number of bytes to hash
+         * @param chunk_size Number of bytes of a chunk, must not be 0
+         * @param executor The callable that runs the hashing tasks
+         * @param seed The seed to use. Default is 0.
+         * @return The CRC32 of the buffer
+         */
+        template<typename executor_t>
+        [[nodiscard]] static u32 hash_parallel(const u8 *buffer, usize count, usize chunk_size, executor_t &&executor, const u32 seed = 0) noexcept
+        {
+            HUD_CHECK(chunk_size > 0 && "Chunk size can't be 0");
+            const usize chunk_count = (count + chunk_size - 1) / chunk_size;
+            if (chunk_count <= 1) {
+                return hash(buffer, count, seed);
+            }
+            hud::vector<u32> chunk_crcs;
+            chunk_crcs.resize(chunk_count);
+            u32 *chunk_crcs_ptr = chunk_crcs.data();
+            auto hash_chunk = [=](const usize chunk_index) noexcept {
+                const usize chunk_offset = chunk_index * chunk_size;
+                const usize chunk_length = chunk_index == chunk_count - 1 ? count - chunk_offset : chunk_size;
+                chunk_crcs_ptr[chunk_index] = hash(buffer + chunk_offset, chunk_length, chunk_index == 0 ? seed : 0);
+            };
+            executor(chunk_count, hash_chunk);
+            return combine_chunks(chunk_crcs_ptr, chunk_count, chunk_size, count);
+        }
+    };
+
+    struct crc32c
+    {
+        /**
+         * CRC-32C (Castagnoli) polynomial
+         * Use by ( Source : Wikipedia https://en.wikipedia.org/wiki/Cyclic_redundancy_check#Commonly_used_and_standardized_CRCs ) :
+         * iSCSI, SCTP, G.hn payload, SSE4.2, Btrfs, ext4, Ceph
+         */
+        static constexpr u32 POLYNOMIAL = 0x1edc6f41;
+
+        /**
+         * CRC-32C (Castagnoli) reversed polynomial
+         * Use by ( Source : Wikipedia https://en.wikipedia.org/wiki/Cyclic_redundancy_check#Commonly_used_and_standardized_CRCs ) :
+         * iSCSI, SCTP, G.hn payload, SSE4.2, Btrfs, ext4, Ceph
+         */
+        static constexpr u32 REFLECTED_POLYNOMIAL = 0x82f63b78;
+
+        /** Count of bytes from which `hash` computes 3 interleaved streams with the SSE4.2 crc32 instruction and combines them */
+        static constexpr usize STREAM_MIN_COUNT = 16384;
+
+        /** LookUpTable generated with polynomial 0x82f63b78 */
+        static const u32 CRC32C_LOOKUP[8][256];
+
+        /** Table used for combine */
+        static const u32 X2N_TABLE[32];
+
+        /**
+         * CRC32C hash
+         * Polynomial used is 0x1EDC6F41
+         * Use the SSE4.2 crc32 instruction when the library is compiled with SSE4.2, the Intel slice-by-8 algorithm otherwise.
+         * Buffers of at least `STREAM_MIN_COUNT` bytes are split in 3 streams computed together then combined with `combine`.
+         * @param buffer Pointer to the first byte to hash
+         * @param count Number of bit to hash
+         * @param seed The seed to use. Default is 0.
+         * @return The CRC32C of the buffer
+         */
+        [[nodiscard]] static HD_CORE_DLL u32 hash(const u8 *buffer, usize count, const u32 seed = 0) noexcept;
+
+        /**
+         * CRC32C hash based on Intel slice-by-8 algorithm, whatever the CPU supports
+         * Polynomial used is 0x1EDC6F41
+         * @param buffer Pointer to the first byte to hash
+         * @param count Number of bit to hash
+         * @param seed The seed to use. Default is 0.
+         * @return The CRC32C of the buffer
+         */
+        [[nodiscard]] static HD_CORE_DLL u32 hash_slice_by_8(const u8 *buffer, usize count, const u32 seed = 0) noexcept;
+
+        /**
+         * Combine 2 crc32c hash
+         * @param crc1 The first crc
+         * @param crc2 The second crc
+         * @param count_crc2 The count of bytes used to compute the crc2
+         */
+        [[nodiscard]] static HD_CORE_DLL u32 combine(u32 crc1, u32 crc2, usize count_crc2) noexcept;
     };
 
 } // namespace hud::hash_algorithm
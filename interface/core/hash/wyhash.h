@@ -0,0 +1,158 @@
+#ifndef HD_INC_CORE_HASH_ALGORITHM_WYHASH_H
+#define HD_INC_CORE_HASH_ALGORITHM_WYHASH_H
+#include "../bits.h"
+#include "../memory.h"
+
+// wyhash is a 64 bits hash function written by Wang Yi, released in the public domain (The Unlicense).
+// https://github.com/wangyi-fudan/wyhash
+//
+// This implementation follows the final version 4 of the algorithm.
+// It mixes 64 bits words with one 64x64->128 bits multiplication folded in 64 bits.
+// It is faster than CityHash64 on short keys and on long keys where 128 bits multiplication is a single instruction.
+// Like CityHash64, it is not a cryptographic hash function.
+
+namespace hud::hash_algorithm
+{
+
+    struct wyhash
+    {
+        /** Default secret used to mix the key */
+        static constexpr u64 SECRET[4] = {0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL};
+
+        /**
+         * Multiply two 64 bits values and fold the 128 bits result in 64 bits
+         * @param a The first value
+         * @param b The second value
+         * @return The low 64 bits of the product xor the high 64 bits of the product
+         */
+        [[nodiscard]] static constexpr u64 mix(u64 a, u64 b) noexcept
+        {
+            const u128 product = u128 {a} * u128 {b};
+            return product.low() ^ product.high();
+        }
+
+        /**
+         * Retrieves the 64 bits hash of a 64 bits value
+         * @param value The value to hash
+         * @param seed The seed of the hash
+         * @return The 64 bits hash of the value
+         */
+        [[nodiscard]] static constexpr u64 hash_64(u64 value, u64 seed = 0) noexcept
+        {
+            const u128 product = u128 {value ^ SECRET[0]} * u128 {seed ^ SECRET[1]};
+            return mix(product.low() ^ SECRET[0], product.high() ^ SECRET[1]);
+        }
+
+        /**
+         * Combine two 64 bits hashes
+         * Cheaper than `city_hash::combine_64()`, it costs only one 128 bits multiplication
+         * @param a The first hash to combine
+         * @param b The second hash to combine
+         * @return The 64 bits combined hash
+         */
+        [[nodiscard]] static constexpr u64 combine_64(u64 a, u64 b) noexcept
+        {
+            return mix(a ^ SECRET[0], b ^ SECRET[1]);
+        }
+
+        /**
+         * Performs a 64 bits hash of a buffer using wyhash algorithm
+         * @param buffer The buffer to hash
+         * @param length Length of the key in bytes
+         * @param seed The seed of the hash
+         * @return The 64 bits hash of the key
+         */
+        [[nodiscard]] static constexpr u64 hash_64(const char8 *buffer, usize length, u64 seed = 0) noexcept
+        {
+            seed ^= mix(seed ^ SECRET[0], SECRET[1]);
+            u64 a;
+            u64 b;
+            if (length <= 16) {
+                if (length >= 4) {
+                    const usize middle = (length >> 3) << 2;
+                    a = (static_cast<u64>(fetch_32(buffer)) << 32) | fetch_32(buffer + middle);
+                    b = (static_cast<u64>(fetch_32(buffer + length - 4)) << 32) | fetch_32(buffer + length - 4 - middle);
+                }
+                else if (length > 0) {
+                    a = fetch_1_to_3(buffer, length);
+                    b = 0;
+                }
+                else {
+                    a = 0;
+                    b = 0;
+                }
+            }
+            else {
+                usize remaining = length;
+                if (remaining >= 48) {
+                    // 3 independent lanes of 16 bytes
+                    u64 seed_1 = seed;
+                    u64 seed_2 = seed;
+                    do {
+                        seed = mix(fetch_64(buffer) ^ SECRET[1], fetch_64(buffer + 8) ^ seed);
+                        seed_1 = mix(fetch_64(buffer + 16) ^ SECRET[2], fetch_64(buffer + 24) ^ seed_1);
+                        seed_2 = mix(fetch_64(buffer + 32) ^ SECRET[3], fetch_64(buffer + 40) ^ seed_2);
+                        buffer += 48;
+                        remaining -= 48;
+                    } while (remaining >= 48);
+                    seed ^= seed_1 ^ seed_2;
+                }
+                while (remaining > 16) {
+                    seed = mix(fetch_64(buffer) ^ SECRET[1], fetch_64(buffer + 8) ^ seed);
+                    buffer += 16;
+                    remaining -= 16;
+                }
+                // The last 16 bytes of the key, they can overlap the bytes already mixed
+                a = fetch_64(buffer + remaining - 16);
+                b = fetch_64(buffer + remaining - 8);
+            }
+            const u128 product = u128 {a ^ SECRET[1]} * u128 {b ^ seed};
+            return mix(product.low() ^ SECRET[0] ^ length, product.high() ^ SECRET[1]);
+        }
+
+    private:
+        /**
+         * Load 1 to 3 bytes: the first, the middle and the last byte
+         * @param buffer The buffer
+         * @param length Length of the buffer, between 1 and 3 bytes included
+         * @return The 3 bytes in a 64 bits value
+         */
+        [[nodiscard]] static constexpr u64 fetch_1_to_3(const char8 *buffer, usize length) noexcept
+        {
+            return (static_cast<u64>(static_cast<u8>(buffer[0])) << 16) | (static_cast<u64>(static_cast<u8>(buffer[length >> 1])) << 8) | static_cast<u64>(static_cast<u8>(buffer[length - 1]));
+        }
+
+        /**
+         * Performs a little endian load of 32 bits from a unaligned memory
+         * @param buffer The possibly unaligned memory
+         * @return The 32 bits value
+         */
+        [[nodiscard]] static constexpr u32 fetch_32(const char8 *buffer) noexcept
+        {
+            if constexpr (compilation::is_endianness(endianness::big)) {
+                return hud::bits::reverse_bytes(hud::memory::unaligned_load32(buffer)); // LCOV_EXCL_LINE
+            }
+            else {
+                return hud::memory::unaligned_load32(buffer);
+            }
+        }
+
+        /**
+         * Performs a little endian load of 64 bits from a unaligned memory
+         * @param buffer The possibly unaligned memory
+         * @return The 64 bits value
+         */
+        [[nodiscard]] static constexpr u64 fetch_64(const char8 *buffer) noexcept
+        {
+            if constexpr (compilation::is_endianness(endianness::big)) {
+                return hud::bits::reverse_bytes(hud::memory::unaligned_load64(buffer)); // LCOV_EXCL_LINE
+            }
+            else {
+                return hud::memory::unaligned_load64(buffer);
+            }
+        }
+    };
+
+} // namespace hud::hash_algorithm
+
+#endif // HD_INC_CORE_HASH_ALGORITHM_WYHASH_H
@@ -37,6 +37,9 @@
 #include "../templates/move.h"
 #include "../templates/forward.h"
 #include "../simd.h"
+#if defined(HD_COMPILER_MSVC)
+#include <intrin.h> // _mm_prefetch, __prefetch
+#endif
 
 namespace hud
 {
@@ -336,7 +339,9 @@ namespace hud
          * Reallocate an aligned memory block allocated with allocate_align.
          * If pointer is nullptr, the behaviour is the same has allocate_align.
          * If size is 0, the behaviour is the same has hud::memory::free_align and return value is nullptr.
-         * After a reallocation, pointer is invalidated.
+         * The underlying block is reallocated with realloc, this allow the system to extend the block in place when possible.
+         * If the reallocation failed, nullptr is returned and pointer is still valid.
+         * After a successful reallocation, pointer is invalidated.
          * @param pointer Pointer to memory block to reallocate
          * @param size Number of bytes to reallocate
          * @param alignment Alignment in bytes
@@ -350,12 +355,19 @@ namespace hud
                     return pointer;
                 }
                 usize size_to_copy = size < old_size ? size : old_size;
-                // Realloc alignment mean realloc and copy the data
-                void *aligned_pointer = allocate_align(size, alignment);
-                // Copy the current data to the new buffer
-                copy_memory(aligned_pointer, pointer, size_to_copy);
-                free_align(pointer);
-                return aligned_pointer;
+                void *unaligned_pointer = get_unaligned_pointer(pointer);
+                const uptr old_offset = (const uptr)pointer - (const uptr)unaligned_pointer;
+                void *new_unaligned_pointer = ::realloc(unaligned_pointer, size + alignment + ALIGNED_MALLOC_HEADER_SIZE);
+                if (new_unaligned_pointer == nullptr) [[unlikely]] {
+                    return nullptr;
+                }
+                // The system keep the bytes at the same offset from the start of the block, but the alignment padding can differ in the new block
+                const uptr new_unaligned_address = (const uptr)new_unaligned_pointer;
+                const uptr new_offset = align_address(new_unaligned_address + ALIGNED_MALLOC_HEADER_SIZE, alignment) - new_unaligned_address;
+                if (new_offset != old_offset) {
+                    move_memory(reinterpret_cast<void *>(new_unaligned_address + new_offset), reinterpret_cast<const void *>(new_unaligned_address + old_offset), size_to_copy);
+                }
+                return align_pointer(new_unaligned_pointer, size, alignment);
             }
             else if (!pointer) {
                 return allocate_align(size, alignment);
@@ -1068,7 +1080,7 @@ namespace hud
             return hud::bit_cast<u64>(result);
         }
 
-#if defined(HD_SSE2)
+#if HD_SSE2
         /** Load 128 bits value and return it. */
         [[nodiscard]] static constexpr __m128i unaligned_load128(const i8 *buffer) noexcept
         {
@@ -1082,6 +1094,28 @@ namespace hud
             }
         }
 #endif
+
+        /**
+         * Hints the processor that the cache line containing the address will be read soon.
+         * A prefetch never faults, the address can be invalid or null. Does nothing in a constant-evaluated context.
+         * @param address The address to prefetch
+         */
+        static constexpr HD_FORCEINLINE void prefetch(const void *address) noexcept
+        {
+            if (!hud::is_constant_evaluated())
+            {
+#if defined(HD_COMPILER_MSVC)
+#if defined(HD_TARGET_X86_FAMILY)
+                _mm_prefetch(static_cast<const char *>(address), _MM_HINT_T0);
+#else
+                __prefetch(address);
+#endif
+#else
+                __builtin_prefetch(address);
+#endif
+            }
+        }
+
         /**
          * Call constructor of type.
          * @tparam type_t Type to construct
@@ -1,9 +1,21 @@
 #ifndef HD_INC_CORE_SIMD_H
 #define HD_INC_CORE_SIMD_H
-#if defined(HD_SSE2)
+#if HD_SSE2
 #include <emmintrin.h>
 #endif
-#if defined(HD_SSE4_1)
+#if HD_SSE4_1
 #include <smmintrin.h> // _mm_testz_si128
 #endif
+#if HD_SSE4_2
+#include <nmmintrin.h>
+#endif
+#if HD_AVX2
+#include <immintrin.h>
+#endif
+#if HD_WASM_SIMD128
+#include <wasm_simd128.h>
+#endif
+#if HD_NEON
+#include <arm_neon.h>
+#endif
 #endif // HD_INC_CORE_SIMD_H
\ No newline at end of file
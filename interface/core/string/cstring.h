@@ -2,6 +2,9 @@
 #define HD_INC_CORE_STRING_CSTRING_H
 #include "../character.h"
 #include "../memory.h"
+#include "../bits.h"
+#include "../simd.h"
+#include "../slice.h"
 #include <stdarg.h> // va_start, va_end
 #include <string.h> // strncpy, wcsncpy, wcscat
 
@@ -32,6 +35,228 @@ namespace hud
             return true;
         }
 
+        /**
+         * Test whether the first string_size characters of a string contains only pure ascii characters, stop at the null-terminator character.
+         * @param string The string
+         * @param string_size Size of the string in characters to test
+         * @return true if the string contains only ascii and reach null-terminator character or the string_size character, false otherwise
+         */
+        template<typename char_t>
+        requires(hud::is_one_of_types_v<char_t, char8, wchar, char16, char32>)
+        [[nodiscard]] static constexpr bool is_ascii_safe_portable(const char_t *string, usize string_size) noexcept
+        {
+            while (string_size-- > 0) {
+                char_t cur = *string;
+                if (character::is_null(cur)) {
+                    return true;
+                }
+                if (!character::is_ascii(cur)) {
+                    return false;
+                }
+                string++;
+            }
+            return true;
+        }
+
+#if HD_SSE2 || HD_WASM_SIMD128
+        /** Size in bytes of a SIMD block. */
+        static constexpr usize SIMD_BLOCK_SIZE = 16u;
+
+        /** Number of characters of type char_t in a SIMD block. */
+        template<typename char_t>
+        static constexpr usize SIMD_BLOCK_COUNT = SIMD_BLOCK_SIZE / sizeof(char_t);
+
+        /**
+         * Retrieves the mask of null-terminator characters in a block of `SIMD_BLOCK_COUNT` characters.
+         * @param block Pointer to the block
+         * @return Mask with the bit `i` set if the character `i` is null
+         */
+        template<typename char_t>
+        [[nodiscard]] static HD_FORCEINLINE u32 simd_null_mask(const char_t *block) noexcept
+        {
+#if HD_SSE2
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+            if constexpr (sizeof(char_t) == 1) {
+                return static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_setzero_si128())));
+            }
+            else if constexpr (sizeof(char_t) == 2) {
+                return static_cast<u32>(_mm_movemask_epi8(_mm_packs_epi16(_mm_cmpeq_epi16(chunk, _mm_setzero_si128()), _mm_setzero_si128())));
+            }
+            else {
+                return static_cast<u32>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(chunk, _mm_setzero_si128()))));
+            }
+#else
+            const v128_t chunk = wasm_v128_load(block);
+            if constexpr (sizeof(char_t) == 1) {
+                return static_cast<u32>(wasm_i8x16_bitmask(wasm_i8x16_eq(chunk, wasm_i8x16_splat(0))));
+            }
+            else if constexpr (sizeof(char_t) == 2) {
+                return static_cast<u32>(wasm_i16x8_bitmask(wasm_i16x8_eq(chunk, wasm_i16x8_splat(0))));
+            }
+            else {
+                return static_cast<u32>(wasm_i32x4_bitmask(wasm_i32x4_eq(chunk, wasm_i32x4_splat(0))));
+            }
+#endif
+        }
+
+        /**
+         * Retrieves the mask of non ascii characters in a block of `SIMD_BLOCK_COUNT` characters.
+         * @param block Pointer to the block
+         * @return Mask with the bit `i` set if the character `i` is not an ascii character
+         */
+        template<typename char_t>
+        [[nodiscard]] static HD_FORCEINLINE u32 simd_non_ascii_mask(const char_t *block) noexcept
+        {
+            constexpr u32 block_mask = (1u << SIMD_BLOCK_COUNT<char_t>) - 1u;
+#if HD_SSE2
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+            if constexpr (sizeof(char_t) == 1) {
+                // Non ascii characters have the most significant bit set
+                return static_cast<u32>(_mm_movemask_epi8(chunk));
+            }
+            else if constexpr (sizeof(char_t) == 2) {
+                const __m128i is_ascii = _mm_cmpeq_epi16(_mm_and_si128(chunk, _mm_set1_epi16(static_cast<i16>(0xFF80))), _mm_setzero_si128());
+                return ~static_cast<u32>(_mm_movemask_epi8(_mm_packs_epi16(is_ascii, _mm_setzero_si128()))) & block_mask;
+            }
+            else {
+                const __m128i is_ascii = _mm_cmpeq_epi32(_mm_and_si128(chunk, _mm_set1_epi32(static_cast<i32>(0xFFFFFF80))), _mm_setzero_si128());
+                return ~static_cast<u32>(_mm_movemask_ps(_mm_castsi128_ps(is_ascii))) & block_mask;
+            }
+#else
+            const v128_t chunk = wasm_v128_load(block);
+            if constexpr (sizeof(char_t) == 1) {
+                // Non ascii characters have the most significant bit set
+                return static_cast<u32>(wasm_i8x16_bitmask(chunk));
+            }
+            else if constexpr (sizeof(char_t) == 2) {
+                return static_cast<u32>(wasm_i16x8_bitmask(wasm_i16x8_ne(wasm_v128_and(chunk, wasm_i16x8_splat(static_cast<i16>(0xFF80))), wasm_i16x8_splat(0)))) & block_mask;
+            }
+            else {
+                return static_cast<u32>(wasm_i32x4_bitmask(wasm_i32x4_ne(wasm_v128_and(chunk, wasm_i32x4_splat(static_cast<i32>(0xFFFFFF80))), wasm_i32x4_splat(0)))) & block_mask;
+            }
+#endif
+        }
+
+        /**
+         * Convert a block of `SIMD_BLOCK_COUNT` ascii characters to uppercase or lowercase.
+         * @tparam uppercase true to convert to uppercase, false to convert to lowercase
+         * @param block Pointer to the block. All characters must be ascii characters
+         */
+        template<bool uppercase, typename char_t>
+        static HD_FORCEINLINE void simd_change_case_ascii_block(char_t *block) noexcept
+        {
+            // Letters to convert are in the range [first, first + 26[, the conversion flip the bit 0x20
+            constexpr i32 first = uppercase ? 'a' : 'A';
+#if HD_SSE2
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+            __m128i flip;
+            if constexpr (sizeof(char_t) == 1) {
+                const __m128i in_range = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8(static_cast<i8>(first - 1))), _mm_cmplt_epi8(chunk, _mm_set1_epi8(static_cast<i8>(first + 26))));
+                flip = _mm_and_si128(in_range, _mm_set1_epi8(0x20));
+            }
+            else if constexpr (sizeof(char_t) == 2) {
+                const __m128i in_range = _mm_and_si128(_mm_cmpgt_epi16(chunk, _mm_set1_epi16(static_cast<i16>(first - 1))), _mm_cmplt_epi16(chunk, _mm_set1_epi16(static_cast<i16>(first + 26))));
+                flip = _mm_and_si128(in_range, _mm_set1_epi16(0x20));
+            }
+            else {
+                const __m128i in_range = _mm_and_si128(_mm_cmpgt_epi32(chunk, _mm_set1_epi32(first - 1)), _mm_cmplt_epi32(chunk, _mm_set1_epi32(first + 26)));
+                flip = _mm_and_si128(in_range, _mm_set1_epi32(0x20));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(block), _mm_xor_si128(chunk, flip));
+#else
+            const v128_t chunk = wasm_v128_load(block);
+            v128_t flip;
+            if constexpr (sizeof(char_t) == 1) {
+                const v128_t in_range = wasm_v128_and(wasm_i8x16_gt(chunk, wasm_i8x16_splat(static_cast<i8>(first - 1))), wasm_i8x16_lt(chunk, wasm_i8x16_splat(static_cast<i8>(first + 26))));
+                flip = wasm_v128_and(in_range, wasm_i8x16_splat(0x20));
+            }
+            else if constexpr (sizeof(char_t) == 2) {
+                const v128_t in_range = wasm_v128_and(wasm_i16x8_gt(chunk, wasm_i16x8_splat(static_cast<i16>(first - 1))), wasm_i16x8_lt(chunk, wasm_i16x8_splat(static_cast<i16>(first + 26))));
+                flip = wasm_v128_and(in_range, wasm_i16x8_splat(0x20));
+            }
+            else {
+                const v128_t in_range = wasm_v128_and(wasm_i32x4_gt(chunk, wasm_i32x4_splat(first - 1)), wasm_i32x4_lt(chunk, wasm_i32x4_splat(first + 26)));
+                flip = wasm_v128_and(in_range, wasm_i32x4_splat(0x20));
+            }
+            wasm_v128_store(block, wasm_v128_xor(chunk, flip));
+#endif
+        }
+#endif
+
+        /**
+         * Test whether the first string_size characters of a string contains only pure ascii characters, stop at the null-terminator character.
+         * Blocks of 16 bytes are tested at once with SIMD instructions if available.
+         * @param string The string
+         * @param string_size Size of the string in characters to test
+         * @return true if the string contains only ascii and reach null-terminator character or the string_size character, false otherwise
+         */
+        template<typename char_t>
+        requires(hud::is_one_of_types_v<char_t, char8, wchar, char16, char32>)
+        [[nodiscard]] static bool is_ascii_safe_simd(const char_t *string, usize string_size) noexcept
+        {
+#if HD_SSE2 || HD_WASM_SIMD128
+            for (; string_size >= SIMD_BLOCK_COUNT<char_t>; string_size -= SIMD_BLOCK_COUNT<char_t>, string += SIMD_BLOCK_COUNT<char_t>) {
+                const u32 non_ascii_mask = simd_non_ascii_mask(string);
+                const u32 null_mask = simd_null_mask(string);
+                // Only characters before the null-terminator character are tested
+                if (null_mask != 0u) {
+                    return (non_ascii_mask & ((1u << hud::bits::trailing_zeros(null_mask)) - 1u)) == 0u;
+                }
+                if (non_ascii_mask != 0u) {
+                    return false;
+                }
+            }
+#endif
+            return is_ascii_safe_portable(string, string_size);
+        }
+
+        /**
+         * Convert the first count characters of a string to uppercase or lowercase.
+         * Blocks of 16 bytes of ascii characters are converted at once with SIMD instructions if available,
+         * other characters are converted with the C locale functions.
+         * @tparam uppercase true to convert to uppercase, false to convert to lowercase
+         * @param string The string buffer to convert
+         * @param count Number of character to convert
+         */
+        template<bool uppercase, typename char_t>
+        requires(hud::is_one_of_types_v<char_t, char8, wchar>)
+        static void ascii_change_case(char_t *string, usize count) noexcept
+        {
+#if HD_SSE2 || HD_WASM_SIMD128
+            for (; count >= SIMD_BLOCK_COUNT<char_t>; count -= SIMD_BLOCK_COUNT<char_t>, string += SIMD_BLOCK_COUNT<char_t>) {
+                if (simd_non_ascii_mask(string) == 0u) [[likely]] {
+                    simd_change_case_ascii_block<uppercase>(string);
+                }
+                else {
+                    for (usize index = 0; index < SIMD_BLOCK_COUNT<char_t>; index++) {
+                        string[index] = uppercase ? character::to_uppercase(string[index]) : character::to_lowercase(string[index]);
+                    }
+                }
+            }
+#endif
+            for (; count > 0; count--, string++) {
+                *string = uppercase ? character::to_uppercase(*string) : character::to_lowercase(*string);
+            }
+        }
+
+        /**
+         * Retrieve the length of a string, up to max_length characters.
+         * @param string The string
+         * @param max_length Maximum number of character to count
+         * @return Length of the string, max_length if null-terminator character was not found
+         */
+        template<typename char_t>
+        requires(hud::is_one_of_types_v<char_t, char8, wchar>)
+        [[nodiscard]] static usize length_bounded(const char_t *string, const usize max_length) noexcept
+        {
+            if constexpr (hud::is_same_v<char_t, char8>) {
+                return strnlen(string, max_length);
+            }
+            else {
+                return wcsnlen(string, max_length);
+            }
+        }
+
         /**
          * Compare two strings with case sensitive comparison.
          * @param string_0 Null-terminated string
@@ -138,6 +363,108 @@ namespace hud
             }
             return nullptr;
         }
+
+        /**
+         * Find a string in another string with known lengths.
+         * @param string The string to be scanned
+         * @param string_length Number of characters in string
+         * @param string_to_find The string to find
+         * @param string_to_find_length Number of characters in string_to_find
+         * @return Pointer to the first occurrence of string in another string, nullptr if not found
+         */
+        template<typename type_t>
+        requires(hud::is_one_of_types_v<type_t, char8, wchar, char16, char32>)
+        [[nodiscard]] static constexpr const type_t *find_string_portable(const type_t *string, const usize string_length, const type_t *const string_to_find, const usize string_to_find_length) noexcept
+        {
+            if (string_to_find_length > string_length) [[unlikely]] {
+                return nullptr;
+            }
+            const type_t *const last = string + (string_length - string_to_find_length);
+            for (; string <= last; ++string) {
+                usize index = 0;
+                while (index < string_to_find_length && string[index] == string_to_find[index]) {
+                    ++index;
+                }
+                if (index == string_to_find_length) {
+                    return string;
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * Find a character in a string with known length.
+         * @param string The string to be scanned
+         * @param string_length Number of characters in string
+         * @param character_to_find The character to find
+         * @return Pointer to the first occurrence of the character in the string, nullptr if not found
+         */
+        template<typename type_t>
+        requires(hud::is_one_of_types_v<type_t, char8, wchar, char16, char32>)
+        [[nodiscard]] static constexpr const type_t *find_character_portable(const type_t *string, const usize string_length, const type_t character_to_find) noexcept
+        {
+            for (const type_t *const end = string + string_length; string < end; ++string) {
+                if (*string == character_to_find)
+                    return string;
+            }
+            return nullptr;
+        }
+
+        /**
+         * Find a string in another string with known lengths.
+         * Blocks of 16 positions are filtered at once with SIMD instructions if available by comparing the first and the last character of string_to_find,
+         * only positions matching both are compared with the whole string_to_find.
+         * @param string The string to be scanned
+         * @param string_length Number of characters in string
+         * @param string_to_find The string to find
+         * @param string_to_find_length Number of characters in string_to_find
+         * @return Pointer to the first occurrence of string in another string, nullptr if not found
+         */
+        [[nodiscard]] static const char8 *find_string_simd(const char8 *string, const usize string_length, const char8 *const string_to_find, const usize string_to_find_length) noexcept
+        {
+            if (string_to_find_length == 0u) [[unlikely]] {
+                return string;
+            }
+            if (string_to_find_length > string_length) [[unlikely]] {
+                return nullptr;
+            }
+            if (string_to_find_length == 1u) {
+                return static_cast<const char8 *>(memchr(string, string_to_find[0], string_length));
+            }
+            usize pos = 0;
+#if HD_SSE2 || HD_WASM_SIMD128
+            const usize last_offset = string_to_find_length - 1u;
+#if HD_SSE2
+            const __m128i first = _mm_set1_epi8(string_to_find[0]);
+            const __m128i last = _mm_set1_epi8(string_to_find[last_offset]);
+#else
+            const v128_t first = wasm_i8x16_splat(string_to_find[0]);
+            const v128_t last = wasm_i8x16_splat(string_to_find[last_offset]);
+#endif
+            // The last character of the block must be in the string
+            for (; pos + last_offset + SIMD_BLOCK_SIZE <= string_length; pos += SIMD_BLOCK_SIZE) {
+#if HD_SSE2
+                const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(string + pos));
+                const __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i *>(string + pos + last_offset));
+                u32 candidates = static_cast<u32>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last))));
+#else
+                const v128_t block_first = wasm_v128_load(string + pos);
+                const v128_t block_last = wasm_v128_load(string + pos + last_offset);
+                u32 candidates = static_cast<u32>(wasm_i8x16_bitmask(wasm_v128_and(wasm_i8x16_eq(first, block_first), wasm_i8x16_eq(last, block_last))));
+#endif
+                while (candidates != 0u) {
+                    const usize candidate_pos = pos + hud::bits::trailing_zeros(candidates);
+                    // First and last characters already match
+                    if (hud::memory::compare_memory(string + candidate_pos + 1u, string_to_find + 1u, string_to_find_length - 2u) == 0) {
+                        return string + candidate_pos;
+                    }
+                    // Clear the lowest candidate
+                    candidates &= candidates - 1u;
+                }
+            }
+#endif
+            return find_string_portable(string + pos, string_length - pos, string_to_find, string_to_find_length);
+        }
         /**
          * Retrieve the length of a string and check the given parameters.
          * @param string Null-terminated string
@@ -267,7 +594,16 @@ namespace hud
         requires(hud::is_one_of_types_v<char_t, char8, wchar, char16, char32>)
         [[nodiscard]] static constexpr bool is_ascii(const char_t *string) noexcept
         {
-            return hud::details::cstring::is_ascii_portable(string);
+            if consteval {
+                return hud::details::cstring::is_ascii_portable(string);
+            }
+            else {
+                if (string == nullptr) [[unlikely]] {
+                    return false;
+                }
+                // The length is computed first so SIMD blocks never read after the null-terminator character
+                return hud::details::cstring::is_ascii_safe_simd(string, length(string));
+            }
         }
 
         /**
@@ -284,18 +620,12 @@ namespace hud
             if (string == nullptr) [[unlikely]] {
                 return false;
             }
-
-            while (string_size-- > 0) {
-                char_t cur = *string;
-                if (character::is_null(cur)) {
-                    return true;
-                }
-                if (!character::is_ascii(cur)) {
-                    return false;
-                }
-                string++;
+            if consteval {
+                return hud::details::cstring::is_ascii_safe_portable(string, string_size);
+            }
+            else {
+                return hud::details::cstring::is_ascii_safe_simd(string, string_size);
             }
-            return true;
         }
 
         /**
@@ -452,11 +782,7 @@ namespace hud
         requires(hud::is_one_of_types_v<type_t, char8, wchar>)
         static type_t *ascii_to_uppercase(type_t *string) noexcept
         {
-            type_t *ptr = string;
-            while (!character::is_null(*ptr)) {
-                type_t *cur = ptr++;
-                *cur = character::to_uppercase(*cur);
-            }
+            hud::details::cstring::ascii_change_case<true>(string, length(string));
             return string;
         }
 
@@ -474,14 +800,10 @@ namespace hud
                 return false;
             }
 
-            while (string_size-- > 0) {
-                type_t *cur = string++;
-                if (character::is_null(*cur)) {
-                    return false;
-                }
-                *cur = character::to_uppercase(*cur);
-            }
-            return character::is_null(*string);
+            // Stop at the null-terminator character if reached before string_size characters
+            const usize string_length = hud::details::cstring::length_bounded(string, string_size);
+            hud::details::cstring::ascii_change_case<true>(string, string_length);
+            return string_length == string_size && character::is_null(string[string_size]);
         }
 
         /**
@@ -494,11 +816,7 @@ namespace hud
         requires(hud::is_one_of_types_v<type_t, char8, wchar>)
         static type_t *ascii_to_uppercase_partial(type_t *string, usize count) noexcept
         {
-            type_t *ptr = string;
-            while (count-- > 0) {
-                *ptr = character::to_uppercase(*ptr);
-                ptr++;
-            }
+            hud::details::cstring::ascii_change_case<true>(string, count);
             return string;
         }
 
@@ -517,16 +835,10 @@ namespace hud
                 return false;
             }
 
-            const usize not_capatilized_count = string_size - count;
-            while (string_size-- > not_capatilized_count) {
-                type_t *cur = string++;
-                if (character::is_null(*cur)) {
-                    return false;
-                }
-                *cur = character::to_uppercase(*cur);
-            }
-
-            return true;
+            // Stop at the null-terminator character if reached before count characters
+            const usize string_length = hud::details::cstring::length_bounded(string, count);
+            hud::details::cstring::ascii_change_case<true>(string, string_length);
+            return string_length == count;
         }
 
         /**
@@ -538,11 +850,7 @@ namespace hud
         requires(hud::is_one_of_types_v<type_t, char8, wchar>)
         static HD_FORCEINLINE type_t *ascii_to_lowercase(type_t *string) noexcept
         {
-            type_t *ptr = string;
-            while (!character::is_null(*ptr)) {
-                *ptr = character::to_lowercase(*ptr);
-                ptr++;
-            }
+            hud::details::cstring::ascii_change_case<false>(string, length(string));
             return string;
         }
 
@@ -560,15 +868,10 @@ namespace hud
                 return false;
             }
 
-            type_t *ptr = string;
-            while (string_size-- > 0) {
-                if (character::is_null(*ptr)) {
-                    return false;
-                }
-                *ptr = character::to_lowercase(*ptr);
-                ptr++;
-            }
-            return character::is_null(*ptr);
+            // Stop at the null-terminator character if reached before string_size characters
+            const usize string_length = hud::details::cstring::length_bounded(string, string_size);
+            hud::details::cstring::ascii_change_case<false>(string, string_length);
+            return string_length == string_size && character::is_null(string[string_size]);
         }
 
         /**
@@ -581,11 +884,7 @@ namespace hud
         requires(hud::is_one_of_types_v<type_t, char8, wchar>)
         static type_t *ascii_to_lowercase_partial(type_t *string, usize count) noexcept
         {
-            type_t *ptr = string;
-            while (count-- > 0) {
-                *ptr = character::to_lowercase(*ptr);
-                ptr++;
-            }
+            hud::details::cstring::ascii_change_case<false>(string, count);
             return string;
         }
 
@@ -604,16 +903,10 @@ namespace hud
                 return false;
             }
 
-            const usize not_minimized_count = string_size - count;
-            while (string_size-- > not_minimized_count) {
-                type_t *cur = string++;
-                if (character::is_null(*cur)) {
-                    return false;
-                }
-                *cur = character::to_lowercase(*cur);
-            }
-
-            return true;
+            // Stop at the null-terminator character if reached before count characters
+            const usize string_length = hud::details::cstring::length_bounded(string, count);
+            hud::details::cstring::ascii_change_case<false>(string, string_length);
+            return string_length == count;
         }
 
         /**
@@ -807,6 +1100,123 @@ namespace hud
             }
         }
 
+        /**
+         * Find a string in another string with known lengths.
+         * The strings don't need to be null-terminated and are never scanned for the null-terminator character.
+         * @param string The string to be scanned
+         * @param string_length Number of characters in string
+         * @param string_to_find The string to find
+         * @param string_to_find_length Number of characters in string_to_find
+         * @return Pointer to the first occurrence of string in another string, nullptr if not found
+         */
+        [[nodiscard]] static constexpr const char8 *find_string(const char8 *string, const usize string_length, const char8 *const string_to_find, const usize string_to_find_length) noexcept
+        {
+            if consteval {
+                return hud::details::cstring::find_string_portable(string, string_length, string_to_find, string_to_find_length);
+            }
+            else {
+                return hud::details::cstring::find_string_simd(string, string_length, string_to_find, string_to_find_length);
+            }
+        }
+
+        /**
+         * Find a string in another string with known lengths.
+         * The strings don't need to be null-terminated and are never scanned for the null-terminator character.
+         * @param string The string to be scanned
+         * @param string_length Number of characters in string
+         * @param string_to_find The string to find
+         * @param string_to_find_length Number of characters in string_to_find
+         * @return Pointer to the first occurrence of string in another string, nullptr if not found
+         */
+        [[nodiscard]] static constexpr const wchar *find_string(const wchar *string, const usize string_length, const wchar *const string_to_find, const usize string_to_find_length) noexcept
+        {
+            if consteval {
+                return hud::details::cstring::find_string_portable(string, string_length, string_to_find, string_to_find_length);
+            }
+            else {
+                if (string_to_find_length == 0u) [[unlikely]] {
+                    return string;
+                }
+                // Jump from one occurrence of the first character to the next
+                const wchar *const end = string + string_length;
+                while (static_cast<usize>(end - string) >= string_to_find_length) {
+                    string = wmemchr(string, string_to_find[0], static_cast<usize>(end - string) - string_to_find_length + 1u);
+                    if (string == nullptr) {
+                        return nullptr;
+                    }
+                    if (wmemcmp(string + 1, string_to_find + 1, string_to_find_length - 1u) == 0) {
+                        return string;
+                    }
+                    string++;
+                }
+                return nullptr;
+            }
+        }
+
+        /**
+         * Find a string in another string given as slices.
+         * The returned pointer has the same constness as the scanned slice.
+         * @param string The string to be scanned
+         * @param string_to_find The string to find
+         * @return Pointer to the first occurrence of string in another string, nullptr if not found
+         */
+        template<typename char_t, typename char_to_find_t>
+        requires(hud::is_one_of_types_v<hud::remove_const_t<char_t>, char8, wchar> && hud::is_same_v<hud::remove_const_t<char_t>, hud::remove_const_t<char_to_find_t>>)
+        [[nodiscard]] static constexpr char_t *find_string(const hud::slice<char_t> string, const hud::slice<char_to_find_t> string_to_find) noexcept
+        {
+            return const_cast<char_t *>(find_string(string.data(), string.count(), string_to_find.data(), string_to_find.count()));
+        }
+
+        /**
+         * Find a character in a string with known length.
+         * The string doesn't need to be null-terminated and is never scanned for the null-terminator character.
+         * @param string The string to be scanned
+         * @param string_length Number of characters in string
+         * @param character_to_find The character to find
+         * @return Pointer to the first occurrence of the character in the string, nullptr if not found
+         */
+        [[nodiscard]] static constexpr const char8 *find_character(const char8 *string, const usize string_length, const char8 character_to_find) noexcept
+        {
+            if consteval {
+                return hud::details::cstring::find_character_portable(string, string_length, character_to_find);
+            }
+            else {
+                return static_cast<const char8 *>(memchr(string, character_to_find, string_length));
+            }
+        }
+
+        /**
+         * Find a character in a string with known length.
+         * The string doesn't need to be null-terminated and is never scanned for the null-terminator character.
+         * @param string The string to be scanned
+         * @param string_length Number of characters in string
+         * @param character_to_find The character to find
+         * @return Pointer to the first occurrence of the character in the string, nullptr if not found
+         */
+        [[nodiscard]] static constexpr const wchar *find_character(const wchar *string, const usize string_length, const wchar character_to_find) noexcept
+        {
+            if consteval {
+                return hud::details::cstring::find_character_portable(string, string_length, character_to_find);
+            }
+            else {
+                return wmemchr(string, character_to_find, string_length);
+            }
+        }
+
+        /**
+         * Find a character in a string given as slice.
+         * The returned pointer has the same constness as the scanned slice.
+         * @param string The string to be scanned
+         * @param character_to_find The character to find
+         * @return Pointer to the first occurrence of the character in the string, nullptr if not found
+         */
+        template<typename char_t>
+        requires(hud::is_one_of_types_v<hud::remove_const_t<char_t>, char8, wchar>)
+        [[nodiscard]] static constexpr char_t *find_character(const hud::slice<char_t> string, const hud::remove_const_t<char_t> character_to_find) noexcept
+        {
+            return const_cast<char_t *>(find_character(string.data(), string.count(), character_to_find));
+        }
+
         /**
          * Copy ansi string and assert the given parameters.
          * @param destination The destination char8 buffer
@@ -1,6 +1,8 @@
 #ifndef HD_INC_CORE_STRING_ENCODING_UTF8_H
 #define HD_INC_CORE_STRING_ENCODING_UTF8_H
 #include "../../slice.h"
+#include "../../memory.h"
+#include "../../simd.h"
 #include "../../traits/is_same.h"
 #include "../../traits/remove_cv.h"
 
@@ -153,6 +155,222 @@ namespace hud::encoding
         return true;
     }
 
+    namespace details::utf8
+    {
+        // Error bits of the lookup tables used by the SIMD validators.
+        // Each table gives the errors possible for a nibble, an error is found when a bit is set in the 3 tables.
+        // See "Validating UTF-8 In Less Than One Instruction Per Byte" by John Keiser and Daniel Lemire.
+        /** A lead byte is followed by an ASCII or a lead byte. */
+        static constexpr u8 TOO_SHORT = 1u << 0u;
+        /** An ASCII byte is followed by a continuation byte. */
+        static constexpr u8 TOO_LONG = 1u << 1u;
+        /** 3-byte sequence that encode a code point lower than U+0800. */
+        static constexpr u8 OVERLONG_3 = 1u << 2u;
+        /** 4-byte sequence that encode a code point greater than U+10FFFF. */
+        static constexpr u8 TOO_LARGE = 1u << 3u;
+        /** 3-byte sequence that encode a surrogate [U+D800, U+DFFF]. */
+        static constexpr u8 SURROGATE = 1u << 4u;
+        /** 2-byte sequence that encode a code point lower than U+0080. */
+        static constexpr u8 OVERLONG_2 = 1u << 5u;
+        /** 4-byte sequence with a lead byte 0xF4 or more followed by a continuation byte of 0x90 or more. */
+        static constexpr u8 TOO_LARGE_1000 = 1u << 6u;
+        /** 4-byte sequence that encode a code point lower than U+10000. */
+        static constexpr u8 OVERLONG_4 = 1u << 6u;
+        /** Two continuation bytes in a row, valid only in 3 and 4-byte sequences. */
+        static constexpr u8 TWO_CONTS = 1u << 7u;
+        /** Errors that don't depend on the low nibble of the first byte. */
+        static constexpr u8 CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+        // clang-format off
+        /** Errors indexed by the high nibble of the first byte. */
+        static constexpr u8 BYTE_1_HIGH[16] = {
+            // 0_______ ________ <ASCII in byte 1>
+            TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+            // 10______ ________ <continuation in byte 1>
+            TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+            // 1100____ ________ <two byte lead in byte 1>
+            TOO_SHORT | OVERLONG_2,
+            // 1101____ ________ <two byte lead in byte 1>
+            TOO_SHORT,
+            // 1110____ ________ <three byte lead in byte 1>
+            TOO_SHORT | OVERLONG_3 | SURROGATE,
+            // 1111____ ________ <four+ byte lead in byte 1>
+            TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+        };
+
+        /** Errors indexed by the low nibble of the first byte. */
+        static constexpr u8 BYTE_1_LOW[16] = {
+            // ____0000 ________
+            CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+            // ____0001 ________
+            CARRY | OVERLONG_2,
+            // ____001_ ________
+            CARRY, CARRY,
+            // ____0100 ________
+            CARRY | TOO_LARGE,
+            // ____0101 ________
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            // ____011_ ________
+            CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+            // ____1___ ________
+            CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+            // ____1101 ________
+            CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+            CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000
+        };
+
+        /** Errors indexed by the high nibble of the second byte. */
+        static constexpr u8 BYTE_2_HIGH[16] = {
+            // ________ 0_______ <ASCII in byte 2>
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+            // ________ 1000____
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+            // ________ 1001____
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+            // ________ 101_____
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE, TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+            // ________ 11______
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+        };
+        // clang-format on
+
+    } // namespace details::utf8
+
+#if HD_SSE4_2
+    /**
+     * Validates whether a given byte sequence is well-formed UTF-8 with SSE4.2 instructions.
+     *
+     * Process 16 bytes at a time, blocks of ASCII bytes are skipped with a single test.
+     * Other blocks are checked with 3 nibble lookup tables that find all 2-byte sequence errors at once,
+     * then 3 and 4-byte sequences are checked by ensuring that continuation bytes are expected where the lookup found two continuations in a row.
+     * The last partial block is copied in a zero-padded block.
+     *
+     * @tparam char_t Expected character type (must be `char8` or equivalent).
+     * @param string UTF-8 byte sequence to validate.
+     * @return true if the input is valid UTF-8, false otherwise.
+     */
+    template<typename char_t>
+    requires(sizeof(char_t) == 1)
+    [[nodiscard]] static bool is_valid_utf8_sse4_2(const hud::slice<char_t> string) noexcept
+    {
+        const __m128i byte_1_high_table = _mm_loadu_si128(reinterpret_cast<const __m128i *>(details::utf8::BYTE_1_HIGH));
+        const __m128i byte_1_low_table = _mm_loadu_si128(reinterpret_cast<const __m128i *>(details::utf8::BYTE_1_LOW));
+        const __m128i byte_2_high_table = _mm_loadu_si128(reinterpret_cast<const __m128i *>(details::utf8::BYTE_2_HIGH));
+        const __m128i low_nibble_mask = _mm_set1_epi8(0x0F);
+        // Only the last 3 bytes of a block can start an incomplete sequence
+        const __m128i incomplete_max = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+
+        __m128i error = _mm_setzero_si128();
+        __m128i previous_input = _mm_setzero_si128();
+        __m128i previous_incomplete = _mm_setzero_si128();
+
+        const auto check_block = [&](const __m128i input) {
+            // Block of ASCII, only an incomplete sequence at the end of the previous block is an error
+            if (_mm_movemask_epi8(input) == 0) {
+                error = _mm_or_si128(error, previous_incomplete);
+                return;
+            }
+            const __m128i previous_1 = _mm_alignr_epi8(input, previous_input, 15);
+            const __m128i byte_1_high = _mm_shuffle_epi8(byte_1_high_table, _mm_and_si128(_mm_srli_epi16(previous_1, 4), low_nibble_mask));
+            const __m128i byte_1_low = _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(previous_1, low_nibble_mask));
+            const __m128i byte_2_high = _mm_shuffle_epi8(byte_2_high_table, _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble_mask));
+            const __m128i special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+            // Continuation bytes expected in 3rd and 4th position must match the TWO_CONTS bit
+            const __m128i previous_2 = _mm_alignr_epi8(input, previous_input, 14);
+            const __m128i previous_3 = _mm_alignr_epi8(input, previous_input, 13);
+            const __m128i is_third_byte = _mm_subs_epu8(previous_2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+            const __m128i is_fourth_byte = _mm_subs_epu8(previous_3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+            const __m128i must_be_continuation = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(static_cast<char>(0x80)));
+            error = _mm_or_si128(error, _mm_xor_si128(must_be_continuation, special_cases));
+
+            previous_incomplete = _mm_subs_epu8(input, incomplete_max);
+            previous_input = input;
+        };
+
+        const u8 *data = reinterpret_cast<const u8 *>(string.data());
+        const usize byte_count = string.byte_count();
+        usize pos = 0;
+        for (; pos + 16u <= byte_count; pos += 16u) {
+            check_block(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + pos)));
+        }
+        if (pos < byte_count) {
+            alignas(16) u8 last_block[16] = {};
+            hud::memory::copy_memory(last_block, data + pos, byte_count - pos);
+            check_block(_mm_load_si128(reinterpret_cast<const __m128i *>(last_block)));
+        }
+        error = _mm_or_si128(error, previous_incomplete);
+        return _mm_testz_si128(error, error) != 0;
+    }
+#endif
+
+#if HD_AVX2
+    /**
+     * Validates whether a given byte sequence is well-formed UTF-8 with AVX2 instructions.
+     *
+     * Same algorithm as `is_valid_utf8_sse4_2` on blocks of 32 bytes.
+     *
+     * @tparam char_t Expected character type (must be `char8` or equivalent).
+     * @param string UTF-8 byte sequence to validate.
+     * @return true if the input is valid UTF-8, false otherwise.
+     */
+    template<typename char_t>
+    requires(sizeof(char_t) == 1)
+    [[nodiscard]] static bool is_valid_utf8_avx2(const hud::slice<char_t> string) noexcept
+    {
+        const __m256i byte_1_high_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(details::utf8::BYTE_1_HIGH)));
+        const __m256i byte_1_low_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(details::utf8::BYTE_1_LOW)));
+        const __m256i byte_2_high_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(details::utf8::BYTE_2_HIGH)));
+        const __m256i low_nibble_mask = _mm256_set1_epi8(0x0F);
+        // Only the last 3 bytes of a block can start an incomplete sequence
+        const __m256i incomplete_max = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+
+        __m256i error = _mm256_setzero_si256();
+        __m256i previous_input = _mm256_setzero_si256();
+        __m256i previous_incomplete = _mm256_setzero_si256();
+
+        const auto check_block = [&](const __m256i input) {
+            // Block of ASCII, only an incomplete sequence at the end of the previous block is an error
+            if (_mm256_movemask_epi8(input) == 0) {
+                error = _mm256_or_si256(error, previous_incomplete);
+                return;
+            }
+            // alignr works on 128 bits lanes, build the vector of the 16 bytes before each lane
+            const __m256i previous_lanes = _mm256_permute2x128_si256(previous_input, input, 0x21);
+            const __m256i previous_1 = _mm256_alignr_epi8(input, previous_lanes, 15);
+            const __m256i byte_1_high = _mm256_shuffle_epi8(byte_1_high_table, _mm256_and_si256(_mm256_srli_epi16(previous_1, 4), low_nibble_mask));
+            const __m256i byte_1_low = _mm256_shuffle_epi8(byte_1_low_table, _mm256_and_si256(previous_1, low_nibble_mask));
+            const __m256i byte_2_high = _mm256_shuffle_epi8(byte_2_high_table, _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble_mask));
+            const __m256i special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+            // Continuation bytes expected in 3rd and 4th position must match the TWO_CONTS bit
+            const __m256i previous_2 = _mm256_alignr_epi8(input, previous_lanes, 14);
+            const __m256i previous_3 = _mm256_alignr_epi8(input, previous_lanes, 13);
+            const __m256i is_third_byte = _mm256_subs_epu8(previous_2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+            const __m256i is_fourth_byte = _mm256_subs_epu8(previous_3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+            const __m256i must_be_continuation = _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte), _mm256_set1_epi8(static_cast<char>(0x80)));
+            error = _mm256_or_si256(error, _mm256_xor_si256(must_be_continuation, special_cases));
+
+            previous_incomplete = _mm256_subs_epu8(input, incomplete_max);
+            previous_input = input;
+        };
+
+        const u8 *data = reinterpret_cast<const u8 *>(string.data());
+        const usize byte_count = string.byte_count();
+        usize pos = 0;
+        for (; pos + 32u <= byte_count; pos += 32u) {
+            check_block(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + pos)));
+        }
+        if (pos < byte_count) {
+            alignas(32) u8 last_block[32] = {};
+            hud::memory::copy_memory(last_block, data + pos, byte_count - pos);
+            check_block(_mm256_load_si256(reinterpret_cast<const __m256i *>(last_block)));
+        }
+        error = _mm256_or_si256(error, previous_incomplete);
+        return _mm256_testz_si256(error, error) != 0;
+    }
+#endif
+
     /**
      * Validates whether a given byte sequence is well-formed UTF-8 according to the Unicode specification.
      *
@@ -164,7 +382,7 @@ namespace hud::encoding
      * - Disallowed values (such as surrogates [U+D800, U+DFFF]) are rejected.
      * - Code points above U+10FFFF are rejected.
      *
-     * An optimization is applied to quickly skip blocks of 16 consecutive ASCII bytes in a single operation.
+     * Use the AVX2 or SSE4.2 validator when available, the portable validator in constant evaluated expression.
      *
      * @tparam char_t Expected character type (must be `char8` or equivalent).
      * @param string UTF-8 byte sequence to validate.
@@ -174,7 +392,18 @@ namespace hud::encoding
     requires(sizeof(char_t) == 1)
     [[nodiscard]] static constexpr bool is_valid_utf8(const hud::slice<char_t> string) noexcept
     {
-        return is_valid_utf8_portable(string);
+        if consteval {
+            return is_valid_utf8_portable(string);
+        }
+        else {
+#if HD_AVX2
+            return is_valid_utf8_avx2(string);
+#elif HD_SSE4_2
+            return is_valid_utf8_sse4_2(string);
+#else
+            return is_valid_utf8_portable(string);
+#endif
+        }
     }
 
 } // namespace hud::encoding
@@ -89,7 +89,7 @@ namespace hud::common
      * @param right Right-hand side uuid
      * @return true if left equal right, false otherwise
      */
-    [[nodiscard]] bool operator==(const uuid &left, const uuid &right) noexcept
+    [[nodiscard]] inline bool operator==(const uuid &left, const uuid &right) noexcept
     {
         return hud::memory::is_memory_compare_equal(&left, &right, sizeof(uuid));
     }
@@ -100,7 +100,7 @@ namespace hud::common
      * @param right Right-hand side uuid
      * @return true if left is not equal right, false otherwise
      */
-    [[nodiscard]] bool operator!=(const uuid &left, const uuid &right) noexcept
+    [[nodiscard]] inline bool operator!=(const uuid &left, const uuid &right) noexcept
     {
         return !(left == right);
     }
@@ -0,0 +1,21 @@
+#include <core/hash.h>
+#include <core/uuid.h>
+
+namespace hud
+{
+    u64 process_hash_seed() noexcept
+    {
+        static const u64 seed = []() {
+            // A version 4 uuid is 122 random bits read from the OS random generator
+            hud::uuid random;
+            if (!hud::uuid::create(random)) [[unlikely]]
+            {
+                // LCOV_EXCL_START ( Supposed never failed, else fall back on a stack address randomized by ASLR )
+                return hud::hash_algorithm::wyhash::hash_64(static_cast<u64>(reinterpret_cast<uptr>(&random)));
+                // LCOV_EXCL_STOP
+            }
+            return hud::hash_algorithm::wyhash::hash_64((static_cast<u64>(random.a) << 32) | random.b, (static_cast<u64>(random.c) << 32) | random.d);
+        }();
+        return seed;
+    }
+} // namespace hud
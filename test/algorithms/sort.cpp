@@ -0,0 +1,185 @@
+#include <core/algorithms/sort.h>
+
+namespace hud_test
+{
+    /** Fill an array with pseudo random values in [0, modulo). */
+    template<typename type_t, usize count>
+    constexpr void fill_pseudo_random(type_t (&array)[count], u32 modulo, u32 seed = 12345u) noexcept
+    {
+        for (usize index = 0; index < count; index++) {
+            seed = seed * 1103515245u + 12345u;
+            array[index] = static_cast<type_t>((seed >> 8u) % modulo);
+        }
+    }
+
+    template<typename type_t, typename less_t = hud::less<type_t>>
+    constexpr bool is_sorted(const type_t *begin, const type_t *end, less_t less = less_t {}) noexcept
+    {
+        for (const type_t *current = begin + 1; current < end; current++) {
+            if (less(*current, *(current - 1))) {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace hud_test
+
+GTEST_TEST(sort, sort_empty_and_single_element)
+{
+    i32 array[1] = {42};
+    hud::sort(array, array);
+    hud::sort(array, array + 1);
+    hud_assert_eq(array[0], 42);
+}
+
+GTEST_TEST(sort, sort_integral)
+{
+    hud_test::for_each_type<i8, i16, i32, i64, u8, u16, u32, u64>()([]<typename type_t>() {
+        type_t array[1000];
+        for (u32 modulo : {2u, 17u, 100u}) {
+            hud_test::fill_pseudo_random(array, modulo);
+            hud::sort(array, array + 1000);
+            hud_assert_true(hud_test::is_sorted(array, array + 1000));
+        }
+    });
+}
+
+GTEST_TEST(sort, sort_already_sorted_and_reversed)
+{
+    i32 array[1000];
+    for (i32 index = 0; index < 1000; index++) {
+        array[index] = index;
+    }
+    hud::sort(array, array + 1000);
+    hud_assert_true(hud_test::is_sorted(array, array + 1000));
+
+    for (i32 index = 0; index < 1000; index++) {
+        array[index] = 1000 - index;
+    }
+    hud::sort(hud::slice<i32>(array, 1000));
+    hud_assert_true(hud_test::is_sorted(array, array + 1000));
+}
+
+GTEST_TEST(sort, sort_with_custom_less)
+{
+    i32 array[100];
+    hud_test::fill_pseudo_random(array, 50u);
+    const auto greater = [](const i32 &a, const i32 &b) { return a > b; };
+    hud::sort(array, array + 100, greater);
+    hud_assert_true(hud_test::is_sorted(array, array + 100, greater));
+}
+
+GTEST_TEST(sort, sort_non_bitwise_type)
+{
+    hud_test::non_bitwise_type array[200];
+    i32 ids[200];
+    hud_test::fill_pseudo_random(ids, 1000u);
+    for (usize index = 0; index < 200; index++) {
+        array[index] = hud_test::non_bitwise_type(ids[index]);
+    }
+    const auto less = [](const hud_test::non_bitwise_type &a, const hud_test::non_bitwise_type &b) { return a.id() < b.id(); };
+    hud::sort(array, array + 200, less);
+    hud_assert_true(hud_test::is_sorted(array, array + 200, less));
+}
+
+GTEST_TEST(sort, stable_sort_keep_order_of_equal_elements)
+{
+    struct element
+    {
+        i32 key;
+        i32 order;
+    };
+
+    element array[500];
+    i32 keys[500];
+    hud_test::fill_pseudo_random(keys, 10u);
+    for (i32 index = 0; index < 500; index++) {
+        array[index] = {keys[index], index};
+    }
+    hud::stable_sort(hud::slice<element>(array, 500), [](const element &a, const element &b) { return a.key < b.key; });
+    for (usize index = 1; index < 500; index++) {
+        hud_assert_true(array[index - 1].key <= array[index].key);
+        if (array[index - 1].key == array[index].key) {
+            hud_assert_true(array[index - 1].order < array[index].order);
+        }
+    }
+}
+
+GTEST_TEST(sort, stable_sort_non_bitwise_type)
+{
+    hud_test::non_bitwise_type array[200];
+    i32 ids[200];
+    hud_test::fill_pseudo_random(ids, 1000u);
+    for (usize index = 0; index < 200; index++) {
+        array[index] = hud_test::non_bitwise_type(ids[index]);
+    }
+    const auto less = [](const hud_test::non_bitwise_type &a, const hud_test::non_bitwise_type &b) { return a.id() < b.id(); };
+    hud::stable_sort(array, array + 200, less);
+    hud_assert_true(hud_test::is_sorted(array, array + 200, less));
+}
+
+GTEST_TEST(sort, partial_sort)
+{
+    i32 array[500];
+    i32 sorted[500];
+    hud_test::fill_pseudo_random(array, 1000u);
+    hud_test::fill_pseudo_random(sorted, 1000u);
+    hud::sort(sorted, sorted + 500);
+
+    hud::partial_sort(hud::slice<i32>(array, 500), 50u);
+    for (usize index = 0; index < 50; index++) {
+        hud_assert_eq(array[index], sorted[index]);
+    }
+}
+
+GTEST_TEST(sort, nth_element)
+{
+    i32 sorted[500];
+    hud_test::fill_pseudo_random(sorted, 100u);
+    hud::sort(sorted, sorted + 500);
+
+    for (usize nth : {0u, 1u, 250u, 498u, 499u}) {
+        i32 array[500];
+        hud_test::fill_pseudo_random(array, 100u);
+        hud::nth_element(hud::slice<i32>(array, 500), nth);
+        hud_assert_eq(array[nth], sorted[nth]);
+        for (usize index = 0; index < nth; index++) {
+            hud_assert_true(array[index] <= array[nth]);
+        }
+        for (usize index = nth; index < 500; index++) {
+            hud_assert_true(array[index] >= array[nth]);
+        }
+    }
+}
+
+GTEST_TEST(sort, radix_sort_integral)
+{
+    hud_test::for_each_type<i8, i16, i32, i64, u8, u16, u32, u64>()([]<typename type_t>() {
+        type_t array[1000];
+        hud_test::fill_pseudo_random(array, 0xFFFFFFFFu);
+        hud::radix_sort(array, array + 1000);
+        hud_assert_true(hud_test::is_sorted(array, array + 1000));
+    });
+
+    // Negative values are ordered before positive values
+    i32 array[20] = {5, -3, 9, -1000, 0, 19, -18, 17, 2, 4, -6, 8, 7, 11, -10, 13, 12, 15, 14, 16};
+    hud::radix_sort(hud::slice<i32>(array, 20));
+    hud_assert_eq(array[0], -1000);
+    hud_assert_eq(array[19], 19);
+    hud_assert_true(hud_test::is_sorted(array, array + 20));
+}
+
+GTEST_TEST(sort, can_be_used_in_constant_evaluated_expression)
+{
+    constexpr auto test = []() {
+        i32 array[40];
+        hud_test::fill_pseudo_random(array, 100u);
+        hud::sort(array, array + 40);
+        const bool sorted = hud_test::is_sorted(array, array + 40);
+        hud_test::fill_pseudo_random(array, 100u);
+        hud::stable_sort(array, array + 40);
+        return sorted && hud_test::is_sorted(array, array + 40);
+    };
+    constexpr bool result = test();
+    hud_assert_true(result);
+}
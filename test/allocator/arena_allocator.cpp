@@ -0,0 +1,152 @@
+#include <core/allocators/arena_allocator.h>
+#include <core/containers/vector.h>
+#include <core/containers/hashmap.h>
+
+GTEST_TEST(arena_allocator, allocate_zero_do_not_allocate)
+{
+    hud::arena arena;
+    hud::arena_allocator allocator(arena);
+    const auto buffer = allocator.template allocate<u32>(0);
+    hud_assert_eq(buffer.data(), nullptr);
+    hud_assert_eq(buffer.count(), 0u);
+    hud_assert_eq(arena.heap_byte_count(), 0u);
+}
+
+GTEST_TEST(arena_allocator, allocate_aligned_memory_in_chunks)
+{
+    hud::arena arena(256u);
+    hud::arena_allocator allocator(arena);
+    hud_test::for_each_type<i8, i16, i32, i64, u8, u16, u32, u64, f32, f64, uptr, iptr, usize, isize>()([&allocator]<typename type_t>() {
+        for (u32 count = 1; count < 64; count++) {
+            auto buffer = allocator.template allocate<type_t>(count);
+            hud_assert_ne(buffer.data(), nullptr);
+            hud_assert_eq(buffer.count(), count);
+            hud_assert_true(hud::memory::is_pointer_aligned(buffer.data(), alignof(type_t)));
+
+            for (usize index = 0; index < buffer.count(); index++) {
+                buffer[index] = static_cast<type_t>(index);
+            }
+            for (usize index = 0; index < buffer.count(); index++) {
+                hud_assert_eq(buffer[index], static_cast<type_t>(index));
+            }
+            // Free does nothing
+            allocator.free(buffer);
+        } });
+    hud_assert_ne(arena.heap_byte_count(), 0u);
+}
+
+GTEST_TEST(arena_allocator, allocate_bigger_than_chunk_size)
+{
+    hud::arena arena(64u);
+    hud::arena_allocator allocator(arena);
+    auto buffer = allocator.template allocate<u64>(1024u);
+    hud_assert_ne(buffer.data(), nullptr);
+    hud_assert_eq(buffer.count(), 1024u);
+    hud_assert_true(arena.heap_byte_count() >= 1024u * sizeof(u64));
+    buffer[1023] = 1023u;
+    hud_assert_eq(buffer[1023], 1023u);
+}
+
+GTEST_TEST(arena_allocator, use_initial_buffer_before_heap)
+{
+    alignas(16) u8 stack_buffer[256];
+    hud::arena arena(hud::slice<u8>(stack_buffer, 256u));
+    hud::arena_allocator allocator(arena);
+
+    auto buffer = allocator.template allocate<u32>(32u);
+    hud_assert_true(reinterpret_cast<u8 *>(buffer.data()) >= stack_buffer);
+    hud_assert_true(reinterpret_cast<u8 *>(buffer.data_end()) <= stack_buffer + 256u);
+    hud_assert_eq(arena.heap_byte_count(), 0u);
+
+    // The stack buffer is full, next allocation goes to the heap
+    auto heap_buffer = allocator.template allocate<u32>(64u);
+    hud_assert_true(reinterpret_cast<u8 *>(heap_buffer.data()) < stack_buffer || reinterpret_cast<u8 *>(heap_buffer.data()) >= stack_buffer + 256u);
+    hud_assert_ne(arena.heap_byte_count(), 0u);
+
+    // Reset goes back to the stack buffer
+    arena.reset();
+    auto buffer_after_reset = allocator.template allocate<u32>(32u);
+    hud_assert_eq(buffer_after_reset.data(), buffer.data());
+}
+
+GTEST_TEST(arena_allocator, reset_reuse_chunks)
+{
+    hud::arena arena(1024u);
+    hud::arena_allocator allocator(arena);
+    for (u32 index = 0; index < 16; index++) {
+        [[maybe_unused]] auto buffer = allocator.template allocate<u64>(100u);
+    }
+    const usize heap_byte_count = arena.heap_byte_count();
+    hud_assert_ne(heap_byte_count, 0u);
+
+    arena.reset();
+    for (u32 index = 0; index < 16; index++) {
+        [[maybe_unused]] auto buffer = allocator.template allocate<u64>(100u);
+    }
+    // No new chunk is allocated
+    hud_assert_eq(arena.heap_byte_count(), heap_byte_count);
+}
+
+GTEST_TEST(arena_allocator, reallocate_last_allocation_in_place)
+{
+    hud::arena arena(4096u);
+    hud::arena_allocator allocator(arena);
+    auto buffer = allocator.template allocate<u32>(4u);
+    buffer[3] = 3u;
+    u32 *data = buffer.data();
+    auto grown = allocator.template reallocate<u32>(buffer, 8u);
+    hud_assert_eq(grown.data(), data);
+    hud_assert_eq(grown.count(), 8u);
+    hud_assert_eq(grown[3], 3u);
+
+    // Not the last allocation, the content is copied
+    [[maybe_unused]] auto other = allocator.template allocate<u32>(4u);
+    auto moved = allocator.template reallocate<u32>(grown, 16u);
+    hud_assert_ne(moved.data(), data);
+    hud_assert_eq(moved.count(), 16u);
+    hud_assert_eq(moved[3], 3u);
+}
+
+GTEST_TEST(arena_allocator, vector_allocate_in_arena)
+{
+    hud::arena arena;
+    hud::vector<i32, hud::arena_allocator> vector {hud::arena_allocator(arena)};
+    for (i32 index = 0; index < 1000; index++) {
+        vector.add(index);
+    }
+    hud_assert_eq(vector.count(), 1000u);
+    hud_assert_eq(vector.allocator().arena(), &arena);
+    for (i32 index = 0; index < 1000; index++) {
+        hud_assert_eq(vector[index], index);
+    }
+}
+
+GTEST_TEST(arena_allocator, hashmap_allocate_in_arena)
+{
+    hud::arena arena;
+    hud::hashmap<i32, i64, hud::hash_64<i32>, hud::equal<i32>, hud::arena_allocator> map {hud::arena_allocator(arena)};
+    for (i32 index = 0; index < 1000; index++) {
+        map.add(index, index * 2);
+    }
+    hud_assert_eq(map.count(), 1000u);
+    hud_assert_eq(map.allocator().arena(), &arena);
+    for (i32 index = 0; index < 1000; index++) {
+        const auto it = map.find(index);
+        hud_assert_ne(it, map.end());
+        hud_assert_eq(it->value(), index * 2);
+    }
+    hud_assert_ne(arena.heap_byte_count(), 0u);
+}
+
+GTEST_TEST(arena_allocator, can_be_used_in_constant_evaluated_expression)
+{
+    constexpr auto test = []() {
+        hud::vector<i32, hud::arena_allocator> vector;
+        for (i32 index = 0; index < 10; index++) {
+            vector.add(index);
+        }
+        return vector[9];
+    };
+    constexpr i32 result = test();
+    hud_assert_eq(result, 9);
+}
@@ -0,0 +1,203 @@
+#include <core/allocators/pool_allocator.h>
+#include <core/containers/vector.h>
+#include <core/containers/hashmap.h>
+#include <core/containers/unique_pointer.h>
+#if !defined(HD_TARGET_WASM_FAMILY)
+    #include <thread>
+#endif
+
+GTEST_TEST(pool_allocator, block_size_is_a_power_of_two_size_class)
+{
+    hud_assert_eq(hud::pool::block_size(1u, 1u), 8u);
+    hud_assert_eq(hud::pool::block_size(8u, 8u), 8u);
+    hud_assert_eq(hud::pool::block_size(9u, 1u), 16u);
+    hud_assert_eq(hud::pool::block_size(4u, 16u), 16u);
+    hud_assert_eq(hud::pool::block_size(100u, 4u), 128u);
+    hud_assert_eq(hud::pool::block_size(1024u, 8u), 1024u);
+    // Not served by the pool
+    hud_assert_eq(hud::pool::block_size(1025u, 8u), 1025u);
+}
+
+GTEST_TEST(pool_allocator, allocate_zero_do_not_allocate)
+{
+    hud::pool pool;
+    hud::pool_allocator allocator(pool);
+    const auto buffer = allocator.template allocate<u32>(0);
+    hud_assert_eq(buffer.data(), nullptr);
+    hud_assert_eq(buffer.count(), 0u);
+    hud_assert_eq(pool.slab_count(), 0u);
+}
+
+GTEST_TEST(pool_allocator, allocate_aligned_memory)
+{
+    hud::pool pool;
+    hud::pool_allocator allocator(pool);
+    hud_test::for_each_type<i8, i16, i32, i64, u8, u16, u32, u64, f32, f64, uptr, iptr, usize, isize>()([&allocator]<typename type_t>() {
+        for (u32 count = 1; count < 300; count++) {
+            auto buffer = allocator.template allocate<type_t>(count);
+            hud_assert_ne(buffer.data(), nullptr);
+            hud_assert_eq(buffer.count(), count);
+            hud_assert_true(hud::memory::is_pointer_aligned(buffer.data(), alignof(type_t)));
+
+            for (usize index = 0; index < buffer.count(); index++) {
+                buffer[index] = static_cast<type_t>(index);
+            }
+            for (usize index = 0; index < buffer.count(); index++) {
+                hud_assert_eq(buffer[index], static_cast<type_t>(index));
+            }
+            allocator.free(buffer);
+        } });
+}
+
+GTEST_TEST(pool_allocator, free_block_is_reused_by_same_size_class)
+{
+    hud::pool pool;
+    hud::pool_allocator allocator(pool);
+    auto first = allocator.template allocate<u64>(2u);
+    auto second = allocator.template allocate<u64>(2u);
+    hud_assert_ne(first.data(), second.data());
+    hud_assert_eq(pool.slab_count(), 1u);
+
+    u64 *first_pointer = first.data();
+    allocator.free(first);
+    // Same size class, the block is reused
+    auto third = allocator.template allocate<u32>(3u);
+    hud_assert_eq(reinterpret_cast<void *>(third.data()), reinterpret_cast<void *>(first_pointer));
+
+    // Other size class use another slab
+    auto fourth = allocator.template allocate<u64>(64u);
+    hud_assert_eq(pool.slab_count(), 2u);
+
+    allocator.free(second);
+    allocator.free(third);
+    allocator.free(fourth);
+}
+
+GTEST_TEST(pool_allocator, churn_do_not_allocate_new_slab)
+{
+    hud::pool pool;
+    hud::pool_allocator allocator(pool);
+    for (u32 index = 0; index < 10000; index++) {
+        auto buffer = allocator.template allocate<u64>(4u);
+        buffer[0] = index;
+        allocator.free(buffer);
+    }
+    hud_assert_eq(pool.slab_count(), 1u);
+}
+
+GTEST_TEST(pool_allocator, big_or_over_aligned_allocations_use_the_heap)
+{
+    hud::pool pool;
+    hud::pool_allocator allocator(pool);
+    auto big = allocator.template allocate<u8>(hud::pool::MAX_BLOCK_SIZE + 1u);
+    hud_assert_ne(big.data(), nullptr);
+    hud_assert_eq(pool.slab_count(), 0u);
+    allocator.free(big);
+
+    struct alignas(64) over_aligned
+    {
+        u8 value;
+    };
+
+    auto aligned = allocator.template allocate<over_aligned>(1u);
+    hud_assert_ne(aligned.data(), nullptr);
+    hud_assert_true(hud::memory::is_pointer_aligned(aligned.data(), 64u));
+    hud_assert_eq(pool.slab_count(), 0u);
+    allocator.free(aligned);
+}
+
+GTEST_TEST(pool_allocator, default_allocator_use_the_pool_of_the_calling_thread)
+{
+    hud::pool_allocator allocator;
+    hud_assert_eq(allocator.pool(), &hud::pool::this_thread());
+    hud_assert_eq(allocator, hud::pool_allocator(hud::pool::this_thread()));
+
+    hud::pool other_pool;
+    hud_assert_ne(allocator, hud::pool_allocator(other_pool));
+}
+
+GTEST_TEST(pool_allocator, vector_allocate_in_pool)
+{
+    hud::pool pool;
+    hud::vector<i32, hud::pool_allocator> vector {hud::pool_allocator(pool)};
+    for (i32 index = 0; index < 200; index++) {
+        vector.add(index);
+    }
+    hud_assert_eq(vector.count(), 200u);
+    hud_assert_eq(vector.allocator().pool(), &pool);
+    for (i32 index = 0; index < 200; index++) {
+        hud_assert_eq(vector[index], index);
+    }
+    hud_assert_ne(pool.slab_count(), 0u);
+}
+
+GTEST_TEST(pool_allocator, hashmap_allocate_in_pool)
+{
+    hud::pool pool;
+    hud::hashmap<i32, i64, hud::hash_64<i32>, hud::equal<i32>, hud::pool_allocator> map {hud::pool_allocator(pool)};
+    for (i32 index = 0; index < 1000; index++) {
+        map.add(index, index * 2);
+    }
+    hud_assert_eq(map.count(), 1000u);
+    hud_assert_eq(map.allocator().pool(), &pool);
+    for (i32 index = 0; index < 1000; index++) {
+        const auto it = map.find(index);
+        hud_assert_ne(it, map.end());
+        hud_assert_eq(it->value(), index * 2);
+    }
+}
+
+#if !defined(HD_TARGET_WASM_FAMILY)
+GTEST_TEST(pool_allocator, blocks_freed_by_other_thread_are_reused_by_owner)
+{
+    // Fill a slab with blocks of 16 bytes, the first block is used by the slab header
+    constexpr usize COUNT = hud::pool::SLAB_SIZE / 16u - 1u;
+    hud::pool pool;
+    void *blocks[COUNT];
+    for (usize index = 0; index < COUNT; index++) {
+        blocks[index] = pool.allocate(16u, 8u);
+        hud_assert_ne(blocks[index], nullptr);
+    }
+    hud_assert_eq(pool.slab_count(), 1u);
+
+    std::thread thread([&pool, &blocks]() {
+        for (void *block : blocks) {
+            pool.free(block, 16u, 8u);
+        }
+    });
+    thread.join();
+
+    // The owner takes the blocks freed by the other thread instead of allocating a new slab
+    for (usize index = 0; index < COUNT; index++) {
+        blocks[index] = pool.allocate(16u, 8u);
+        hud_assert_ne(blocks[index], nullptr);
+    }
+    hud_assert_eq(pool.slab_count(), 1u);
+    void *extra = pool.allocate(16u, 8u);
+    hud_assert_eq(pool.slab_count(), 2u);
+
+    pool.free(extra, 16u, 8u);
+    for (void *block : blocks) {
+        pool.free(block, 16u, 8u);
+    }
+}
+
+GTEST_TEST(pool_allocator, pool_of_a_thread_outlives_the_thread)
+{
+    i32 dtor_count = 0;
+    hud::unique_pointer<hud_test::non_bitwise_type, hud::pool_deleter<hud_test::non_bitwise_type>> ptr;
+    hud::pool *thread_pool = nullptr;
+    std::thread thread([&ptr, &dtor_count, &thread_pool]() {
+        ptr = hud::make_unique<hud_test::non_bitwise_type>(hud::pool_allocator(), 123, &dtor_count);
+        thread_pool = &hud::pool::this_thread();
+    });
+    thread.join();
+
+    // The thread has exited, its pool is destroyed when the last block is freed
+    hud_assert_eq(ptr.deleter().allocator().pool(), thread_pool);
+    hud_assert_ne(thread_pool, &hud::pool::this_thread());
+    hud_assert_eq(ptr->id(), 123);
+    ptr.reset();
+    hud_assert_eq(dtor_count, 1);
+}
+#endif
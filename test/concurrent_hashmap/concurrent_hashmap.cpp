@@ -0,0 +1,184 @@
+#include <core/containers/concurrent_hashmap.h>
+#if !defined(HD_TARGET_WASM_FAMILY)
+    #include <thread>
+    #include <vector>
+#endif
+
+GTEST_TEST(concurrent_hashmap, find_in_empty_map)
+{
+    hud::concurrent_hashmap<usize, usize> map;
+    hud_assert_false(map.find(1).has_value());
+    hud_assert_false(map.contains(1));
+    hud_assert_eq(map.count(), 0u);
+}
+
+GTEST_TEST(concurrent_hashmap, add_find_remove)
+{
+    hud::concurrent_hashmap<usize, usize> map;
+    for (usize index = 0; index < 1000; index++)
+    {
+        hud_assert_true(map.add(index, index * 2));
+    }
+    hud_assert_eq(map.count(), 1000u);
+
+    // Adding an existing key does not change the value
+    hud_assert_false(map.add(usize {10}, usize {0}));
+    hud_assert_eq(map.find(10).value(), 20u);
+
+    for (usize index = 0; index < 2000; index++)
+    {
+        const hud::optional<usize> value = map.find(index);
+        hud_assert_eq(value.has_value(), index < 1000);
+        hud_assert_eq(map.contains(index), index < 1000);
+        if (value.has_value())
+        {
+            hud_assert_eq(value.value(), index * 2);
+        }
+    }
+
+    for (usize index = 0; index < 1000; index += 2)
+    {
+        hud_assert_true(map.remove(index));
+        hud_assert_false(map.remove(index));
+    }
+    hud_assert_eq(map.count(), 500u);
+    for (usize index = 0; index < 1000; index++)
+    {
+        hud_assert_eq(map.contains(index), index % 2 == 1);
+    }
+
+    map.clear();
+    hud_assert_eq(map.count(), 0u);
+}
+
+GTEST_TEST(concurrent_hashmap, update_or_add)
+{
+    hud::concurrent_hashmap<i32, u32> map;
+    hud_assert_true(map.update_or_add(1, [](u32 &value) { value += 5; }));
+    hud_assert_false(map.update_or_add(1, [](u32 &value) { value += 5; }));
+    hud_assert_true(map.update_or_add(2, [](u32 &value) { value = 42; }));
+    hud_assert_eq(map.find(1).value(), 10u);
+    hud_assert_eq(map.find(2).value(), 42u);
+    hud_assert_eq(map.count(), 2u);
+}
+
+GTEST_TEST(concurrent_hashmap, for_each_visit_all_shards)
+{
+    hud::concurrent_hashmap<usize, usize, hud::hash_64<usize>, hud::equal<usize>, hud::heap_allocator, 8> map;
+    map.reserve(256);
+    usize expected_sum = 0;
+    for (usize index = 0; index < 256; index++)
+    {
+        map.add(index, index);
+        expected_sum += index;
+    }
+
+    usize visited_count = 0;
+    usize sum = 0;
+    map.for_each([&](const usize &key, const usize &value) {
+        visited_count++;
+        sum += key + value;
+    });
+    hud_assert_eq(visited_count, 256u);
+    hud_assert_eq(sum, expected_sum * 2);
+
+    // Each key is visited in the shard it belongs to
+    bool is_in_right_shard = true;
+    visited_count = 0;
+    for (usize shard_index = 0; shard_index < map.SHARD_COUNT; shard_index++)
+    {
+        map.for_each_in_shard(shard_index, [&](const usize &key, const usize &) {
+            visited_count++;
+            is_in_right_shard &= map.shard_index_of(key) == shard_index;
+        });
+    }
+    hud_assert_eq(visited_count, 256u);
+    hud_assert_true(is_in_right_shard);
+}
+
+GTEST_TEST(concurrent_hashmap, sequential_integer_keys_spread_over_all_shards)
+{
+    // hud::hash_64 is the identity for integers, the shard index must not come from the raw high bits
+    constexpr usize COUNT = 100000;
+    hud::concurrent_hashmap<i32, u64> map;
+    for (i32 key = 0; key < static_cast<i32>(COUNT); key++)
+    {
+        map.add(key, static_cast<u64>(key));
+    }
+
+    usize min_shard_count = COUNT;
+    usize max_shard_count = 0;
+    for (usize shard_index = 0; shard_index < map.SHARD_COUNT; shard_index++)
+    {
+        usize shard_count = 0;
+        map.for_each_in_shard(shard_index, [&](const i32 &, const u64 &) {
+            shard_count++;
+        });
+        min_shard_count = hud::math::min(min_shard_count, shard_count);
+        max_shard_count = hud::math::max(max_shard_count, shard_count);
+    }
+    const usize expected_shard_count = COUNT / map.SHARD_COUNT;
+    hud_assert_ge(min_shard_count, expected_shard_count / 2);
+    hud_assert_true(max_shard_count <= expected_shard_count * 2);
+}
+
+GTEST_TEST(concurrent_hashmap, single_shard)
+{
+    hud::concurrent_hashmap<usize, usize, hud::hash_64<usize>, hud::equal<usize>, hud::heap_allocator, 1> map;
+    for (usize index = 0; index < 100; index++)
+    {
+        map.add(index, index);
+    }
+    hud_assert_eq(map.count(), 100u);
+    hud_assert_eq(map.shard_index_of(usize {42}), 0u);
+    hud_assert_eq(map.find(42).value(), 42u);
+}
+
+#if !defined(HD_TARGET_WASM_FAMILY)
+GTEST_TEST(concurrent_hashmap, concurrent_add_remove_update)
+{
+    constexpr usize THREAD_COUNT = 4;
+    constexpr usize KEY_PER_THREAD = 5000;
+    constexpr usize SHARED_KEY_COUNT = 16;
+    hud::concurrent_hashmap<usize, usize> map;
+    hud::concurrent_hashmap<usize, usize> counters;
+
+    std::vector<std::thread> threads;
+    for (usize thread_index = 0; thread_index < THREAD_COUNT; thread_index++)
+    {
+        threads.emplace_back([&, thread_index]() {
+            const usize first_key = thread_index * KEY_PER_THREAD;
+            for (usize key = first_key; key < first_key + KEY_PER_THREAD; key++)
+            {
+                map.add(key, key);
+                // Every thread increments the same counters
+                counters.update_or_add(key % SHARED_KEY_COUNT, [](usize &value) { value++; });
+            }
+            // Remove odd keys added by this thread while other threads read and write
+            for (usize key = first_key + 1; key < first_key + KEY_PER_THREAD; key += 2)
+            {
+                map.remove(key);
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    hud_assert_eq(map.count(), THREAD_COUNT * KEY_PER_THREAD / 2);
+    bool is_map_ok = true;
+    for (usize key = 0; key < THREAD_COUNT * KEY_PER_THREAD; key++)
+    {
+        const hud::optional<usize> value = map.find(key);
+        is_map_ok &= value.has_value() == (key % 2 == 0);
+        is_map_ok &= !value.has_value() || value.value() == key;
+    }
+    hud_assert_true(is_map_ok);
+
+    usize total = 0;
+    counters.for_each([&total](const usize &, const usize &value) { total += value; });
+    hud_assert_eq(counters.count(), SHARED_KEY_COUNT);
+    hud_assert_eq(total, THREAD_COUNT * KEY_PER_THREAD);
+}
+#endif
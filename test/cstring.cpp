@@ -1125,4 +1125,180 @@ GTEST_TEST(cstring, format)
     character_count = hud::cstring::format(wide_buffer, 256, wide_fmt, L"World", L"Hammer");
     hud_assert_true(hud::cstring::equals(wide_buffer, L"Hello World! Hammer time"));
     hud_assert_true(character_count == 24);
-}
\ No newline at end of file
+}
+GTEST_TEST(cstring, is_ascii_long_string)
+{
+    // Non ascii character at every position of strings longer than a SIMD block and at every alignment
+    const auto test = []<typename char_t>(char_t non_ascii) {
+        char_t buffer[96];
+        for (usize offset = 0; offset < 16; offset++) {
+            for (usize length = 0; length < 64; length++) {
+                char_t *text = buffer + offset;
+                for (usize index = 0; index < length; index++) {
+                    text[index] = static_cast<char_t>('a' + index % 26);
+                }
+                text[length] = char_t {0};
+                // Non ascii after the null-terminator character is ignored
+                text[length + 1] = non_ascii;
+                if (!hud::cstring::is_ascii(text) || !hud::cstring::is_ascii_safe(text, length + 2)) {
+                    return false;
+                }
+                for (usize position = 0; position < length; position++) {
+                    const char_t previous = text[position];
+                    text[position] = non_ascii;
+                    if (hud::cstring::is_ascii(text) || hud::cstring::is_ascii_safe(text, length) != false) {
+                        return false;
+                    }
+                    // Only the first position characters are tested
+                    if (!hud::cstring::is_ascii_safe(text, position)) {
+                        return false;
+                    }
+                    text[position] = previous;
+                }
+            }
+        }
+        return true;
+    };
+    hud_assert_true(test(static_cast<char8>(0x80)));
+    hud_assert_true(test(static_cast<wchar>(0xE9)));
+    hud_assert_true(test(static_cast<char16>(0x100)));
+    hud_assert_true(test(static_cast<char32>(0x10000)));
+}
+
+GTEST_TEST(cstring, is_ascii_reads_only_the_string)
+{
+    // Strings are allocated with their exact size, reading after the null-terminator character is reported by the address sanitizer
+    const auto test = []<typename char_t>(char_t non_ascii) {
+        for (usize length = 0; length < 64; length++) {
+            char_t *text = hud::memory::allocate_array<char_t>(length + 1);
+            for (usize index = 0; index < length; index++) {
+                text[index] = static_cast<char_t>('a' + index % 26);
+            }
+            text[length] = char_t {0};
+            bool is_ok = hud::cstring::is_ascii(text);
+            if (length > 0) {
+                text[length - 1] = non_ascii;
+                is_ok &= !hud::cstring::is_ascii(text);
+            }
+            hud::memory::free_array(text, length + 1);
+            if (!is_ok) {
+                return false;
+            }
+        }
+        return true;
+    };
+    hud_assert_true(test(static_cast<char8>(0x80)));
+    hud_assert_true(test(static_cast<wchar>(0xE9)));
+    hud_assert_true(test(static_cast<char16>(0x100)));
+    hud_assert_true(test(static_cast<char32>(0x10000)));
+}
+
+GTEST_TEST(cstring, ascii_change_case_long_string)
+{
+    // Strings longer than a SIMD block, characters around letter ranges are not converted
+    const auto test = []<typename char_t>() {
+        char_t text[80];
+        char_t expected_upper[80];
+        char_t expected_lower[80];
+        for (usize index = 0; index < 79; index++) {
+            const usize kind = index % 4;
+            text[index] = static_cast<char_t>(kind == 0 ? 'a' + index % 26 : kind == 1 ? 'A' + index % 26 : kind == 2 ? '0' + index % 10 : "@[`{"[(index / 4) % 4]);
+            expected_upper[index] = static_cast<char_t>(kind == 0 ? 'A' + index % 26 : text[index]);
+            expected_lower[index] = static_cast<char_t>(kind == 1 ? 'a' + index % 26 : text[index]);
+        }
+        text[79] = expected_upper[79] = expected_lower[79] = char_t {0};
+
+        char_t upper[80];
+        hud::memory::copy_memory(upper, text);
+        hud::cstring::ascii_to_uppercase(upper);
+        char_t lower[80];
+        hud::memory::copy_memory(lower, text);
+        hud::cstring::ascii_to_lowercase(lower);
+        if (hud::memory::compare_memory(upper, expected_upper) != 0 || hud::memory::compare_memory(lower, expected_lower) != 0) {
+            return false;
+        }
+
+        // Partial conversion stop after count characters
+        hud::memory::copy_memory(upper, text);
+        hud::cstring::ascii_to_uppercase_partial(upper, 37);
+        hud::memory::copy_memory(lower, text);
+        if (!hud::cstring::ascii_to_lowercase_partial_safe(lower, 79, 37)) {
+            return false;
+        }
+        for (usize index = 0; index < 79; index++) {
+            if (upper[index] != (index < 37 ? expected_upper[index] : text[index]) || lower[index] != (index < 37 ? expected_lower[index] : text[index])) {
+                return false;
+            }
+        }
+        return true;
+    };
+    hud_assert_true(test.template operator()<char8>());
+    hud_assert_true(test.template operator()<wchar>());
+}
+
+GTEST_TEST(cstring, find_string_with_length)
+{
+    // The string is not null-terminated
+    const char8 str[] = {'a', 'b', 'c', 'd', 'e', 'f', 'c', 'd'};
+    hud_assert_true(hud::cstring::find_string(str, 8, "cd", 2) == str + 2);
+    hud_assert_true(hud::cstring::find_string(str, 8, "fcd", 3) == str + 5);
+    hud_assert_true(hud::cstring::find_string(str, 8, "fe", 2) == nullptr);
+    hud_assert_true(hud::cstring::find_string(str, 8, "", 0) == str);
+    hud_assert_true(hud::cstring::find_string(str, 3, "cd", 2) == nullptr);
+    hud_assert_true(hud::cstring::find_string(hud::slice<const char8>(str, 8), hud::slice<const char8>("def", 3)) == str + 3);
+
+    // A mutable slice gives back a mutable pointer
+    char8 mutable_str[] = {'a', 'b', 'c', 'd', 'e', 'f', 'c', 'd'};
+    char8 *found = hud::cstring::find_string(hud::slice<char8>(mutable_str, 8), hud::slice<const char8>("fcd", 3));
+    hud_assert_true(found == mutable_str + 5);
+    hud_assert_true(hud::cstring::find_string(hud::slice<char8>(mutable_str, 8), hud::slice<const char8>("fe", 2)) == nullptr);
+    wchar mutable_wide_str[] = {L'a', L'b', L'c', L'd', L'e', L'f'};
+    wchar *wide_found = hud::cstring::find_string(hud::slice<wchar>(mutable_wide_str, 6), hud::slice<const wchar>(L"cd", 2));
+    hud_assert_true(wide_found == mutable_wide_str + 2);
+
+    const wchar wide_str[] = {L'a', L'b', L'c', L'd', L'e', L'f'};
+    hud_assert_true(hud::cstring::find_string(wide_str, 6, L"cd", 2) == wide_str + 2);
+    hud_assert_true(hud::cstring::find_string(wide_str, 6, L"fe", 2) == nullptr);
+
+    // Match at every position of a string longer than a SIMD block, including the last one
+    char8 long_str[100];
+    hud::memory::set_memory(long_str, 'a');
+    for (usize position = 0; position <= 97; position++) {
+        long_str[position] = 'x';
+        long_str[position + 1] = 'y';
+        long_str[position + 2] = 'z';
+        hud_assert_true(hud::cstring::find_string(long_str, 100, "xyz", 3) == long_str + position);
+        // First and last characters match but not the middle one
+        hud_assert_true(hud::cstring::find_string(long_str, 100, "xaz", 3) == nullptr);
+        long_str[position] = long_str[position + 1] = long_str[position + 2] = 'a';
+    }
+
+    // Constant
+    constexpr bool result = hud::cstring::find_string("abcdefcd", 8, "fcd", 3) != nullptr && hud::cstring::find_string("abcdefcd", 8, "fe", 2) == nullptr;
+    hud_assert_true(result);
+}
+
+GTEST_TEST(cstring, find_character_with_length)
+{
+    const char8 str[] = {'a', 'b', 'c', 'd', 'e', 'f', 'c', 'd'};
+    hud_assert_true(hud::cstring::find_character(str, 8, 'c') == str + 2);
+    hud_assert_true(hud::cstring::find_character(str, 2, 'c') == nullptr);
+    hud_assert_true(hud::cstring::find_character(hud::slice<const char8>(str, 8), 'f') == str + 5);
+
+    // A mutable slice gives back a mutable pointer
+    char8 mutable_str[] = {'a', 'b', 'c', 'd', 'e', 'f', 'c', 'd'};
+    char8 *found = hud::cstring::find_character(hud::slice<char8>(mutable_str, 8), 'f');
+    hud_assert_true(found == mutable_str + 5);
+    hud_assert_true(hud::cstring::find_character(hud::slice<char8>(mutable_str, 8), 'g') == nullptr);
+    wchar mutable_wide_str[] = {L'a', L'b', L'c', L'd', L'e', L'f'};
+    wchar *wide_found = hud::cstring::find_character(hud::slice<wchar>(mutable_wide_str, 6), L'c');
+    hud_assert_true(wide_found == mutable_wide_str + 2);
+
+    const wchar wide_str[] = {L'a', L'b', L'c', L'd', L'e', L'f'};
+    hud_assert_true(hud::cstring::find_character(wide_str, 6, L'c') == wide_str + 2);
+    hud_assert_true(hud::cstring::find_character(wide_str, 6, L'g') == nullptr);
+
+    // Constant
+    constexpr bool result = hud::cstring::find_character("abcdef", 6, 'e') != nullptr && hud::cstring::find_character("abcdef", 6, 'g') == nullptr;
+    hud_assert_true(result);
+}
@@ -145,3 +145,113 @@ GTEST_TEST(cityhash, combine_64)
     hud_assert_eq(hud::hash_algorithm::city_hash::combine_64(combined, hash_2), 0x746D68F6EB969EB7u);
 #endif
 }
+
+GTEST_TEST(cityhash, hash64_stream)
+{
+    char8 key[300];
+    for (usize i = 0; i < 300; i++) {
+        key[i] = static_cast<char8>(i * 7 + 3);
+    }
+
+    // Empty stream
+    hud_assert_eq(hud::hash_algorithm::city_hash_64_stream<> {}.finalize(), hud::hash_algorithm::city_hash::hash_64(nullptr, 0));
+
+    for (usize length = 0; length < 300; length++) {
+        const u64 expected = hud::hash_algorithm::city_hash::hash_64(key, length);
+
+        // One fragment
+        hud::hash_algorithm::city_hash_64_stream<> one_fragment;
+        one_fragment.update(key, length);
+        hud_assert_eq(one_fragment.length(), length);
+        hud_assert_eq(one_fragment.finalize(), expected);
+
+        // Fragments of same size, blocks of 64 bytes overlap fragments
+        for (usize fragment_length : {1u, 7u, 31u, 64u, 100u}) {
+            hud::hash_algorithm::city_hash_64_stream<300> stream;
+            for (usize offset = 0; offset < length; offset += fragment_length) {
+                stream.update(hud::slice<const char8>(key + offset, hud::math::min(fragment_length, length - offset)));
+            }
+            hud_assert_eq(stream.length(), length);
+            hud_assert_eq(stream.finalize(), expected);
+        }
+
+        // Fragments of different sizes with empty fragments
+        hud::hash_algorithm::city_hash_64_stream<> stream;
+        usize offset = 0;
+        for (usize fragment_length : {3u, 0u, 61u, 130u, 0u, 2u}) {
+            const usize count = hud::math::min(fragment_length, length - offset);
+            stream.update(key + offset, count);
+            offset += count;
+        }
+        stream.update(key + offset, length - offset);
+        hud_assert_eq(stream.finalize(), expected);
+    }
+
+    // Reset remove all fragments
+    hud::hash_algorithm::city_hash_64_stream<> stream;
+    stream.update(key, 10).update(key, 20);
+    hud_assert_eq(stream.fragment_count(), 2u);
+    stream.reset();
+    hud_assert_eq(stream.fragment_count(), 0u);
+    hud_assert_eq(stream.length(), 0u);
+    stream.update(lipsum, 100).update(lipsum + 100, hud::cstring::length(lipsum) - 100);
+    hud_assert_eq(stream.finalize(), CityHash64(lipsum, hud::cstring::length(lipsum)));
+}
+
+GTEST_TEST(cityhash, hash64_stream_is_usable_in_constexpr)
+{
+    constexpr u64 hash_lipsum = []() {
+        hud::hash_algorithm::city_hash_64_stream<> stream;
+        const usize length = hud::cstring::length(lipsum);
+        stream.update(lipsum, 1).update(lipsum + 1, 200).update(lipsum + 201, length - 201);
+        return stream.finalize();
+    }();
+    hud_assert_eq(hash_lipsum, CityHash64(lipsum, hud::cstring::length(lipsum)));
+
+    constexpr u64 hash_short = []() {
+        hud::hash_algorithm::city_hash_64_stream<> stream;
+        stream.update(lipsum, 20).update(lipsum + 20, 30);
+        return stream.finalize();
+    }();
+    hud_assert_eq(hash_short, CityHash64(lipsum, 50));
+}
+
+GTEST_TEST(cityhash, hash64_stream_over_fragment_capacity)
+{
+    char8 key[300];
+    for (usize i = 0; i < 300; i++) {
+        key[i] = static_cast<char8>(i * 7 + 3);
+    }
+
+    for (usize length : {10u, 64u, 65u, 200u, 300u}) {
+        const u64 expected = hud::hash_algorithm::city_hash::hash_64(key, length);
+        // 4 fragments are hashed in place, the following ones are copied
+        for (usize fragment_length : {1u, 3u, 17u, 64u}) {
+            hud::hash_algorithm::city_hash_64_stream<4> stream;
+            for (usize offset = 0; offset < length; offset += fragment_length) {
+                stream.update(key + offset, hud::math::min(fragment_length, length - offset));
+            }
+            hud_assert_eq(stream.fragment_count(), hud::math::min<usize>(4u, (length + fragment_length - 1) / fragment_length));
+            hud_assert_eq(stream.length(), length);
+            hud_assert_eq(stream.finalize(), expected);
+        }
+    }
+
+    // Reset empties the overflow
+    hud::hash_algorithm::city_hash_64_stream<1> stream;
+    stream.update(key, 10).update(key + 10, 20).update(key + 30, 40);
+    hud_assert_eq(stream.fragment_count(), 1u);
+    hud_assert_eq(stream.finalize(), hud::hash_algorithm::city_hash::hash_64(key, 70));
+    stream.reset();
+    stream.update(lipsum, 100).update(lipsum + 100, hud::cstring::length(lipsum) - 100);
+    hud_assert_eq(stream.finalize(), CityHash64(lipsum, hud::cstring::length(lipsum)));
+
+    // Constant
+    constexpr u64 hash_lipsum = []() {
+        hud::hash_algorithm::city_hash_64_stream<2> stream;
+        const usize length = hud::cstring::length(lipsum);
+        stream.update(lipsum, 1).update(lipsum + 1, 200).update(lipsum + 201, 100).update(lipsum + 301, length - 301);
+        return stream.finalize();
+    }();
+    hud_assert_eq(hash_lipsum, CityHash64(lipsum, hud::cstring::length(lipsum)));
+}
@@ -1,6 +1,12 @@
 #include <core/hash/crc32.h>
 #include <slice_by_8/crc.h> // Intel Slice-by-8
 #include <core/cstring.h>
+#include <core/containers/vector.h>
+#include <core/atomics.h>
+#if !defined(HD_TARGET_WASM_FAMILY)
+    #include <thread>
+    #include <vector>
+#endif
 
 static constexpr const char8 *txt = "abcdefghijklmnopqrstuvwxyz";
 static constexpr const char8 *txt_unaligned = " abcdefghijklmnopqrstuvwxyz";
@@ -110,4 +116,134 @@ GTEST_TEST(hash, combine)
     const u32 result_2 = hud::hash_algorithm::crc32::hash((const u8 *)(txt_test), hud::cstring::length(txt_test), 0);
     const u32 result = hud::hash_algorithm::crc32::combine(result_1, result_2, hud::cstring::length(txt_test));
     hud_assert_eq(result, 0x5579202Fu);
-}
\ No newline at end of file
+}
+
+/** Fill a buffer with pseudo random bytes. */
+static void fill_pseudo_random(hud::vector<u8> &buffer, usize count)
+{
+    u32 state = 0x12345678;
+    buffer.reserve(count);
+    for (usize index = 0; index < count; index++) {
+        state = state * 1664525u + 1013904223u;
+        buffer.add(static_cast<u8>(state >> 24));
+    }
+}
+
+GTEST_TEST(hash, crc32_result_same_as_slice_by_8)
+{
+    // Covers buffers folded with PCLMULQDQ (64 bytes and more) with all remaining byte counts and alignments
+    hud::vector<u8> buffer;
+    fill_pseudo_random(buffer, 4096 + 16);
+    bool is_same = true;
+    for (usize count : {0, 1, 15, 16, 63, 64, 65, 79, 127, 128, 129, 1000, 4096}) {
+        for (usize offset = 0; offset < 16; offset++) {
+            const u32 seed = static_cast<u32>(count * 16 + offset);
+            is_same &= hud::hash_algorithm::crc32::hash(buffer.data() + offset, count, seed) == hud::hash_algorithm::crc32::hash_slice_by_8(buffer.data() + offset, count, seed);
+        }
+    }
+    hud_assert_true(is_same);
+}
+
+GTEST_TEST(hash, crc32c_lookup_table_is_correct)
+{
+    // Generate the Crc32c Lookup table with the correct polynomial
+    u32 generated_crc32c_lookup[8][256] = {};
+    for (unsigned int i = 0; i <= 0xFF; i++) {
+        u32 crc = i;
+        for (unsigned int j = 0; j < 8; j++) {
+            crc = (crc >> 1) ^ ((crc & 1) * hud::hash_algorithm::crc32c::REFLECTED_POLYNOMIAL);
+        }
+        generated_crc32c_lookup[0][i] = crc;
+    }
+    for (unsigned int table = 1; table < 8; table++) {
+        for (unsigned int i = 0; i <= 0xFF; i++) {
+            generated_crc32c_lookup[table][i] = (generated_crc32c_lookup[table - 1][i] >> 8) ^ generated_crc32c_lookup[0][generated_crc32c_lookup[table - 1][i] & 0xFF];
+        }
+    }
+    hud_assert_true(hud::memory::is_memory_compare_equal(hud::hash_algorithm::crc32c::CRC32C_LOOKUP, generated_crc32c_lookup));
+}
+
+GTEST_TEST(hash, crc32c_123456789)
+{
+    // From https://reveng.sourceforge.io/crc-catalogue/17plus.htm#crc.cat.crc-32c
+    hud_assert_eq(hud::hash_algorithm::crc32c::hash((const u8 *)(txt_test), hud::cstring::length(txt_test), 0), 0xE3069283u);
+    hud_assert_eq(hud::hash_algorithm::crc32c::hash_slice_by_8((const u8 *)(txt_test), hud::cstring::length(txt_test), 0), 0xE3069283u);
+    hud_assert_eq(hud::hash_algorithm::crc32c::hash((const u8 *)(txt_test), 0, 0), 0u);
+}
+
+GTEST_TEST(hash, crc32c_result_same_as_slice_by_8)
+{
+    // Covers the 3 streams used from STREAM_MIN_COUNT bytes with all remaining byte counts and alignments
+    constexpr usize stream_min_count = hud::hash_algorithm::crc32c::STREAM_MIN_COUNT;
+    hud::vector<u8> buffer;
+    fill_pseudo_random(buffer, stream_min_count * 2 + 32);
+    bool is_same = true;
+    for (usize count : {usize {0}, usize {1}, usize {7}, usize {8}, usize {9}, usize {100}, stream_min_count - 1, stream_min_count, stream_min_count + 1, stream_min_count + 23, stream_min_count * 2 + 16}) {
+        for (usize offset = 0; offset < 16; offset++) {
+            const u32 seed = static_cast<u32>(count * 16 + offset);
+            is_same &= hud::hash_algorithm::crc32c::hash(buffer.data() + offset, count, seed) == hud::hash_algorithm::crc32c::hash_slice_by_8(buffer.data() + offset, count, seed);
+        }
+    }
+    hud_assert_true(is_same);
+}
+
+GTEST_TEST(hash, crc32c_combine)
+{
+    const u32 result_1 = hud::hash_algorithm::crc32c::hash((const u8 *)(txt), hud::cstring::length(txt), 0);
+    const u32 result_2 = hud::hash_algorithm::crc32c::hash((const u8 *)(txt_test), hud::cstring::length(txt_test), 0);
+    const u32 result = hud::hash_algorithm::crc32c::combine(result_1, result_2, hud::cstring::length(txt_test));
+    // Same as the crc32c of the concatenation of both buffers
+    const u32 expected = hud::hash_algorithm::crc32c::hash((const u8 *)(txt_test), hud::cstring::length(txt_test), result_1);
+    hud_assert_eq(result, expected);
+}
+
+GTEST_TEST(hash, crc32_hash_parallel_same_as_hash)
+{
+    hud::vector<u8> buffer;
+    fill_pseudo_random(buffer, 100000);
+    // Run the tasks in reverse order on the calling thread
+    usize executor_call_count = 0;
+    auto reverse_executor = [&executor_call_count](usize task_count, auto &&task) {
+        executor_call_count++;
+        for (usize task_index = task_count; task_index > 0; task_index--) {
+            task(task_index - 1);
+        }
+    };
+    bool is_same = true;
+    for (usize count : {0, 1, 999, 1000, 1001, 4096, 100000}) {
+        for (usize chunk_size : {1, 64, 1000, 4096, 65536}) {
+            const u32 seed = static_cast<u32>(count + chunk_size);
+            is_same &= hud::hash_algorithm::crc32::hash_parallel(buffer.data(), count, chunk_size, reverse_executor, seed) == hud::hash_algorithm::crc32::hash(buffer.data(), count, seed);
+        }
+    }
+    hud_assert_true(is_same);
+    // The executor is not called when there is only one chunk
+    hud_assert_eq(executor_call_count, 15u);
+}
+
+#if !defined(HD_TARGET_WASM_FAMILY)
+GTEST_TEST(hash, crc32_hash_parallel_with_threads)
+{
+    constexpr usize THREAD_COUNT = 4;
+    hud::vector<u8> buffer;
+    fill_pseudo_random(buffer, 1000000);
+
+    // Each thread takes the next task until all tasks are done
+    auto thread_executor = [](usize task_count, auto &&task) {
+        hud::atomic<usize> next_task_index {0};
+        std::vector<std::thread> threads;
+        for (usize thread_index = 0; thread_index < THREAD_COUNT; thread_index++) {
+            threads.emplace_back([&]() {
+                for (usize task_index = next_task_index.fetch_add(1); task_index < task_count; task_index = next_task_index.fetch_add(1)) {
+                    task(task_index);
+                }
+            });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+    };
+    const u32 result = hud::hash_algorithm::crc32::hash_parallel(buffer.data(), buffer.count(), 4096, thread_executor, 0x12345678);
+    hud_assert_eq(result, hud::hash_algorithm::crc32::hash(buffer.data(), buffer.count(), 0x12345678));
+}
+#endif
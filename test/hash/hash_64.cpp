@@ -1,6 +1,8 @@
 
 #include <core/cstring.h>
 #include <core/hash.h>
+#include <core/containers/pair.h>
+#include <core/containers/tuple.h>
 
 namespace hud_test
 {
@@ -201,6 +203,120 @@ GTEST_TEST(hash_64, hasher64)
 #endif
 }
 
+GTEST_TEST(hash_64, hasher64_hash_fragmented_key)
+{
+    const char8 *key = "key split in fragments";
+    const usize len = hud::cstring::length(key);
+    hud::hash_algorithm::city_hash_64_stream<> stream;
+    stream.update(key, 4).update(key + 4, 6).update(key + 10, len - 10);
+
+    // Non constant
+    {
+        hud_assert_eq(hud::hash_64<hud::hash_algorithm::city_hash_64_stream<>> {}(stream), hud::hash_64<const char8 *> {}(key, len));
+        hud_assert_eq(hud::hasher_64 {}(stream).result(), hud::hasher_64 {}(key, len).result());
+    }
+
+    // Constant
+    {
+        constexpr u64 hash = []() {
+            hud::hash_algorithm::city_hash_64_stream<> stream;
+            stream.update("key split", 9).update(" in fragments", 13);
+            return hud::hasher_64 {}(stream).result();
+        }();
+        hud_assert_eq(hash, hud::hasher_64 {}("key split in fragments", len).result());
+    }
+}
+
+GTEST_TEST(hash_64, hasher64_with_seed)
+{
+    constexpr const usize len = hud::cstring::length("key");
+
+    // Non constant
+    {
+        hud_assert_eq(hud::hasher_64 {0}("key", len).result(), hud::hasher_64 {}("key", len).result());
+        hud_assert_eq(hud::hasher_64 {42}("key", len).result(), hud::combine_64(42, hud::hash_64<const char8 *> {}("key", len)));
+        hud_assert_ne(hud::hasher_64 {42}("key", len).result(), hud::hasher_64 {43}("key", len).result());
+        hud_assert_ne(hud::wyhasher_64 {42}("key", len).result(), hud::wyhasher_64 {43}("key", len).result());
+    }
+
+    // Constant
+    {
+        constexpr u64 hash = hud::hasher_64 {42}("key", len).result();
+        hud_assert_eq(hash, hud::combine_64(42, hud::hash_64<const char8 *> {}("key", len)));
+    }
+}
+
+GTEST_TEST(hash_64, process_hash_seed_is_the_same_for_the_process)
+{
+    const u64 seed = hud::process_hash_seed();
+    hud_assert_eq(hud::process_hash_seed(), seed);
+    hud_assert_eq(hud::keyed_hash_64<u64> {}.seed(), seed);
+    hud_assert_eq(hud::keyed_hash_64<const char8 *> {}.seed(), seed);
+}
+
+GTEST_TEST(hash_64, keyed_hash_64)
+{
+    // Non constant
+    {
+        const hud::keyed_hash_64<u64> hash_42 {42};
+        hud_assert_eq(hash_42(u64 {1}), hud::hash_algorithm::wyhash::hash_64(u64 {1}, 42));
+        hud_assert_ne(hash_42(u64 {1}), hud::keyed_hash_64<u64> {43}(u64 {1}));
+        hud_assert_eq(hud::keyed_hash_64<f64> {42}(1.0), hud::hash_algorithm::wyhash::hash_64(u64 {0x3FF0000000000000}, 42));
+        hud_assert_eq(hud::keyed_hash_64<const char8 *> {42}("key"), hud::hash_algorithm::wyhash::hash_64("key", 3, 42));
+        hud_assert_eq(hud::keyed_hash_64<char8 *> {42}("key", 3), hud::hash_algorithm::wyhash::hash_64("key", 3, 42));
+        hud_assert_eq(hud::keyed_hash_64<const wchar *> {42}(L"key"), hud::hash_algorithm::wyhash::hash_64(reinterpret_cast<const char8 *>(L"key"), 3 * sizeof(wchar), 42));
+        const u64 *pointer = nullptr;
+        hud_assert_eq(hud::keyed_hash_64<const u64 *> {42}(pointer), hud::hash_algorithm::wyhash::hash_64(u64 {0}, 42));
+        // Types not supported by wyhash are hashed with hud::hash_64 then combined with the seed
+        hud_assert_eq(hud::keyed_hash_64<hud_test::custom> {42}(hud_test::custom {}), hud::combine_64(42, hud::hash_64<hud_test::custom> {}(hud_test::custom {})));
+    }
+
+    // Constant
+    {
+        // The OS random generator is not available in constant evaluation, the default seed is 0
+        constexpr u64 seed = hud::keyed_hash_64<u64> {}.seed();
+        hud_assert_eq(seed, 0u);
+        constexpr u64 hash = hud::keyed_hash_64<u64> {42}(u64 {1});
+        hud_assert_eq(hash, hud::hash_algorithm::wyhash::hash_64(u64 {1}, 42));
+        constexpr u64 hash_string = hud::keyed_hash_64<const char8 *> {42}("key");
+        hud_assert_eq(hash_string, hud::hash_algorithm::wyhash::hash_64("key", 3, 42));
+    }
+}
+
+GTEST_TEST(hash_64, keyed_hash_64_of_composite_keys)
+{
+    using pair_key = hud::pair<u32, const char8 *>;
+    using tuple_key = hud::tuple<u64, f32, hud::pair<u32, const char8 *>>;
+
+    // Every element is hashed with its keyed hash, not only the combined result
+    const auto pair_expected = [](u64 seed, const pair_key &key) {
+        const u64 state = hud::hash_algorithm::wyhash::combine_64(seed, hud::keyed_hash_64<u32> {seed}(key.first));
+        return hud::hash_algorithm::wyhash::combine_64(state, hud::keyed_hash_64<const char8 *> {seed}(key.second));
+    };
+
+    // Non constant
+    {
+        const pair_key key {1u, "key"};
+        hud_assert_eq(hud::keyed_hash_64<pair_key> {42}(key), pair_expected(42, key));
+        hud_assert_eq(hud::keyed_hash_64<pair_key> {42}(key), hud::keyed_hasher_64 {42}(1u)("key").result());
+        hud_assert_ne(hud::keyed_hash_64<pair_key> {42}(key), hud::keyed_hash_64<pair_key> {43}(key));
+        hud_assert_eq(hud::keyed_hash_64<pair_key> {}.seed(), hud::process_hash_seed());
+
+        const tuple_key tuple {2u, 0.5f, key};
+        const u64 tuple_hash = hud::keyed_hasher_64 {42}(u64 {2})(0.5f)(key).result();
+        hud_assert_eq(hud::keyed_hash_64<tuple_key> {42}(tuple), tuple_hash);
+        hud_assert_ne(hud::keyed_hash_64<tuple_key> {42}(tuple), hud::keyed_hash_64<tuple_key> {43}(tuple));
+    }
+
+    // Constant
+    {
+        constexpr u64 pair_hash = hud::keyed_hash_64<pair_key> {42}(pair_key {1u, "key"});
+        hud_assert_eq(pair_hash, pair_expected(42, pair_key {1u, "key"}));
+        constexpr u64 tuple_hash = hud::keyed_hash_64<tuple_key> {42}(tuple_key {2u, 0.5f, pair_key {1u, "key"}});
+        hud_assert_eq(tuple_hash, hud::keyed_hasher_64 {42}(u64 {2})(0.5f)(pair_key {1u, "key"}).result());
+    }
+}
+
 GTEST_TEST(hash_64, hash_custom_type)
 {
     // Non constant
@@ -0,0 +1,186 @@
+#include <core/hash.h>
+#include <core/containers/hashmap.h>
+
+GTEST_TEST(wyhash, hash64)
+{
+    // Test vectors of the reference implementation, the seed is the index of the test vector
+    hud_assert_eq(hud::hash_algorithm::wyhash::hash_64("", 0, 0), 0x93228A4DE0EEC5A2u);
+    hud_assert_eq(hud::hash_algorithm::wyhash::hash_64("a", 1, 1), 0xC5BAC3DB178713C4u);
+    hud_assert_eq(hud::hash_algorithm::wyhash::hash_64("abc", 3, 2), 0xA97F2F7B1D9B3314u);
+    hud_assert_eq(hud::hash_algorithm::wyhash::hash_64("message digest", 14, 3), 0x786D1F1DF3801DF4u);
+    hud_assert_eq(hud::hash_algorithm::wyhash::hash_64("abcdefghijklmnopqrstuvwxyz", 26, 4), 0xDCA5A8138AD37C87u);
+    hud_assert_eq(hud::hash_algorithm::wyhash::hash_64("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 62, 5), 0xB9E734F117CFAF70u);
+    hud_assert_eq(hud::hash_algorithm::wyhash::hash_64("12345678901234567890123456789012345678901234567890123456789012345678901234567890", 80, 6), 0x6CC5EAB49A92D617u);
+
+    // Every length give a different hash
+    char8 key[256];
+    for (usize i = 0; i < 256; i++) {
+        key[i] = static_cast<char8>(i);
+    }
+    hud::hashset<u64> hashes;
+    for (usize i = 0; i < 256; i++) {
+        hashes.add(hud::hash_algorithm::wyhash::hash_64(key, i));
+    }
+    hud_assert_eq(hashes.count(), 256u);
+}
+
+GTEST_TEST(wyhash, hash64_is_usable_in_constexpr)
+{
+    constexpr u64 hash_empty = hud::hash_algorithm::wyhash::hash_64("", 0, 0);
+    hud_assert_eq(hash_empty, 0x93228A4DE0EEC5A2u);
+    constexpr u64 hash_long = hud::hash_algorithm::wyhash::hash_64("12345678901234567890123456789012345678901234567890123456789012345678901234567890", 80, 6);
+    hud_assert_eq(hash_long, 0x6CC5EAB49A92D617u);
+    constexpr u64 hash_value = hud::hash_algorithm::wyhash::hash_64(u64 {42});
+    hud_assert_eq(hash_value, hud::hash_algorithm::wyhash::hash_64(u64 {42}));
+}
+
+GTEST_TEST(wyhash, hash64_of_value_avalanche)
+{
+    // Flipping one bit of the value flips half of the bits of the hash on average
+    usize flipped_bit_count = 0;
+    for (u64 value = 0; value < 1000; value++) {
+        const u64 hash = hud::hash_algorithm::wyhash::hash_64(value);
+        for (u32 bit = 0; bit < 64; bit++) {
+            for (u64 diff = hash ^ hud::hash_algorithm::wyhash::hash_64(value ^ (u64 {1} << bit)); diff != 0; diff &= diff - 1) {
+                flipped_bit_count++;
+            }
+        }
+    }
+    const usize flip_count = 1000 * 64;
+    hud_assert_true(flipped_bit_count > flip_count * 31 && flipped_bit_count < flip_count * 33);
+}
+
+GTEST_TEST(wyhash, wyhash_64)
+{
+    // Non constant
+    {
+        hud_assert_eq(hud::wyhash_64<u32> {}(42u), hud::hash_algorithm::wyhash::hash_64(u64 {42}));
+        hud_assert_eq(hud::wyhash_64<i8> {}(i8 {-1}), hud::hash_algorithm::wyhash::hash_64(hud::u64_max));
+        hud_assert_eq(hud::wyhash_64<f32> {}(1.0f), hud::hash_algorithm::wyhash::hash_64(u64 {0x3F800000}));
+        hud_assert_eq(hud::wyhash_64<f64> {}(1.0), hud::hash_algorithm::wyhash::hash_64(u64 {0x3FF0000000000000}));
+        hud_assert_eq(hud::wyhash_64<const char8 *> {}("key"), hud::hash_algorithm::wyhash::hash_64("key", 3));
+        hud_assert_eq(hud::wyhash_64<char8 *> {}("key", 3), hud::hash_algorithm::wyhash::hash_64("key", 3));
+        hud_assert_eq(hud::wyhash_64<const wchar *> {}(L"key"), hud::hash_algorithm::wyhash::hash_64(reinterpret_cast<const char8 *>(L"key"), 3 * sizeof(wchar)));
+        const u64 *pointer = nullptr;
+        hud_assert_eq(hud::wyhash_64<const u64 *> {}(pointer), hud::hash_algorithm::wyhash::hash_64(u64 {0}));
+        // Types not supported by wyhash use hud::hash_64
+        hud_assert_eq(hud::wyhash_64<u128> {}(u128 {1, 2}), hud::hash_64<u128> {}(u128 {1, 2}));
+    }
+
+    // Constant
+    {
+        constexpr u64 hash_u32 = hud::wyhash_64<u32> {}(42u);
+        hud_assert_eq(hash_u32, hud::hash_algorithm::wyhash::hash_64(u64 {42}));
+        constexpr u64 hash_f64 = hud::wyhash_64<f64> {}(1.0);
+        hud_assert_eq(hash_f64, hud::hash_algorithm::wyhash::hash_64(u64 {0x3FF0000000000000}));
+        constexpr u64 hash_string = hud::wyhash_64<const char8 *> {}("key");
+        hud_assert_eq(hash_string, hud::hash_algorithm::wyhash::hash_64("key", 3));
+    }
+}
+
+GTEST_TEST(wyhash, wyhasher_64)
+{
+    const auto test = []() {
+        hud::wyhasher_64 hasher;
+        hasher(u32 {42}).hash("key", usize {3});
+        return std::tuple {
+            hasher.result(),
+            hud::wyhasher_64 {}(u32 {42}).result(),
+            hud::wyhasher_64 {}("key", usize {3}).result()
+        };
+    };
+
+    // Non constant
+    {
+        const auto result = test();
+        const u64 hash_42 = hud::hash_algorithm::wyhash::combine_64(0, hud::wyhash_64<u32> {}(42u));
+        hud_assert_eq(std::get<1>(result), hash_42);
+        hud_assert_eq(std::get<0>(result), hud::hash_algorithm::wyhash::combine_64(hash_42, hud::hash_algorithm::wyhash::hash_64("key", 3)));
+        // Combining is not commutative
+        hud_assert_ne(std::get<0>(result), hud::wyhasher_64 {}("key", usize {3})(u32 {42}).result());
+    }
+
+    // Constant
+    {
+        constexpr auto result = test();
+        const u64 hash_42 = hud::hash_algorithm::wyhash::combine_64(0, hud::wyhash_64<u32> {}(42u));
+        hud_assert_eq(std::get<1>(result), hash_42);
+        hud_assert_eq(std::get<0>(result), hud::hash_algorithm::wyhash::combine_64(hash_42, hud::hash_algorithm::wyhash::hash_64("key", 3)));
+    }
+}
+
+GTEST_TEST(wyhash, hashmap_use_wyhash_64)
+{
+    const auto test = []() {
+        hud::hashmap<u64, u64, hud::wyhash_64<u64>> map;
+        for (u64 key = 0; key < 1000; key++) {
+            map.add(key, key * 2);
+        }
+        bool is_find_ok = true;
+        for (u64 key = 0; key < 2000; key++) {
+            const auto it = map.find(key);
+            is_find_ok &= key < 1000 ? (it != map.end() && it->value() == key * 2) : it == map.end();
+        }
+        return std::tuple {map.count(), is_find_ok};
+    };
+
+    // Non constant
+    {
+        const auto result = test();
+        hud_assert_eq(std::get<0>(result), 1000u);
+        hud_assert_true(std::get<1>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test();
+        hud_assert_eq(std::get<0>(result), 1000u);
+        hud_assert_true(std::get<1>(result));
+    }
+}
+
+GTEST_TEST(wyhash, hashmap_use_wyhash_64_with_composite_keys)
+{
+    using pair_key = hud::pair<u32, u32>;
+    using tuple_key = hud::tuple<u32, u64, f32>;
+    const auto test = []() {
+        hud::hashmap<pair_key, u64, hud::wyhash_64<pair_key>> pair_map;
+        hud::hashmap<tuple_key, u64, hud::wyhash_64<tuple_key>> tuple_map;
+        for (u32 index = 0; index < 1000; index++) {
+            pair_map.add(pair_key {index / 10, index % 10}, index);
+            tuple_map.add(tuple_key {index, u64 {index} * 3, 0.5f}, index);
+        }
+        bool is_find_ok = true;
+        for (u32 index = 0; index < 2000; index++) {
+            const auto pair_it = pair_map.find(pair_key {index / 10, index % 10});
+            is_find_ok &= index < 1000 ? (pair_it != pair_map.end() && pair_it->value() == index) : pair_it == pair_map.end();
+            const auto tuple_it = tuple_map.find(tuple_key {index, u64 {index} * 3, 0.5f});
+            is_find_ok &= index < 1000 ? (tuple_it != tuple_map.end() && tuple_it->value() == index) : tuple_it == tuple_map.end();
+        }
+        // Elements are combined with wyhash and the same key always has the same hash
+        const u64 pair_hash = hud::wyhash_64<pair_key> {}(pair_key {1, 2});
+        const bool is_wyhash = pair_hash == hud::wyhasher_64 {}(u32 {1})(u32 {2}).result()
+                               && pair_hash == hud::wyhash_64<pair_key> {}(pair_key {1, 2})
+                               && pair_map.hash_of(pair_key {1, 2}) == pair_hash
+                               && hud::wyhash_64<tuple_key> {}(tuple_key {1, 2, 0.5f}) == hud::wyhasher_64 {}(u32 {1})(u64 {2})(0.5f).result();
+        return std::tuple {pair_map.count(), tuple_map.count(), is_find_ok, is_wyhash};
+    };
+
+    // Non constant
+    {
+        const auto result = test();
+        hud_assert_eq(std::get<0>(result), 1000u);
+        hud_assert_eq(std::get<1>(result), 1000u);
+        hud_assert_true(std::get<2>(result));
+        hud_assert_true(std::get<3>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test();
+        hud_assert_eq(std::get<0>(result), 1000u);
+        hud_assert_eq(std::get<1>(result), 1000u);
+        hud_assert_true(std::get<2>(result));
+        hud_assert_true(std::get<3>(result));
+    }
+}
@@ -4959,3 +4959,63 @@ GTEST_TEST(hashmap, add_by_piecewise_construct_tuples)
         hud_assert_true(std::get<2>(result));
     }
 }
+
+GTEST_TEST(hashmap, add_range_and_add_unique_range)
+{
+    const auto test = [](usize count)
+    {
+        hud::vector<hud::pair<usize, usize>> pairs;
+        for (usize key = 0; key < count; key++)
+        {
+            pairs.add(hud::pair<usize, usize> {key, key * 2});
+        }
+        // The first pair of a key is inserted
+        pairs.add(hud::pair<usize, usize> {usize {0}, usize {1}});
+        hud::hashmap<usize, usize> map(hud::slice {pairs.data(), pairs.count()});
+
+        hud::vector<hud::pair<usize, usize>> unique_pairs;
+        for (usize key = count; key < count * 2; key++)
+        {
+            unique_pairs.add(hud::pair<usize, usize> {key, key * 2});
+        }
+        map.add_unique_range(hud::slice {unique_pairs.data(), unique_pairs.count()});
+
+        hud::vector<hud::pair<usize, usize>> moved_pairs;
+        for (usize key = count * 2; key < count * 3; key++)
+        {
+            moved_pairs.add(hud::pair<usize, usize> {key, key * 2});
+        }
+        map.add_range(hud::move(moved_pairs));
+
+        bool is_find_ok = true;
+        for (usize key = 0; key < count * 4; key++)
+        {
+            const auto it = map.find(key);
+            if (key < count * 3)
+            {
+                is_find_ok &= it != map.end() && it->value() == key * 2;
+            }
+            else
+            {
+                is_find_ok &= it == map.end();
+            }
+        }
+        return std::tuple {map.count() == count * 3, is_find_ok, moved_pairs.count() == 0};
+    };
+
+    // Non constant
+    {
+        const auto result = test(10000);
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_true(std::get<2>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test(50);
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_true(std::get<2>(result));
+    }
+}
@@ -1,4 +1,5 @@
 #include <core/containers/hashmap.h>
+#include <core/containers/vector.h>
 #include <core/templates/integer_sequence.h>
 
 GTEST_TEST(hashmap, find_in_empty_hashmap)
@@ -197,3 +198,111 @@ GTEST_TEST(hashmap, find_in_hashmap_non_trivial_type)
         hud_assert_true(result128);
     }
 }
+
+GTEST_TEST(hashmap, find_batch_in_hashmap_trivial_type)
+{
+    static const auto test = [](usize max) {
+        using KeyType = usize;
+        using ValueType = usize;
+        hud::hashmap<KeyType, ValueType> map;
+
+        for (u32 index = 0; index < max; index++) {
+            map.add(index, index * index);
+        }
+
+        // Search elements that exists and the same count of elements that not exists
+        hud::vector<KeyType> keys;
+        hud::vector<hud::hashmap<KeyType, ValueType>::iterator> results;
+        for (u32 index = 0; index < max * 2; index++) {
+            keys.add(index);
+            results.add(map.end());
+        }
+        map.find_batch(hud::slice {keys.data(), keys.count()}, hud::slice {results.data(), results.count()});
+
+        bool is_find_ok = true;
+        for (u32 index = 0; index < max; index++) {
+            if (results[index] == map.end()) {
+                is_find_ok = false;
+            }
+            else if (results[index]->key() != index || results[index]->value() != index * index) {
+                is_find_ok = false;
+            }
+        }
+        for (u32 index = max; index < max * 2; index++) {
+            if (results[index] != map.end()) {
+                is_find_ok = false;
+            }
+        }
+        return is_find_ok;
+    };
+
+    // Non constant
+    {
+        const auto result = runtime_test(test, 32768);
+        hud_assert_true(result);
+    }
+
+    // Constant
+    {
+        constexpr auto result1 = test(1);
+        hud_assert_true(result1);
+        constexpr auto result16 = test(16);
+        hud_assert_true(result16);
+        constexpr auto result17 = test(17);
+        hud_assert_true(result17);
+        constexpr auto result64 = test(64);
+        hud_assert_true(result64);
+    }
+}
+
+GTEST_TEST(hashmap, add_and_find_with_hash_trivial_type)
+{
+    static const auto test = [](usize max) {
+        using KeyType = usize;
+        using ValueType = usize;
+        hud::hashmap<KeyType, ValueType> map;
+
+        // The hash of each key is computed once and reused for all operations
+        for (u32 index = 0; index < max; index++) {
+            map.add_with_hash(index, index * index, map.hash_of(index));
+        }
+
+        bool is_find_ok = map.count() == max;
+        for (u32 index = 0; index < max * 2; index++) {
+            const u64 hash = map.hash_of(index);
+            const auto it = map.find_with_hash(index, hash);
+            if (index < max) {
+                if (it == map.end() || it->key() != index || it->value() != index * index) {
+                    is_find_ok = false;
+                }
+            }
+            else if (it != map.end()) {
+                is_find_ok = false;
+            }
+            map.remove_with_hash(index, hash);
+            if (map.contains_with_hash(index, hash)) {
+                is_find_ok = false;
+            }
+        }
+        if (map.count() != 0) {
+            is_find_ok = false;
+        }
+        return is_find_ok;
+    };
+
+    // Non constant
+    {
+        const auto result = runtime_test(test, 32768);
+        hud_assert_true(result);
+    }
+
+    // Constant
+    {
+        constexpr auto result1 = test(1);
+        hud_assert_true(result1);
+        constexpr auto result17 = test(17);
+        hud_assert_true(result17);
+        constexpr auto result64 = test(64);
+        hud_assert_true(result64);
+    }
+}
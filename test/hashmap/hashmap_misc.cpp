@@ -67,9 +67,142 @@ GTEST_TEST(hashmap, sizeof_map_is_correct)
     constexpr usize control_ptr_size = sizeof(void *);
     constexpr usize slot_ptr_size = sizeof(void *);
     constexpr usize count_size = sizeof(usize);
+    constexpr usize deleted_count_size = sizeof(usize);
     constexpr usize max_count_size = sizeof(usize);
     constexpr usize free_slot_before_grow_size = sizeof(usize);
+#if defined(HD_HASHSET_INSTRUMENTATION)
+    constexpr usize probe_counters_size = 2 * sizeof(u64);
+#else
+    constexpr usize probe_counters_size = 0;
+#endif
 
     constexpr usize sizeof_map = sizeof(hud::hashmap<i32, i32>);
-    hud_assert_true(sizeof_map == control_ptr_size + slot_ptr_size + count_size + max_count_size + free_slot_before_grow_size);
+    hud_assert_true(sizeof_map == control_ptr_size + slot_ptr_size + count_size + deleted_count_size + max_count_size + free_slot_before_grow_size + probe_counters_size);
+}
+
+GTEST_TEST(hashmap, stats_report_count_and_memory)
+{
+    const auto test = []()
+    {
+        hud::hashmap<usize, usize> map;
+        constexpr usize COUNT = 256;
+        for (usize value = 0; value < COUNT; value++)
+        {
+            map.add(value, value);
+        }
+        const auto stats = map.stats();
+        const auto probe_stats = map.probe_stats();
+        usize histogram_sum = 0;
+        for (usize count : probe_stats.probe_length_histogram)
+        {
+            histogram_sum += count;
+        }
+        return std::tuple {
+            stats.count == COUNT,
+            stats.max_count == map.max_count(),
+            stats.load_factor == static_cast<f32>(COUNT) / static_cast<f32>(map.max_count()),
+            stats.allocation_size >= map.max_count() * (2 * sizeof(usize) + 1),
+            histogram_sum == COUNT,
+            probe_stats.max_probe_length >= 1,
+            probe_stats.average_probe_length >= 1.0f && probe_stats.average_probe_length <= static_cast<f32>(probe_stats.max_probe_length)
+        };
+    };
+
+    // Non constant
+    {
+        const auto result = test();
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_true(std::get<2>(result));
+        hud_assert_true(std::get<3>(result));
+        hud_assert_true(std::get<4>(result));
+        hud_assert_true(std::get<5>(result));
+        hud_assert_true(std::get<6>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test();
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_true(std::get<2>(result));
+        hud_assert_true(std::get<3>(result));
+        hud_assert_true(std::get<4>(result));
+        hud_assert_true(std::get<5>(result));
+        hud_assert_true(std::get<6>(result));
+    }
+}
+
+GTEST_TEST(hashmap, keyed_hash_64_spread_crafted_keys)
+{
+    // Keys that differ only in their high bits: hud::hash_64 keeps them as is so they all start probing in the same group,
+    // finding the last one scans at least 256 / 16 groups
+    const auto test = []()
+    {
+        hud::hashmap<u64, u64> map;
+        hud::hashmap<u64, u64, hud::keyed_hash_64<u64>> keyed_map;
+        for (u64 index = 0; index < 256; index++)
+        {
+            map.add(index << 32, index);
+            keyed_map.add(index << 32, index);
+        }
+        bool is_find_ok = true;
+        for (u64 index = 0; index < 256; index++)
+        {
+            is_find_ok &= keyed_map.find(index << 32)->value() == index;
+        }
+        return std::tuple {map.probe_stats().max_probe_length, keyed_map.probe_stats().max_probe_length, is_find_ok};
+    };
+
+    // Non constant
+    {
+        const auto result = test();
+        hud_assert_true(std::get<0>(result) >= 16u);
+        hud_assert_true(std::get<1>(result) <= 3u);
+        hud_assert_true(std::get<2>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test();
+        hud_assert_true(std::get<0>(result) >= 16u);
+        hud_assert_true(std::get<1>(result) <= 3u);
+        hud_assert_true(std::get<2>(result));
+    }
+}
+
+GTEST_TEST(hashmap, keyed_hash_64_of_pair_keys)
+{
+    using key_type = hud::pair<u64, u64>;
+    const auto test = []()
+    {
+        hud::hashmap<key_type, u64, hud::keyed_hash_64<key_type>> map;
+        for (u64 index = 0; index < 256; index++)
+        {
+            map.add(key_type {index << 32, index}, index);
+        }
+        bool is_find_ok = true;
+        for (u64 index = 0; index < 512; index++)
+        {
+            const auto it = map.find(key_type {index << 32, index});
+            is_find_ok &= index < 256 ? (it != map.end() && it->value() == index) : it == map.end();
+        }
+        return std::tuple {map.count(), map.probe_stats().max_probe_length, is_find_ok};
+    };
+
+    // Non constant
+    {
+        const auto result = test();
+        hud_assert_eq(std::get<0>(result), 256u);
+        hud_assert_true(std::get<1>(result) <= 3u);
+        hud_assert_true(std::get<2>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test();
+        hud_assert_eq(std::get<0>(result), 256u);
+        hud_assert_true(std::get<1>(result) <= 3u);
+        hud_assert_true(std::get<2>(result));
+    }
 }
@@ -0,0 +1,40 @@
+#include <core/containers/hashmap.h>
+
+GTEST_TEST(hashmap, policy_is_applied)
+{
+    const auto test = [](usize count)
+    {
+        hud::hashmap<usize, usize, hud::hash_64<usize>, hud::equal<usize>, hud::heap_allocator, hud::dense_hashset_policy> dense_map;
+        hud::hashmap<usize, usize> default_map;
+        for (usize value = 0; value < count; value++)
+        {
+            dense_map.add(value, value * 2);
+            default_map.add(value, value * 2);
+        }
+        bool is_find_ok = true;
+        for (usize value = 0; value < count; value++)
+        {
+            const auto it = dense_map.find(value);
+            is_find_ok &= it != dense_map.end() && it->value() == value * 2;
+        }
+        return std::tuple {is_find_ok, dense_map.max_count(), default_map.max_count()};
+    };
+
+    // Non constant
+    {
+        const auto result = test(900);
+        hud_assert_true(std::get<0>(result));
+        // 900 elements fit in 1023 slots at 9/10 but need 2047 slots at 7/8
+        hud_assert_eq(std::get<1>(result), 1023u);
+        hud_assert_eq(std::get<2>(result), 2047u);
+    }
+
+    // Constant
+    {
+        // 115 elements fit in 127 slots at 9/10 but need 255 slots at 7/8
+        constexpr auto result = test(115);
+        hud_assert_true(std::get<0>(result));
+        hud_assert_eq(std::get<1>(result), 127u);
+        hud_assert_eq(std::get<2>(result), 255u);
+    }
+}
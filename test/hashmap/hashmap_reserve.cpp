@@ -205,4 +205,36 @@ GTEST_TEST(hashmap, reserve_less_than_count_but_more_than_count_do_nothing)
         constexpr auto result = test();
         hud_assert_true(result);
     }
-}
\ No newline at end of file
+}
+
+GTEST_TEST(hashmap, reserve_parallel_relocate_keys_and_values)
+{
+    hud::hashmap<usize, usize> map;
+    for (usize key = 0; key < 20000; key++)
+    {
+        map.add(key, key * 2);
+    }
+
+    usize executor_call_count = 0;
+    map.reserve_parallel(100000, [&executor_call_count](usize task_count, auto &&task)
+                         {
+                             executor_call_count++;
+                             for (usize task_index = 0; task_index < task_count; task_index++)
+                             {
+                                 task(task_index);
+                             }
+                         },
+                         1);
+    hud_assert_eq(executor_call_count, 1u);
+    hud_assert_eq(map.count(), 20000u);
+    hud_assert_eq(map.max_count(), 131071u);
+
+    bool is_find_ok = true;
+    for (usize key = 0; key < 40000; key++)
+    {
+        const auto it = map.find(key);
+        is_find_ok &= (it != map.end()) == (key < 20000);
+        is_find_ok &= it == map.end() || it->value() == key * 2;
+    }
+    hud_assert_true(is_find_ok);
+}
@@ -2518,3 +2518,223 @@ GTEST_TEST(hashset, add_by_piecewise_construct_tuples)
         hud_assert_true(std::get<1>(result));
     }
 }
+
+GTEST_TEST(hashset, add_with_hash_trivial_type)
+{
+    const auto test = [](usize max) {
+        using KeyType = usize;
+        hud::hashset<KeyType> set;
+
+        bool is_add_ok = true;
+        for (u32 index = 0; index < max; index++) {
+            const auto it = set.add_with_hash(index, set.hash_of(index));
+            if (it->key() != index) {
+                is_add_ok = false;
+            }
+        }
+        // Adding existing keys returns the existing element
+        for (u32 index = 0; index < max; index++) {
+            const auto it = set.add_with_hash(index, set.hash_of(index));
+            if (it != set.find(index)) {
+                is_add_ok = false;
+            }
+        }
+        if (set.count() != max) {
+            is_add_ok = false;
+        }
+        return is_add_ok;
+    };
+
+    // Non constant
+    {
+        const auto result = runtime_test(test, 32767);
+        hud_assert_true(result);
+    }
+
+    // Constant
+    {
+        constexpr auto result1 = test(1);
+        hud_assert_true(result1);
+        constexpr auto result8 = test(8);
+        hud_assert_true(result8);
+        constexpr auto result17 = test(17);
+        hud_assert_true(result17);
+        constexpr auto result64 = test(64);
+        hud_assert_true(result64);
+    }
+}
+
+GTEST_TEST(hashset, add_with_hash_braced_key)
+{
+    const auto test = []() {
+        using KeyType = hud::pair<u32, u32>;
+        hud::hashset<KeyType> set;
+        // The key type is deduced from the default template argument
+        const auto it = set.add_with_hash({1u, 2u}, set.hash_of(KeyType {1u, 2u}));
+        return std::tuple {it->key() == KeyType {1u, 2u}, set.count(), set.contains(KeyType {1u, 2u})};
+    };
+
+    // Non constant
+    {
+        const auto result = runtime_test(test);
+        hud_assert_true(std::get<0>(result));
+        hud_assert_eq(std::get<1>(result), 1u);
+        hud_assert_true(std::get<2>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test();
+        hud_assert_true(std::get<0>(result));
+        hud_assert_eq(std::get<1>(result), 1u);
+        hud_assert_true(std::get<2>(result));
+    }
+}
+
+GTEST_TEST(hashset, add_range_grows_once)
+{
+    using hashset_type = hud::hashset<usize, hud::hash_64<usize>, hud::equal<usize>, hud_test::allocator_watcher<alignof(usize)>>;
+
+    const auto test = [](usize count)
+    {
+        hud::vector<usize> keys;
+        for (usize value = 0; value < count; value++)
+        {
+            keys.add(value);
+        }
+        // Keys in the slice several times and keys already in the hashset are inserted once
+        keys.add(usize {0});
+        keys.add(count - 1);
+        hashset_type set;
+        set.add(usize {1});
+        const u32 allocation_count_before = set.allocator().allocation_count();
+        set.add_range(hud::slice {keys.data(), keys.count()});
+
+        bool is_find_ok = true;
+        for (usize value = 0; value < count * 2; value++)
+        {
+            is_find_ok &= set.contains(value) == (value < count);
+        }
+        return std::tuple {
+            set.count() == count,
+            is_find_ok,
+            set.allocator().allocation_count() - allocation_count_before == (hud::is_constant_evaluated() ? 2u : 1u),
+            keys.count() == count + 2
+        };
+    };
+
+    // Non constant
+    {
+        const auto result = test(10000);
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_true(std::get<2>(result));
+        hud_assert_true(std::get<3>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test(100);
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_true(std::get<2>(result));
+        hud_assert_true(std::get<3>(result));
+    }
+}
+
+GTEST_TEST(hashset, add_unique_range)
+{
+    const auto test = [](usize count)
+    {
+        hud::vector<usize> keys;
+        for (usize value = 0; value < count; value++)
+        {
+            keys.add(value);
+        }
+        hud::hashset<usize> set(hud::slice {keys.data(), count / 2});
+        set.add_unique_range(hud::slice {keys.data() + count / 2, count - count / 2});
+
+        bool is_find_ok = true;
+        for (usize value = 0; value < count * 2; value++)
+        {
+            is_find_ok &= set.contains(value) == (value < count);
+        }
+        return std::tuple {set.count() == count, is_find_ok};
+    };
+
+    // Non constant
+    {
+        const auto result = test(10000);
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test(100);
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+    }
+}
+
+GTEST_TEST(hashset, add_range_move_keys_out_of_vector)
+{
+    using key_type = hud_test::non_bitwise_move_constructible_type;
+
+    const auto test = [](i32 count)
+    {
+        const auto fill_keys = [](hud::vector<key_type> &keys, i32 first, i32 count)
+        {
+            keys.reserve(count);
+            for (i32 value = first; value < first + count; value++)
+            {
+                keys.emplace_back(value);
+            }
+        };
+        hud::vector<key_type> first_keys;
+        fill_keys(first_keys, 0, count);
+        hud::hashset<key_type> set(hud::move(first_keys));
+        hud::vector<key_type> keys;
+        fill_keys(keys, count, count);
+        set.add_range(hud::move(keys));
+        hud::vector<key_type> unique_keys;
+        fill_keys(unique_keys, count * 2, count);
+        set.add_unique_range(hud::move(unique_keys));
+
+        // Keys are moved, never copied
+        bool is_moved = true;
+        for (const auto &element : set)
+        {
+            is_moved &= element.key().move_constructor_count() >= 1 && element.key().copy_constructor_count() == 0;
+        }
+        bool is_find_ok = true;
+        for (i32 value = 0; value < count * 3; value++)
+        {
+            is_find_ok &= set.contains(key_type {value});
+        }
+        return std::tuple {
+            set.count() == static_cast<usize>(count) * 3,
+            is_moved,
+            is_find_ok,
+            first_keys.count() == 0 && keys.count() == 0 && unique_keys.count() == 0
+        };
+    };
+
+    // Non constant
+    {
+        const auto result = test(1000);
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_true(std::get<2>(result));
+        hud_assert_true(std::get<3>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test(30);
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_true(std::get<2>(result));
+        hud_assert_true(std::get<3>(result));
+    }
+}
@@ -1,4 +1,5 @@
 #include <core/containers/hashset.h>
+#include <core/containers/vector.h>
 
 GTEST_TEST(hashset, contains_in_empty_hashset)
 {
@@ -158,4 +159,50 @@ GTEST_TEST(hashset, contains_in_hashset_non_trivial_type)
         constexpr auto result128 = test(128);
         hud_assert_true(result128);
     }
-}
\ No newline at end of file
+}
+GTEST_TEST(hashset, contains_batch_in_hashset_trivial_type)
+{
+    const auto test = [](usize max) {
+        using KeyType = usize;
+        hud::hashset<KeyType> set;
+
+        // Only even keys are added
+        for (u32 index = 0; index < max; index += 2) {
+            set.add(index);
+        }
+
+        hud::vector<KeyType> keys;
+        hud::vector<bool> results;
+        for (u32 index = 0; index < max; index++) {
+            keys.add(index);
+            results.add(false);
+        }
+        const usize found_count = set.contains_batch(hud::slice {keys.data(), keys.count()}, hud::slice {results.data(), results.count()});
+
+        bool is_contains_ok = found_count == set.count();
+        for (u32 index = 0; index < max; index++) {
+            if (results[index] != (index % 2 == 0)) {
+                is_contains_ok = false;
+            }
+        }
+        return is_contains_ok;
+    };
+
+    // Non constant
+    {
+        const auto result = runtime_test(test, 32767);
+        hud_assert_true(result);
+    }
+
+    // Constant
+    {
+        constexpr auto result1 = test(1);
+        hud_assert_true(result1);
+        constexpr auto result16 = test(16);
+        hud_assert_true(result16);
+        constexpr auto result33 = test(33);
+        hud_assert_true(result33);
+        constexpr auto result128 = test(128);
+        hud_assert_true(result128);
+    }
+}
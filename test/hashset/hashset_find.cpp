@@ -1,4 +1,5 @@
 #include <core/containers/hashset.h>
+#include <core/containers/vector.h>
 #include <core/templates/integer_sequence.h>
 
 GTEST_TEST(hashset, find_in_empty_hashset)
@@ -188,3 +189,209 @@ GTEST_TEST(hashset, find_in_hashset_non_trivial_type)
         hud_assert_true(result128);
     }
 }
+
+GTEST_TEST(hashset, find_batch_in_empty_hashset)
+{
+    hud::hashset<usize> set;
+    usize keys[3] {1, 2, 3};
+    hud::hashset<usize>::iterator results[3] {set.begin(), set.begin(), set.begin()};
+    set.find_batch(hud::slice {keys, 3}, hud::slice {results, 3});
+    hud_assert_eq(results[0], set.end());
+    hud_assert_eq(results[1], set.end());
+    hud_assert_eq(results[2], set.end());
+}
+
+GTEST_TEST(hashset, find_batch_in_hashset_trivial_type)
+{
+    const auto test = [](usize max) {
+        using KeyType = usize;
+        hud::hashset<KeyType> set;
+
+        for (u32 index = 0; index < max; index++) {
+            set.add(index);
+        }
+
+        // Search elements that exists and the same count of elements that not exists
+        hud::vector<KeyType> keys;
+        hud::vector<hud::hashset<KeyType>::iterator> results;
+        for (u32 index = 0; index < max * 2; index++) {
+            keys.add(index);
+            results.add(set.end());
+        }
+        set.find_batch(hud::slice {keys.data(), keys.count()}, hud::slice {results.data(), results.count()});
+
+        bool is_find_ok = true;
+        for (u32 index = 0; index < max; index++) {
+            if (results[index] == set.end()) {
+                is_find_ok = false;
+            }
+            else if (results[index]->key() != index) {
+                is_find_ok = false;
+            }
+        }
+        for (u32 index = max; index < max * 2; index++) {
+            if (results[index] != set.end()) {
+                is_find_ok = false;
+            }
+        }
+        return is_find_ok;
+    };
+
+    // Non constant
+    {
+        const auto result = runtime_test(test, 32767);
+        hud_assert_true(result);
+    }
+
+    // Constant
+    {
+        constexpr auto result1 = test(1);
+        hud_assert_true(result1);
+        constexpr auto result7 = test(7);
+        hud_assert_true(result7);
+        constexpr auto result8 = test(8);
+        hud_assert_true(result8);
+        constexpr auto result16 = test(16);
+        hud_assert_true(result16);
+        constexpr auto result17 = test(17);
+        hud_assert_true(result17);
+        constexpr auto result64 = test(64);
+        hud_assert_true(result64);
+    }
+}
+
+GTEST_TEST(hashset, find_batch_in_const_hashset_non_trivial_type)
+{
+    const auto test = [](usize max) {
+        using KeyType = hud_test::non_bitwise_type;
+        hud::hashset<KeyType> mutable_set;
+
+        for (u32 index = 0; index < max; index++) {
+            mutable_set.add(index);
+        }
+        const hud::hashset<KeyType> &set = mutable_set;
+
+        // Keys are not of key_type, each one is converted before being searched
+        hud::vector<i32> keys;
+        hud::vector<hud::hashset<KeyType>::const_iterator> results;
+        for (u32 index = 0; index < max * 2; index++) {
+            keys.add(static_cast<i32>(index));
+            results.add(set.end());
+        }
+        set.find_batch(hud::slice {keys.data(), keys.count()}, hud::slice {results.data(), results.count()});
+
+        bool is_find_ok = true;
+        for (u32 index = 0; index < max * 2; index++) {
+            if (results[index] != set.find(keys[index])) {
+                is_find_ok = false;
+            }
+        }
+        return is_find_ok;
+    };
+
+    // Non constant
+    {
+        const auto result = runtime_test(test, 1000);
+        hud_assert_true(result);
+    }
+
+    // Constant
+    {
+        constexpr auto result1 = test(1);
+        hud_assert_true(result1);
+        constexpr auto result17 = test(17);
+        hud_assert_true(result17);
+        constexpr auto result64 = test(64);
+        hud_assert_true(result64);
+    }
+}
+
+GTEST_TEST(hashset, find_with_hash_in_hashset_trivial_type)
+{
+    const auto test = [](usize max) {
+        using KeyType = usize;
+        hud::hashset<KeyType> set;
+
+        for (u32 index = 0; index < max; index++) {
+            set.add(index);
+        }
+
+        bool is_find_ok = true;
+        for (u32 index = 0; index < max * 2; index++) {
+            const u64 hash = set.hash_of(index);
+            // The hash is the one computed by the hasher
+            if (hash != hud::hash_64<KeyType> {}(index)) {
+                is_find_ok = false;
+            }
+            const auto it = set.find_with_hash(index, hash);
+            if (it != set.find(index)) {
+                is_find_ok = false;
+            }
+            if (set.contains_with_hash(index, hash) != (index < max)) {
+                is_find_ok = false;
+            }
+        }
+        return is_find_ok;
+    };
+
+    // Non constant
+    {
+        const auto result = runtime_test(test, 32767);
+        hud_assert_true(result);
+    }
+
+    // Constant
+    {
+        constexpr auto result1 = test(1);
+        hud_assert_true(result1);
+        constexpr auto result8 = test(8);
+        hud_assert_true(result8);
+        constexpr auto result17 = test(17);
+        hud_assert_true(result17);
+        constexpr auto result64 = test(64);
+        hud_assert_true(result64);
+    }
+}
+
+GTEST_TEST(hashset, find_with_hash_in_const_hashset_non_trivial_type)
+{
+    const auto test = [](usize max) {
+        using KeyType = hud_test::non_bitwise_type;
+        hud::hashset<KeyType> mutable_set;
+
+        for (u32 index = 0; index < max; index++) {
+            mutable_set.add(index);
+        }
+        const hud::hashset<KeyType> &set = mutable_set;
+
+        // Keys are not of key_type, the hash is computed once and reused for each search
+        bool is_find_ok = true;
+        for (i32 index = 0; index < static_cast<i32>(max * 2); index++) {
+            const u64 hash = set.hash_of(index);
+            const auto it = set.find_with_hash(index, hash);
+            if (it != set.find(index)) {
+                is_find_ok = false;
+            }
+            if (static_cast<u32>(index) < max && (it == set.end() || it->key().id() != index)) {
+                is_find_ok = false;
+            }
+        }
+        return is_find_ok;
+    };
+
+    // Non constant
+    {
+        const auto result = runtime_test(test, 1000);
+        hud_assert_true(result);
+    }
+
+    // Constant
+    {
+        constexpr auto result1 = test(1);
+        hud_assert_true(result1);
+        constexpr auto result17 = test(17);
+        hud_assert_true(result17);
+        constexpr auto result64 = test(64);
+        hud_assert_true(result64);
+    }
+}
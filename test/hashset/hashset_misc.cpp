@@ -1,5 +1,9 @@
 #include <core/containers/hashset.h>
 #include <core/traits/is_same.h>
+#if !defined(HD_TARGET_WASM_FAMILY)
+    #include <thread>
+    #include <vector>
+#endif
 
 GTEST_TEST(hashset, hashset_value_type_is_correct)
 {
@@ -83,7 +87,7 @@ GTEST_TEST(hashset, control_type_and_group_are_ok)
     }
 
 // Testing sse2_group
-#if defined(HD_SSE2)
+#if HD_SSE2
     {
         using group_type = hud::details::hashset::sse2_group;
         using mask_type = group_type::mask;
@@ -126,6 +130,61 @@ GTEST_TEST(hashset, control_type_and_group_are_ok)
         hud_assert_eq(g1.mask_of_full_slot(), mask_full_type {0b0110110000010001});
     }
 #endif
+
+// Testing avx2_group
+#if HD_AVX2
+    {
+        using group_type = hud::details::hashset::avx2_group;
+        using mask_type = group_type::mask;
+        using mask_empty_type = group_type::empty_mask;
+        using mask_empty_or_deleted_type = group_type::empty_or_deleted_mask;
+        using mask_full_type = group_type::full_mask;
+
+        // The slot is empty (0x80)
+        // The slot is deleted (0xFE)
+        // The slot is a sentinel (0xFF)
+        u128 group_value[2] = {
+            {0x80FEFF7F80FEFF7F, 0x80FEFF7F80FEFF7F},
+            {0x80FEFF7F80FEFF7F, 0x80FEFF7F80FEFF7F}
+        };
+        group_type g {reinterpret_cast<control_type *>(&group_value)};
+        hud_assert_eq(g.match(0x7F), mask_type {0x11111111});
+        hud_assert_eq(g.mask_of_empty_slot(), mask_empty_type {0x88888888});
+        hud_assert_eq(g.mask_of_empty_or_deleted_slot(), mask_empty_or_deleted_type {0xCCCCCCCC});
+        hud_assert_eq(g.mask_of_full_slot(), mask_full_type {0x11111111});
+        hud_assert_eq(g.count_leading_empty_or_deleted(), 0u);
+
+        // Test group at index
+        // empty (0x80), deleted (0xFE), sentinel (0xFF)
+        // The 16 low bits of masks are the first 16 bytes, the 16 high bits are the next 16 bytes
+        u128 four_group[4] = {
+            {0x80FEFF7F80FEFF7F, 0x7F00806DFE002A6D},
+            {0x807B00800000FEFF, 0x80FEFF7F80FEFF7F},
+            {0x8080808080808080, 0x8080808080808080},
+            {0x8080808080808080, 0x8080808080808080}
+        };
+        control_type *metadata_ptr(reinterpret_cast<control_type *>(&four_group));
+        group_type g0 {metadata_ptr};
+        hud_assert_eq(g0.match(0x7F), mask_type {0b0000000000010001'0001000110000000});
+        hud_assert_eq(g0.match(0x2A), mask_type {0b0000000000000000'0000000000000010});
+        hud_assert_eq(g0.match(0x6D), mask_type {0b0000000000000000'0000000000010001});
+        hud_assert_eq(g0.match(0x7B), mask_type {0b0100000000000000'0000000000000000});
+        hud_assert_eq(g0.mask_of_empty_or_deleted_slot(), mask_empty_or_deleted_type {0b1001001011001100'1100110000101000});
+        hud_assert_eq(g0.mask_of_empty_slot(), mask_empty_type {0b1001000010001000'1000100000100000});
+        hud_assert_eq(g0.mask_of_full_slot(), mask_full_type {0b0110110000010001'0001000111010111});
+
+        // Read the second 16 bytes and the next 16 empty bytes
+        group_type g1 {metadata_ptr + 16};
+        hud_assert_eq(g1.match(0x7B), mask_type {0b0000000000000000'0100000000000000});
+        hud_assert_eq(g1.mask_of_empty_or_deleted_slot(), mask_empty_or_deleted_type {0b1111111111111111'1001001011001100});
+        hud_assert_eq(g1.mask_of_empty_slot(), mask_empty_type {0b1111111111111111'1001000010001000});
+        hud_assert_eq(g1.mask_of_full_slot(), mask_full_type {0b0000000000000000'0110110000010001});
+
+        // Count leading empty or deleted slots
+        hud_assert_eq(group_type {metadata_ptr + 30}.count_leading_empty_or_deleted(), 0u);
+        hud_assert_eq(group_type {metadata_ptr + 31}.count_leading_empty_or_deleted(), 32u);
+    }
+#endif
 }
 
 GTEST_TEST(hashset, count_return_count_of_element)
@@ -175,6 +234,123 @@ GTEST_TEST(hashset, count_return_count_of_element)
     }
 }
 
+/** Hasher that makes every key start probing at the same slot. H2 is the key so keys stay distinguishable. */
+template<u64 start_slot>
+struct start_slot_hasher
+{
+    constexpr u64 operator()(const usize key) const noexcept
+    {
+        return (start_slot << 7) | (key & 0x7F);
+    }
+};
+
+GTEST_TEST(hashset, probing_wrap_around_the_end_of_the_table)
+{
+    // Every key starts at slot 62, the last slot of a table of 63 slots
+    // Probing wraps around the end of the table through the cloned control bytes
+    const auto test = []()
+    {
+        hud::hashset<usize, start_slot_hasher<62>> set;
+        set.reserve(40);
+        const usize max_count = set.max_count();
+
+        constexpr usize COUNT = 40;
+        for (usize value = 0; value < COUNT; value++)
+        {
+            set.add(value);
+        }
+
+        bool all_found = true;
+        for (usize value = 0; value < COUNT; value++)
+        {
+            if (!set.contains(value))
+            {
+                all_found = false;
+            }
+        }
+
+        usize iterated_count = 0;
+        for (const auto &element : set)
+        {
+            if (element.key() < COUNT)
+            {
+                iterated_count++;
+            }
+        }
+        return std::tuple {
+            max_count == 63,
+            set.max_count() == max_count,
+            set.count() == COUNT,
+            all_found,
+            iterated_count == COUNT
+        };
+    };
+
+    // Non constant
+    {
+        const auto result = test();
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_true(std::get<2>(result));
+        hud_assert_true(std::get<3>(result));
+        hud_assert_true(std::get<4>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test();
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_true(std::get<2>(result));
+        hud_assert_true(std::get<3>(result));
+        hud_assert_true(std::get<4>(result));
+    }
+}
+
+GTEST_TEST(hashset, iterate_when_first_group_is_empty)
+{
+    // Every key starts at slot 40, the first groups of the table stay empty
+    const auto test = []()
+    {
+        hud::hashset<usize, start_slot_hasher<40>> set;
+        set.reserve(40);
+
+        constexpr usize COUNT = 10;
+        for (usize value = 0; value < COUNT; value++)
+        {
+            set.add(value);
+        }
+
+        bool begin_is_full = set.begin() != set.end() && set.begin()->key() < COUNT;
+        usize iterated_count = 0;
+        for (const auto &element : set)
+        {
+            if (element.key() < COUNT)
+            {
+                iterated_count++;
+            }
+        }
+        return std::tuple {
+            begin_is_full,
+            iterated_count == COUNT
+        };
+    };
+
+    // Non constant
+    {
+        const auto result = test();
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test();
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+    }
+}
+
 GTEST_TEST(hashset, sizeof_map_is_correct)
 {
     // Size of hashmap do not depends of the key and value types
@@ -185,9 +361,304 @@ GTEST_TEST(hashset, sizeof_map_is_correct)
     constexpr usize control_ptr_size = sizeof(void *);
     constexpr usize slot_ptr_size = sizeof(void *);
     constexpr usize count_size = sizeof(usize);
+    constexpr usize deleted_count_size = sizeof(usize);
     constexpr usize max_count_size = sizeof(usize);
     constexpr usize free_slot_before_grow_size = sizeof(usize);
+#if defined(HD_HASHSET_INSTRUMENTATION)
+    constexpr usize probe_counters_size = 2 * sizeof(u64);
+#else
+    constexpr usize probe_counters_size = 0;
+#endif
 
     constexpr usize sizeof_map = sizeof(hud::hashset<i32>);
-    hud_assert_true(sizeof_map == control_ptr_size + slot_ptr_size + count_size + max_count_size + free_slot_before_grow_size);
+    hud_assert_true(sizeof_map == control_ptr_size + slot_ptr_size + count_size + deleted_count_size + max_count_size + free_slot_before_grow_size + probe_counters_size);
+}
+
+GTEST_TEST(hashset, stats_of_empty_hashset)
+{
+    const auto test = []()
+    {
+        hud::hashset<usize> set;
+        const auto stats = set.stats();
+        const auto probe_stats = set.probe_stats();
+        usize histogram_sum = 0;
+        for (usize count : probe_stats.probe_length_histogram)
+        {
+            histogram_sum += count;
+        }
+        return std::tuple {
+            stats.count == 0,
+            stats.max_count == 0,
+            stats.deleted_count == 0,
+            stats.load_factor == 0.0f,
+            stats.allocation_size == 0,
+            probe_stats.max_probe_length == 0,
+            probe_stats.average_probe_length == 0.0f,
+            histogram_sum == 0
+        };
+    };
+
+    // Non constant
+    {
+        const auto result = test();
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_true(std::get<2>(result));
+        hud_assert_true(std::get<3>(result));
+        hud_assert_true(std::get<4>(result));
+        hud_assert_true(std::get<5>(result));
+        hud_assert_true(std::get<6>(result));
+        hud_assert_true(std::get<7>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test();
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_true(std::get<2>(result));
+        hud_assert_true(std::get<3>(result));
+        hud_assert_true(std::get<4>(result));
+        hud_assert_true(std::get<5>(result));
+        hud_assert_true(std::get<6>(result));
+        hud_assert_true(std::get<7>(result));
+    }
 }
+
+GTEST_TEST(hashset, stats_report_probe_lengths)
+{
+    // Every key starts at slot 0, keys are packed from the slot 0 in insertion order
+    // The key at slot i is found after scanning i / SLOT_PER_GROUP + 1 groups
+    const auto test = []()
+    {
+        using probe_stats_type = hud::hashset<usize, start_slot_hasher<0>>::probe_stats_type;
+        hud::hashset<usize, start_slot_hasher<0>> set;
+        set.reserve(40);
+
+        constexpr usize COUNT = 40;
+        for (usize value = 0; value < COUNT; value++)
+        {
+            set.add(value);
+        }
+        // Not const, a const initialization would be constant evaluated and return the portable group size
+        usize slot_per_group = hud::details::hashset::SLOT_PER_GROUP();
+        const auto stats = set.stats();
+        const auto probe_stats = set.probe_stats();
+
+        usize expected_histogram[probe_stats_type::PROBE_LENGTH_HISTOGRAM_SIZE] {};
+        usize expected_probe_length_sum = 0;
+        for (usize slot_index = 0; slot_index < COUNT; slot_index++)
+        {
+            expected_histogram[hud::math::min(slot_index / slot_per_group, probe_stats_type::PROBE_LENGTH_HISTOGRAM_SIZE - 1)]++;
+            expected_probe_length_sum += slot_index / slot_per_group + 1;
+        }
+        bool is_histogram_ok = true;
+        for (usize index = 0; index < probe_stats_type::PROBE_LENGTH_HISTOGRAM_SIZE; index++)
+        {
+            is_histogram_ok &= probe_stats.probe_length_histogram[index] == expected_histogram[index];
+        }
+
+        // Removing keys in the middle of the full groups leaves deleted slots
+        set.remove(usize {1});
+        set.remove(usize {2});
+        const auto stats_after_remove = set.stats();
+
+        return std::tuple {
+            stats.count == COUNT,
+            stats.max_count == 63,
+            stats.deleted_count == 0,
+            stats.load_factor == static_cast<f32>(COUNT) / 63.0f,
+            stats.allocation_size >= 63 * (sizeof(usize) + 1),
+            probe_stats.max_probe_length == (COUNT - 1) / slot_per_group + 1,
+            probe_stats.average_probe_length == static_cast<f32>(expected_probe_length_sum) / static_cast<f32>(COUNT),
+            is_histogram_ok,
+            stats_after_remove.count == COUNT - 2,
+            stats_after_remove.deleted_count == set.deleted_count(),
+            stats_after_remove.used_load_factor == static_cast<f32>(COUNT - 2 + set.deleted_count()) / 63.0f,
+            stats_after_remove.allocation_size == stats.allocation_size
+        };
+    };
+
+    // Non constant
+    {
+        const auto result = test();
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_true(std::get<2>(result));
+        hud_assert_true(std::get<3>(result));
+        hud_assert_true(std::get<4>(result));
+        hud_assert_true(std::get<5>(result));
+        hud_assert_true(std::get<6>(result));
+        hud_assert_true(std::get<7>(result));
+        hud_assert_true(std::get<8>(result));
+        hud_assert_true(std::get<9>(result));
+        hud_assert_true(std::get<10>(result));
+        hud_assert_true(std::get<11>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test();
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_true(std::get<2>(result));
+        hud_assert_true(std::get<3>(result));
+        hud_assert_true(std::get<4>(result));
+        hud_assert_true(std::get<5>(result));
+        hud_assert_true(std::get<6>(result));
+        hud_assert_true(std::get<7>(result));
+        hud_assert_true(std::get<8>(result));
+        hud_assert_true(std::get<9>(result));
+        hud_assert_true(std::get<10>(result));
+        hud_assert_true(std::get<11>(result));
+    }
+}
+
+GTEST_TEST(hashset, deleted_count_is_maintained_by_every_operation)
+{
+    // Every key starts at slot 0, keys are packed from the slot 0 in insertion order
+    // Removing keys at slots 20 and 21 leaves deleted slots, the groups around them are full
+    const auto test = []()
+    {
+        using set_type = hud::hashset<usize, start_slot_hasher<0>>;
+        set_type set;
+        set.reserve(40);
+        for (usize value = 0; value < 40; value++)
+        {
+            set.add(value);
+        }
+        set.remove(usize {20});
+        set.remove(usize {21});
+        const usize after_remove = set.deleted_count();
+
+        // The insertion reuses the first deleted slot of the probing sequence
+        set.add(usize {100});
+        const usize after_reuse = set.deleted_count();
+
+        // Copy and move keep the deleted slots only if the controls are copied as is
+        set_type copy {set};
+        const usize after_copy = copy.deleted_count();
+        set_type moved {hud::move(copy)};
+        const usize after_move = moved.deleted_count();
+        const usize moved_from = copy.deleted_count();
+
+        // Assignment reinserts the elements
+        set_type assigned;
+        assigned = set;
+        const usize after_assign = assigned.deleted_count();
+
+        hud::swap(set, assigned);
+        const bool is_swap_ok = set.deleted_count() == 0 && assigned.deleted_count() == after_reuse;
+
+        assigned.clear();
+        const usize after_clear = assigned.deleted_count();
+
+        // Keys 23 and 24 are at slots 22 and 23 after the reinsertion
+        set.remove(usize {23});
+        set.remove(usize {24});
+        const usize before_rehash = set.deleted_count();
+        set.reserve(200);
+        const usize after_rehash = set.deleted_count();
+
+        return std::tuple {after_remove, after_reuse, after_copy, after_move, moved_from, after_assign, is_swap_ok, after_clear, before_rehash, after_rehash, set.stats().deleted_count == set.deleted_count()};
+    };
+
+    // Non constant
+    {
+        const auto result = runtime_test(test);
+        hud_assert_eq(std::get<0>(result), 2u);
+        hud_assert_eq(std::get<1>(result), 1u);
+        // Controls of bitwise copyable slots are copied as is, slots that are not bitwise movable are reinserted
+        hud_assert_eq(std::get<2>(result), 1u);
+        hud_assert_eq(std::get<3>(result), 0u);
+        hud_assert_eq(std::get<4>(result), 0u);
+        hud_assert_eq(std::get<5>(result), 0u);
+        hud_assert_true(std::get<6>(result));
+        hud_assert_eq(std::get<7>(result), 0u);
+        hud_assert_eq(std::get<8>(result), 2u);
+        hud_assert_eq(std::get<9>(result), 0u);
+        hud_assert_true(std::get<10>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test();
+        hud_assert_eq(std::get<0>(result), 2u);
+        hud_assert_eq(std::get<1>(result), 1u);
+        // Elements are reinserted in a constant-evaluated context
+        hud_assert_eq(std::get<2>(result), 0u);
+        hud_assert_eq(std::get<3>(result), 0u);
+        hud_assert_eq(std::get<4>(result), 0u);
+        hud_assert_eq(std::get<5>(result), 0u);
+        hud_assert_true(std::get<6>(result));
+        hud_assert_eq(std::get<7>(result), 0u);
+        hud_assert_eq(std::get<8>(result), 2u);
+        hud_assert_eq(std::get<9>(result), 0u);
+        hud_assert_true(std::get<10>(result));
+    }
+}
+
+GTEST_TEST(hashset, probe_counters_count_lookups_and_insertions)
+{
+    hud::hashset<usize> set;
+    for (usize value = 0; value < 100; value++)
+    {
+        set.add(value);
+    }
+    set.reset_probe_counters();
+    for (usize value = 0; value < 200; value++)
+    {
+        (void)set.contains(value);
+    }
+    const auto stats = set.stats();
+#if defined(HD_HASHSET_INSTRUMENTATION)
+    hud_assert_eq(stats.probe_operation_count, 200u);
+    hud_assert_ge(stats.probe_group_count, 200u);
+#else
+    hud_assert_eq(stats.probe_operation_count, 0u);
+    hud_assert_eq(stats.probe_group_count, 0u);
+#endif
+    set.reset_probe_counters();
+    hud_assert_eq(set.stats().probe_operation_count, 0u);
+}
+
+#if !defined(HD_TARGET_WASM_FAMILY)
+GTEST_TEST(hashset, probe_counters_count_concurrent_const_lookups)
+{
+    constexpr usize THREAD_COUNT = 4;
+    constexpr usize LOOKUP_PER_THREAD = 10000;
+    hud::hashset<usize> set;
+    for (usize value = 0; value < 100; value++)
+    {
+        set.add(value);
+    }
+    set.reset_probe_counters();
+
+    // Const lookups can run concurrently, the probe counters must not lose any of them
+    const hud::hashset<usize> &const_set = set;
+    std::vector<std::thread> threads;
+    for (usize thread_index = 0; thread_index < THREAD_COUNT; thread_index++)
+    {
+        threads.emplace_back([&]()
+                             {
+                                 for (usize lookup_index = 0; lookup_index < LOOKUP_PER_THREAD; lookup_index++)
+                                 {
+                                     (void)const_set.contains(lookup_index % 200);
+                                 }
+                             });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto stats = set.stats();
+#if defined(HD_HASHSET_INSTRUMENTATION)
+    hud_assert_eq(stats.probe_operation_count, THREAD_COUNT * LOOKUP_PER_THREAD);
+    hud_assert_ge(stats.probe_group_count, THREAD_COUNT * LOOKUP_PER_THREAD);
+#else
+    hud_assert_eq(stats.probe_operation_count, 0u);
+    hud_assert_eq(stats.probe_group_count, 0u);
+#endif
+}
+#endif
@@ -0,0 +1,178 @@
+#include <core/containers/hashset.h>
+
+namespace hud_test
+{
+    template<typename policy_t>
+    using policy_hashset = hud::hashset<usize, hud::hash_64<usize>, hud::equal<usize>, hud::heap_allocator, policy_t>;
+
+    /** Adds `count` keys one by one and checks that the max load factor of `policy_t` is never exceeded. */
+    template<typename policy_t>
+    constexpr std::tuple<bool, bool, usize> add_and_check_load(usize count)
+    {
+        policy_hashset<policy_t> set;
+        bool is_load_ok = true;
+        for (usize value = 0; value < count; value++)
+        {
+            set.add(value);
+            // count / max_count <= numerator / denominator, one more slot is allowed by the rounding
+            is_load_ok &= set.count() * policy_t::MAX_LOAD_FACTOR_DENOMINATOR <= (set.max_count() + 1) * policy_t::MAX_LOAD_FACTOR_NUMERATOR;
+        }
+        bool is_find_ok = true;
+        for (usize value = 0; value < count * 2; value++)
+        {
+            is_find_ok &= set.contains(value) == (value < count);
+        }
+        return {is_load_ok, is_find_ok, set.max_count()};
+    }
+} // namespace hud_test
+
+GTEST_TEST(hashset, default_policy_is_7_8_and_doubles)
+{
+    hud_assert_true((hud::is_same_v<hud::hashset<usize>, hud_test::policy_hashset<hud::default_hashset_policy>>));
+    hud_assert_eq(hud::default_hashset_policy::MAX_LOAD_FACTOR_NUMERATOR, 7u);
+    hud_assert_eq(hud::default_hashset_policy::MAX_LOAD_FACTOR_DENOMINATOR, 8u);
+    hud_assert_eq(hud::default_hashset_policy::GROWTH_FACTOR, 2u);
+
+    hud::hashset<usize> set;
+    usize previous_max_count = set.max_count();
+    for (usize value = 0; value < 1000; value++)
+    {
+        set.add(value);
+        if (set.max_count() != previous_max_count)
+        {
+            hud_assert_eq(set.max_count(), previous_max_count * 2 + 1);
+            previous_max_count = set.max_count();
+        }
+    }
+}
+
+GTEST_TEST(hashset, reserve_depends_on_max_load_factor)
+{
+    const auto test = []()
+    {
+        hud_test::policy_hashset<hud::default_hashset_policy> default_set;
+        default_set.reserve(900);
+        hud_test::policy_hashset<hud::dense_hashset_policy> dense_set;
+        dense_set.reserve(900);
+        hud_test::policy_hashset<hud::sparse_hashset_policy> sparse_set;
+        sparse_set.reserve(900);
+        return std::tuple {
+            default_set.max_count(),
+            default_set.slack(),
+            dense_set.max_count(),
+            dense_set.slack(),
+            sparse_set.max_count(),
+            sparse_set.slack()
+        };
+    };
+
+    // Non constant
+    {
+        const auto result = test();
+        // 900 elements need 1028 slots at 7/8, 999 slots at 9/10 and 1799 slots at 1/2
+        hud_assert_eq(std::get<0>(result), 2047u);
+        hud_assert_eq(std::get<1>(result), 1792u);
+        hud_assert_eq(std::get<2>(result), 1023u);
+        hud_assert_eq(std::get<3>(result), 921u);
+        hud_assert_eq(std::get<4>(result), 2047u);
+        hud_assert_eq(std::get<5>(result), 1024u);
+    }
+
+    // Constant
+    {
+        constexpr auto result = test();
+        hud_assert_eq(std::get<0>(result), 2047u);
+        hud_assert_eq(std::get<1>(result), 1792u);
+        hud_assert_eq(std::get<2>(result), 1023u);
+        hud_assert_eq(std::get<3>(result), 921u);
+        hud_assert_eq(std::get<4>(result), 2047u);
+        hud_assert_eq(std::get<5>(result), 1024u);
+    }
+}
+
+GTEST_TEST(hashset, add_respect_max_load_factor)
+{
+    // Non constant
+    {
+        const auto dense = hud_test::add_and_check_load<hud::dense_hashset_policy>(1000);
+        hud_assert_true(std::get<0>(dense));
+        hud_assert_true(std::get<1>(dense));
+        hud_assert_eq(std::get<2>(dense), 2047u);
+
+        const auto sparse = hud_test::add_and_check_load<hud::sparse_hashset_policy>(1000);
+        hud_assert_true(std::get<0>(sparse));
+        hud_assert_true(std::get<1>(sparse));
+        hud_assert_eq(std::get<2>(sparse), 2047u);
+
+        // 15/16 is the highest max load factor, one slot stays empty in tables of one group
+        const auto densest = hud_test::add_and_check_load<hud::hashset_policy<15u, 16u>>(1000);
+        hud_assert_true(std::get<0>(densest));
+        hud_assert_true(std::get<1>(densest));
+        hud_assert_eq(std::get<2>(densest), 2047u);
+    }
+
+    // Constant
+    {
+        constexpr auto dense = hud_test::add_and_check_load<hud::dense_hashset_policy>(100);
+        hud_assert_true(std::get<0>(dense));
+        hud_assert_true(std::get<1>(dense));
+        hud_assert_eq(std::get<2>(dense), 127u);
+
+        constexpr auto sparse = hud_test::add_and_check_load<hud::sparse_hashset_policy>(100);
+        hud_assert_true(std::get<0>(sparse));
+        hud_assert_true(std::get<1>(sparse));
+        hud_assert_eq(std::get<2>(sparse), 255u);
+
+        constexpr auto densest = hud_test::add_and_check_load<hud::hashset_policy<15u, 16u>>(100);
+        hud_assert_true(std::get<0>(densest));
+        hud_assert_true(std::get<1>(densest));
+        hud_assert_eq(std::get<2>(densest), 127u);
+    }
+}
+
+GTEST_TEST(hashset, growth_factor_multiply_slot_count)
+{
+    const auto test = [](usize count)
+    {
+        hud_test::policy_hashset<hud::hashset_policy<7u, 8u, 4u>> set;
+        usize previous_max_count = set.max_count();
+        bool is_growth_ok = true;
+        usize grow_count = 0;
+        for (usize value = 0; value < count; value++)
+        {
+            set.add(value);
+            if (set.max_count() != previous_max_count)
+            {
+                is_growth_ok &= set.max_count() == (previous_max_count + 1) * 4 - 1;
+                previous_max_count = set.max_count();
+                grow_count++;
+            }
+        }
+        bool is_find_ok = true;
+        for (usize value = 0; value < count; value++)
+        {
+            is_find_ok &= set.contains(value);
+        }
+        return std::tuple {is_growth_ok, is_find_ok, grow_count, set.max_count()};
+    };
+
+    // Non constant
+    {
+        const auto result = test(1000);
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        // 3, 15, 63, 255, 1023, 4095
+        hud_assert_eq(std::get<2>(result), 6u);
+        hud_assert_eq(std::get<3>(result), 4095u);
+    }
+
+    // Constant
+    {
+        // 3, 15, 63, 255
+        constexpr auto result = test(200);
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_eq(std::get<2>(result), 4u);
+        hud_assert_eq(std::get<3>(result), 255u);
+    }
+}
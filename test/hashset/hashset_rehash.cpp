@@ -391,4 +391,95 @@ GTEST_TEST(hashset, rehash_greater_than_count_do_nothing)
         constexpr auto result = test();
         hud_assert_true(result);
     }
-}
\ No newline at end of file
+}
+
+namespace hud_test
+{
+    /** Hash every key to the slot 0, all keys share the same probing sequence. */
+    struct same_slot_hasher
+    {
+        [[nodiscard]] constexpr u64 operator()(const usize key) const noexcept
+        {
+            return key & 0x7F;
+        }
+    };
+} // namespace hud_test
+
+GTEST_TEST(hashset, drop_deleted_slots_instead_of_growing)
+{
+    // Keys are packed from the slot 0, removing a key in the middle leaves a deleted slot
+    // Each remove followed by an add consume a free slot, reaching the load factor with deleted slots only
+    const auto test = []()
+    {
+        hud::hashset<usize, hud_test::same_slot_hasher> set;
+        set.reserve(40);
+        const usize max_count = set.max_count();
+
+        constexpr usize COUNT = 40;
+        for (usize value = 0; value < COUNT; value++)
+        {
+            set.add(value);
+        }
+        bool had_deleted = false;
+        for (usize value = 0; value < 200; value++)
+        {
+            set.remove(value);
+            had_deleted |= set.deleted_count() > 0;
+            set.add(value + COUNT);
+        }
+
+        bool all_found = set.count() == COUNT;
+        for (usize value = 200; value < 200 + COUNT; value++)
+        {
+            all_found &= set.contains(value);
+        }
+        for (usize value = 0; value < 200; value++)
+        {
+            all_found &= !set.contains(value);
+        }
+        return std::tuple {all_found, had_deleted, max_count, set.max_count(), set.deleted_count() < set.max_count() - COUNT};
+    };
+
+    // Non constant
+    {
+        const auto result = runtime_test(test);
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        // Deleted slots are dropped in place, the table never grows
+        hud_assert_eq(std::get<2>(result), std::get<3>(result));
+        hud_assert_true(std::get<4>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test();
+        hud_assert_true(std::get<0>(result));
+        hud_assert_true(std::get<1>(result));
+        hud_assert_true(std::get<4>(result));
+    }
+}
+
+GTEST_TEST(hashset, drop_deleted_slots_non_trivial_type)
+{
+    // Elements are swapped and moved within the buffer when deleted slots are dropped
+    hud::hashset<hud_test::non_bitwise_type> set;
+    set.reserve(90);
+    const usize max_count = set.max_count();
+    for (i32 value = 0; value < 90; value++)
+    {
+        set.add(value);
+    }
+    for (i32 value = 0; value < 2000; value++)
+    {
+        set.remove(value);
+        set.add(value + 90);
+    }
+    hud_assert_eq(set.count(), 90u);
+    hud_assert_eq(set.max_count(), max_count);
+    for (i32 value = 2000; value < 2090; value++)
+    {
+        const auto it = set.find(value);
+        hud_assert_ne(it, set.end());
+        hud_assert_eq(it->key().id(), value);
+    }
+}
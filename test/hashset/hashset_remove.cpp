@@ -311,4 +311,47 @@ GTEST_TEST(hashset, remove_collided_key)
         constexpr auto result_10 = test(10);
         hud_assert_true(std::get<0>(result_10));
     }
-}
\ No newline at end of file
+}
+
+GTEST_TEST(hashset, remove_with_hash_trivial_type)
+{
+    const auto test = [](usize max) {
+        using KeyType = usize;
+        hud::hashset<KeyType> set;
+
+        for (u32 index = 0; index < max; index++) {
+            set.add(index);
+        }
+
+        // Remove even keys and keys that not exists
+        for (u32 index = 0; index < max * 2; index += 2) {
+            set.remove_with_hash(index, set.hash_of(index));
+        }
+
+        bool is_remove_ok = set.count() == max / 2;
+        for (u32 index = 0; index < max; index++) {
+            if (set.contains(index) != (index % 2 == 1)) {
+                is_remove_ok = false;
+            }
+        }
+        return is_remove_ok;
+    };
+
+    // Non constant
+    {
+        const auto result = runtime_test(test, 32767);
+        hud_assert_true(result);
+    }
+
+    // Constant
+    {
+        constexpr auto result1 = test(1);
+        hud_assert_true(result1);
+        constexpr auto result8 = test(8);
+        hud_assert_true(result8);
+        constexpr auto result17 = test(17);
+        hud_assert_true(result17);
+        constexpr auto result64 = test(64);
+        hud_assert_true(result64);
+    }
+}
@@ -1,5 +1,9 @@
 #include <core/containers/hashset.h>
 #include "../misc/allocator_watcher.h"
+#if !defined(HD_TARGET_WASM_FAMILY)
+    #include <thread>
+    #include <vector>
+#endif
 
 GTEST_TEST(hashset, reserve_empty_to_zero_do_nothing)
 {
@@ -205,4 +209,110 @@ GTEST_TEST(hashset, reserve_less_than_count_but_more_than_count_do_nothing)
         constexpr auto result = test();
         hud_assert_true(result);
     }
-}
\ No newline at end of file
+}
+
+GTEST_TEST(hashset, reserve_parallel_below_min_parallel_count_do_not_call_executor)
+{
+    hud::hashset<usize> set;
+    for (usize value = 0; value < 100; value++)
+    {
+        set.add(value);
+    }
+    usize executor_call_count = 0;
+    set.reserve_parallel(1000, [&executor_call_count](usize, auto &&) { executor_call_count++; });
+    hud_assert_eq(executor_call_count, 0u);
+    hud_assert_eq(set.count(), 100u);
+    hud_assert_eq(set.max_count(), 2047u);
+    for (usize value = 0; value < 100; value++)
+    {
+        hud_assert_true(set.contains(value));
+    }
+}
+
+GTEST_TEST(hashset, reserve_parallel_relocate_each_range_once)
+{
+    hud::hashset<usize> set;
+    for (usize value = 0; value < 20000; value++)
+    {
+        set.add(value);
+    }
+    const usize old_slot_count = set.max_count() + 1;
+
+    // Run the tasks in reverse order to relocate ranges in a different order than a serial resize
+    usize executor_task_count = 0;
+    set.reserve_parallel(100000, [&executor_task_count](usize task_count, auto &&task)
+                         {
+                             executor_task_count = task_count;
+                             for (usize task_index = task_count; task_index > 0; task_index--)
+                             {
+                                 task(task_index - 1);
+                             }
+                         },
+                         1);
+    hud_assert_eq(executor_task_count, old_slot_count / hud::hashset<usize>::PARALLEL_RESIZE_SLOT_PER_TASK);
+    hud_assert_eq(set.count(), 20000u);
+    hud_assert_eq(set.max_count(), 131071u);
+
+    bool is_find_ok = true;
+    for (usize value = 0; value < 40000; value++)
+    {
+        is_find_ok &= set.contains(value) == (value < 20000);
+    }
+    hud_assert_true(is_find_ok);
+    usize iterated_count = 0;
+    for ([[maybe_unused]] const auto &element : set)
+    {
+        iterated_count++;
+    }
+    hud_assert_eq(iterated_count, 20000u);
+
+    // The table is still usable after a parallel resize
+    set.remove(usize {10});
+    hud_assert_false(set.contains(10));
+    set.add(usize {50000});
+    hud_assert_true(set.contains(50000));
+}
+
+#if !defined(HD_TARGET_WASM_FAMILY)
+GTEST_TEST(hashset, reserve_parallel_with_threads)
+{
+    constexpr usize THREAD_COUNT = 4;
+    constexpr usize ELEMENT_COUNT = 70000;
+    hud::hashset<usize> set;
+    for (usize value = 0; value < ELEMENT_COUNT; value++)
+    {
+        set.add(value);
+    }
+
+    // Each thread takes the next task until all tasks are done
+    auto thread_executor = [](usize task_count, auto &&task)
+    {
+        hud::atomic<usize> next_task_index {0};
+        std::vector<std::thread> threads;
+        for (usize thread_index = 0; thread_index < THREAD_COUNT; thread_index++)
+        {
+            threads.emplace_back([&]()
+                                 {
+                                     for (usize task_index = next_task_index.fetch_add(1); task_index < task_count; task_index = next_task_index.fetch_add(1))
+                                     {
+                                         task(task_index);
+                                     }
+                                 });
+        }
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+    };
+    set.reserve_parallel(ELEMENT_COUNT * 4, thread_executor);
+    hud_assert_eq(set.count(), ELEMENT_COUNT);
+    hud_assert_eq(set.max_count(), 524287u);
+
+    bool is_find_ok = true;
+    for (usize value = 0; value < ELEMENT_COUNT * 2; value++)
+    {
+        is_find_ok &= set.contains(value) == (value < ELEMENT_COUNT);
+    }
+    hud_assert_true(is_find_ok);
+}
+#endif
@@ -159,8 +159,8 @@ GTEST_TEST(memory, reallocate_align)
 
         // Reallocate a sizeof(a) to 2*sizeof(a)
         a *ptr_2 = reinterpret_cast<a *>(hud::memory::reallocate_align(ptr, sizeof(a) * 2, alignment));
+        // The block can be extended in place, ptr_2 can be equal to ptr
         hud_assert_ne(ptr_2, nullptr);
-        hud_assert_ne(ptr, ptr_2);
         hud_assert_true(hud::memory::is_pointer_aligned(ptr_2, alignment));
         (ptr_2 + 1)->i = 2u;
         hud_assert_eq(ptr_2->i, 1u);
@@ -168,8 +168,8 @@ GTEST_TEST(memory, reallocate_align)
 
         // Reallocate a 2*sizeof(a) to sizeof(a)
         a *ptr_3 = reinterpret_cast<a *>(hud::memory::reallocate_align(ptr_2, sizeof(a), alignment));
+        // The block can be shrunk in place, ptr_3 can be equal to ptr_2
         hud_assert_ne(ptr_3, nullptr);
-        hud_assert_ne(ptr_2, ptr_3);
         hud_assert_true(hud::memory::is_pointer_aligned(ptr_3, alignment));
         hud_assert_eq(ptr_3->i, 1u);
 
@@ -184,4 +184,36 @@ GTEST_TEST(memory, reallocate_align)
         hud_assert_eq(hud::memory::reallocate_align(ptr_4, 0, alignment), nullptr);
         guard.leak();
     }
-}
\ No newline at end of file
+}
+
+GTEST_TEST(memory, reallocate_align_keep_content_of_big_block)
+{
+    for (u32 alignment = 1; alignment <= 256; alignment <<= 1)
+    {
+        usize count = 16;
+        u32 *ptr = reinterpret_cast<u32 *>(hud::memory::reallocate_align(nullptr, count * sizeof(u32), alignment));
+        hud_assert_ne(ptr, nullptr);
+        for (usize index = 0; index < count; index++)
+        {
+            ptr[index] = static_cast<u32>(index);
+        }
+
+        // Grow up to 4MB to go through the different allocation strategies of the system
+        while (count < 1024 * 1024)
+        {
+            count *= 2;
+            ptr = reinterpret_cast<u32 *>(hud::memory::reallocate_align(ptr, count * sizeof(u32), alignment));
+            hud_assert_ne(ptr, nullptr);
+            hud_assert_true(hud::memory::is_pointer_aligned(ptr, alignment));
+            for (usize index = 0; index < count / 2; index++)
+            {
+                hud_assert_eq(ptr[index], static_cast<u32>(index));
+            }
+            for (usize index = count / 2; index < count; index++)
+            {
+                ptr[index] = static_cast<u32>(index);
+            }
+        }
+        hud::memory::free_align(ptr);
+    }
+}
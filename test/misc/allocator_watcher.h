@@ -133,6 +133,9 @@ namespace hud
         using copy_when_container_copy_assigned = hud::false_type;
         using move_when_container_move_assigned = hud::false_type;
         using swap_when_container_swap = hud::false_type;
+        using can_reallocate = hud::false_type;
+        // Grow exactly to keep allocation count predictable in tests
+        using growth_policy = hud::exact_growth_policy;
     };
 
     template<u32 alignment>
@@ -142,6 +145,9 @@ namespace hud
         using copy_when_container_copy_assigned = hud::false_type;
         using move_when_container_move_assigned = hud::false_type;
         using swap_when_container_swap = hud::false_type;
+        using can_reallocate = hud::false_type;
+        // Grow exactly to keep allocation count predictable in tests
+        using growth_policy = hud::exact_growth_policy;
     };
 } // namespace hud
 
@@ -0,0 +1,170 @@
+#include <core/containers/read_mostly_hashmap.h>
+#if !defined(HD_TARGET_WASM_FAMILY)
+    #include <thread>
+    #include <vector>
+#endif
+
+GTEST_TEST(read_mostly_hashmap, find_in_empty_map)
+{
+    hud::read_mostly_hashmap<usize, usize> map;
+    auto reader = map.register_reader();
+    hud_assert_true(reader.is_valid());
+    hud_assert_false(reader.find(1).has_value());
+    hud_assert_false(reader.contains(1));
+}
+
+GTEST_TEST(read_mostly_hashmap, add_remove_update)
+{
+    hud::read_mostly_hashmap<usize, usize> map;
+    auto reader = map.register_reader();
+
+    for (usize index = 0; index < 100; index++)
+    {
+        hud_assert_true(map.add(index, index * 2));
+    }
+    hud_assert_false(map.add(usize {10}, usize {0}));
+    for (usize index = 0; index < 200; index++)
+    {
+        const hud::optional<usize> value = reader.find(index);
+        hud_assert_eq(value.has_value(), index < 100);
+        if (value.has_value())
+        {
+            hud_assert_eq(value.value(), index * 2);
+        }
+    }
+
+    hud_assert_true(map.remove(usize {10}));
+    hud_assert_false(map.remove(usize {10}));
+    hud_assert_false(reader.contains(10));
+
+    // Several modifications are published at once
+    map.update([](auto &version) {
+        for (auto &element : version)
+        {
+            element.value() = 0;
+        }
+        version.add(usize {1000}, usize {1});
+    });
+    const usize sum = reader.read([](const auto &version) {
+        usize sum = 0;
+        for (const auto &element : version)
+        {
+            sum += element.value();
+        }
+        return sum;
+    });
+    hud_assert_eq(sum, 1u);
+    hud_assert_eq(reader.read([](const auto &version) { return version.count(); }), 100u);
+
+    // No reader was reading while writing, every replaced version is freed
+    hud_assert_eq(map.retired_count(), 0u);
+}
+
+GTEST_TEST(read_mostly_hashmap, reader_keeps_its_version_alive)
+{
+    hud::read_mostly_hashmap<usize, usize> map;
+    map.add(usize {1}, usize {1});
+    auto reader = map.register_reader();
+
+    const bool is_version_unchanged = reader.read([&map](const auto &version) {
+        // Write while the reader reads: the version read is not modified nor freed
+        map.add(usize {2}, usize {2});
+        map.remove(usize {1});
+        return version.count() == 1 && version.contains(1) && !version.contains(2) && map.retired_count() == 2;
+    });
+    hud_assert_true(is_version_unchanged);
+
+    // The reader does not read anymore
+    hud_assert_eq(map.retired_count(), 2u);
+    map.reclaim();
+    hud_assert_eq(map.retired_count(), 0u);
+    hud_assert_false(reader.contains(1));
+    hud_assert_true(reader.contains(2));
+}
+
+GTEST_TEST(read_mostly_hashmap, register_reader_up_to_max_reader_count)
+{
+    hud::read_mostly_hashmap<usize, usize, hud::hash_64<usize>, hud::equal<usize>, hud::heap_allocator, 2> map;
+    auto reader_1 = map.register_reader();
+    {
+        auto reader_2 = map.register_reader();
+        hud_assert_true(reader_1.is_valid());
+        hud_assert_true(reader_2.is_valid());
+        auto reader_3 = map.register_reader();
+        hud_assert_false(reader_3.is_valid());
+    }
+    // The slot of reader_2 is released
+    auto reader_4 = map.register_reader();
+    hud_assert_true(reader_4.is_valid());
+
+    // A moved handle is invalid
+    auto reader_5 = hud::move(reader_4);
+    hud_assert_false(reader_4.is_valid());
+    hud_assert_true(reader_5.is_valid());
+}
+
+#if !defined(HD_TARGET_WASM_FAMILY)
+GTEST_TEST(read_mostly_hashmap, concurrent_readers_see_consistent_versions)
+{
+    constexpr usize READER_COUNT = 4;
+    constexpr usize KEY_COUNT = 64;
+    constexpr usize VERSION_COUNT = 200;
+    hud::read_mostly_hashmap<usize, usize> map;
+    map.update([](auto &version) {
+        for (usize key = 0; key < KEY_COUNT; key++)
+        {
+            version.add(key, usize {0});
+        }
+    });
+
+    hud::atomic<u32> is_writing_done {0};
+    hud::atomic<u32> inconsistent_count {0};
+    std::vector<std::thread> readers;
+    for (usize index = 0; index < READER_COUNT; index++)
+    {
+        readers.emplace_back([&]() {
+            auto reader = map.register_reader();
+            while (is_writing_done.load() == 0)
+            {
+                // Every value of a version is the same
+                const bool is_consistent = reader.read([](const auto &version) {
+                    const usize expected = version.find(usize {0})->value();
+                    for (const auto &element : version)
+                    {
+                        if (element.value() != expected)
+                        {
+                            return false;
+                        }
+                    }
+                    return version.count() == KEY_COUNT;
+                });
+                if (!is_consistent)
+                {
+                    inconsistent_count.add(1);
+                }
+            }
+        });
+    }
+
+    for (usize version_index = 1; version_index <= VERSION_COUNT; version_index++)
+    {
+        map.update([version_index](auto &version) {
+            for (auto &element : version)
+            {
+                element.value() = version_index;
+            }
+        });
+    }
+    is_writing_done.store(1);
+    for (std::thread &thread : readers)
+    {
+        thread.join();
+    }
+
+    hud_assert_eq(inconsistent_count.load(), 0u);
+    map.reclaim();
+    hud_assert_eq(map.retired_count(), 0u);
+    auto reader = map.register_reader();
+    hud_assert_eq(reader.find(usize {0}).value(), VERSION_COUNT);
+}
+#endif
@@ -1,5 +1,8 @@
 #include <core/containers/shared_pointer.h>
 #include <memory>
+#if !defined(HD_TARGET_WASM_FAMILY)
+    #include <thread>
+#endif
 
 GTEST_TEST(shared_pointer_safe, less_or_equal_size_as_std_unique_ptr)
 {
@@ -534,6 +537,38 @@ GTEST_TEST(shared_pointer_safe, make_shared)
     // constant evaluation do not allowed to reinterpret_cast the storage of the value to a pointer to that value
 }
 
+#if !defined(HD_TARGET_WASM_FAMILY)
+GTEST_TEST(shared_pointer_safe, make_shared_in_pool_released_by_other_threads)
+{
+    constexpr usize THREAD_COUNT = 4;
+    hud::pool pool;
+    i32 dtor_count = 0;
+    hud::atomic<bool> is_released {false};
+    std::thread threads[THREAD_COUNT];
+    {
+        auto shared_ptr = hud::make_shared<hud_test::non_bitwise_type, hud::thread_safety_e::safe>(hud::pool_allocator(pool), 123, &dtor_count);
+        for (std::thread &thread : threads) {
+            thread = std::thread([copy = shared_ptr, &is_released]() mutable {
+                while (!is_released.load()) {
+                }
+                hud_assert_eq(copy->id(), 123);
+                copy.reset();
+            });
+        }
+    }
+    // The last reference is released by one of the threads, the block is freed in the pool by this thread
+    is_released.store(true);
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    hud_assert_eq(dtor_count, 1);
+
+    const auto shared_ptr = hud::make_shared<hud_test::non_bitwise_type, hud::thread_safety_e::safe>(hud::pool_allocator(pool), 456, &dtor_count);
+    hud_assert_eq(shared_ptr->id(), 456);
+    hud_assert_eq(pool.slab_count(), 1u);
+}
+#endif
+
 GTEST_TEST(shared_pointer_safe, hash_32)
 {
 
@@ -557,6 +557,34 @@ GTEST_TEST(shared_pointer_not_safe, make_shared)
     // constant evaluation do not allowed to reinterpret_cast the storage of the value to a pointer to that value
 }
 
+GTEST_TEST(shared_pointer_not_safe, make_shared_in_pool)
+{
+    hud::pool pool;
+    i32 dtor_count = 0;
+    {
+        auto shared_ptr = hud::make_shared<hud_test::non_bitwise_type>(hud::pool_allocator(pool), 123, &dtor_count);
+        hud_assert_true((hud::is_same_v<decltype(shared_ptr.pointer()), hud_test::non_bitwise_type *>));
+        hud_assert_eq(shared_ptr->id(), 123);
+        hud_assert_eq(shared_ptr.shared_count(), 1u);
+        hud_assert_eq(pool.slab_count(), 1u);
+
+        hud::weak_pointer<hud_test::non_bitwise_type> weak_ptr = shared_ptr;
+        shared_ptr.reset();
+        // The object is destroyed but the controller is still referenced by the weak pointer
+        hud_assert_eq(dtor_count, 1);
+    }
+    hud_assert_eq(dtor_count, 1);
+
+    // The freed block is reused by the next allocation of the same size class
+    const auto first_ptr = hud::make_shared<i32>(hud::pool_allocator(pool), 0);
+    const usize slab_count = pool.slab_count();
+    for (i32 index = 0; index < 1000; index++) {
+        const auto shared_ptr = hud::make_shared<i32>(hud::pool_allocator(pool), index);
+        hud_assert_eq(*shared_ptr, index);
+    }
+    hud_assert_eq(pool.slab_count(), slab_count);
+}
+
 GTEST_TEST(shared_pointer_not_safe, hash_32)
 {
 
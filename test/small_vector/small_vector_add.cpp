@@ -0,0 +1,146 @@
+#include <core/containers/small_vector.h>
+#include "../misc/allocator_watcher.h"
+
+GTEST_TEST(small_vector, emplace_back_stay_inline_then_spill_to_the_heap)
+{
+    using type = hud_test::non_bitwise_type;
+    hud::small_vector<type, 4, hud_test::allocator_watcher<alignof(type)>> vector;
+
+    for (i32 index = 0; index < 4; index++) {
+        hud_assert_eq(vector.emplace_back(index, nullptr), static_cast<usize>(index));
+        hud_assert_true(vector.is_inline());
+        hud_assert_eq(vector.max_count(), 4u);
+    }
+    hud_assert_eq(vector.allocator().allocation_count(), 0u);
+
+    hud_assert_eq(vector.emplace_back(4, nullptr), 4u);
+    hud_assert_false(vector.is_inline());
+    hud_assert_eq(vector.count(), 5u);
+    // allocator_watcher grow exactly
+    hud_assert_eq(vector.max_count(), 5u);
+    hud_assert_eq(vector.allocator().allocation_count(), 1u);
+    hud_assert_eq(vector.allocator().free_count(), 0u);
+    for (i32 index = 0; index < 5; index++) {
+        hud_assert_eq(vector[index].id(), index);
+    }
+
+    // Emplace an element of the small_vector itself while the small_vector is full
+    while (vector.slack() > 0u) {
+        vector.emplace_back(0, nullptr);
+    }
+    const type &element = vector[1];
+    vector.add(element);
+    hud_assert_eq(vector.last().id(), 1);
+}
+
+GTEST_TEST(small_vector, emplace_back_to_ref)
+{
+    hud::small_vector<i32, 2> vector;
+    i32 &first = vector.emplace_back_to_ref(1);
+    hud_assert_eq(&first, vector.data());
+    hud_assert_eq(first, 1);
+    vector.emplace_back_to_ref(2) = 20;
+    hud_assert_eq(vector[1], 20);
+    i32 &third = vector.emplace_back_to_ref(3);
+    hud_assert_eq(&third, vector.data() + 2);
+    hud_assert_false(vector.is_inline());
+}
+
+GTEST_TEST(small_vector, emplace_at)
+{
+    using type = hud_test::non_bitwise_type;
+    hud::small_vector<type, 4, hud_test::allocator_watcher<alignof(type)>> vector;
+
+    // Inline
+    vector.emplace_at(0, 2, nullptr);
+    vector.emplace_at(0, 0, nullptr);
+    vector.emplace_at(1, 1, nullptr);
+    vector.emplace_at(3, 4, nullptr);
+    hud_assert_true(vector.is_inline());
+    hud_assert_eq(vector.count(), 4u);
+
+    // Spill to the heap
+    vector.emplace_at(3, 3, nullptr);
+    hud_assert_false(vector.is_inline());
+    hud_assert_eq(vector.count(), 5u);
+    for (i32 index = 0; index < 5; index++) {
+        hud_assert_eq(vector[index].id(), index);
+    }
+
+    hud_assert_eq(vector.emplace_at_to_ref(0, 42, nullptr).id(), 42);
+    hud_assert_eq(vector.first().id(), 42);
+}
+
+GTEST_TEST(small_vector, remove_at)
+{
+    using type = hud_test::non_bitwise_type;
+    i32 dtor_count[5] = {0, 0, 0, 0, 0};
+    hud::small_vector<type, 8> vector;
+    for (i32 index = 0; index < 5; index++) {
+        vector.emplace_back(index, &dtor_count[index]);
+    }
+
+    vector.remove_at(1, 2);
+    hud_assert_eq(vector.count(), 3u);
+    hud_assert_eq(vector[0].id(), 0);
+    hud_assert_eq(vector[1].id(), 3);
+    hud_assert_eq(vector[2].id(), 4);
+    hud_assert_eq(dtor_count[1], 1);
+    hud_assert_eq(dtor_count[2], 1);
+
+    vector.remove_at(2);
+    hud_assert_eq(vector.count(), 2u);
+    hud_assert_eq(vector.last().id(), 3);
+
+    // Trivially relocatable type
+    hud::small_vector<u32, 8> integers {0u, 1u, 2u, 3u, 4u};
+    integers.remove_at(0, 2);
+    hud_assert_eq(integers.count(), 3u);
+    hud_assert_eq(integers[0], 2u);
+    hud_assert_eq(integers[1], 3u);
+    hud_assert_eq(integers[2], 4u);
+}
+
+GTEST_TEST(small_vector, resize_reserve_and_shrink_to_fit)
+{
+    hud::small_vector<u32, 4, hud_test::allocator_watcher<alignof(u32)>> vector;
+    vector.resize(3);
+    hud_assert_true(vector.is_inline());
+    hud_assert_eq(vector.count(), 3u);
+    hud_assert_eq(vector[2], 0u);
+
+    // Reserve less than inline count do nothing
+    vector.reserve(4);
+    hud_assert_true(vector.is_inline());
+    hud_assert_eq(vector.allocator().allocation_count(), 0u);
+
+    vector.reserve(16);
+    hud_assert_false(vector.is_inline());
+    hud_assert_eq(vector.max_count(), 16u);
+    hud_assert_eq(vector.count(), 3u);
+    hud_assert_eq(vector.allocator().allocation_count(), 1u);
+
+    vector.resize(10);
+    hud_assert_eq(vector.count(), 10u);
+    hud_assert_eq(vector.max_count(), 16u);
+
+    vector.shrink_to_fit();
+    hud_assert_false(vector.is_inline());
+    hud_assert_eq(vector.max_count(), 10u);
+    hud_assert_eq(vector.allocator().allocation_count(), 2u);
+    hud_assert_eq(vector.allocator().free_count(), 1u);
+
+    // Go back inline
+    vector.resize(2);
+    vector[1] = 1u;
+    vector.shrink_to_fit();
+    hud_assert_true(vector.is_inline());
+    hud_assert_eq(vector.count(), 2u);
+    hud_assert_eq(vector.max_count(), 4u);
+    hud_assert_eq(vector[1], 1u);
+    hud_assert_eq(vector.allocator().free_count(), 2u);
+
+    vector.clear();
+    hud_assert_true(vector.is_empty());
+    hud_assert_true(vector.is_inline());
+}
@@ -0,0 +1,178 @@
+#include <core/containers/small_vector.h>
+#include "../misc/allocator_watcher.h"
+
+GTEST_TEST(small_vector, default_constructor_is_inline_and_do_not_allocate)
+{
+    hud::small_vector<i32, 4, hud_test::allocator_watcher<alignof(i32)>> vector;
+    hud_assert_true(vector.is_inline());
+    hud_assert_true(vector.is_empty());
+    hud_assert_ne(vector.data(), nullptr);
+    hud_assert_eq(vector.count(), 0u);
+    hud_assert_eq(vector.max_count(), 4u);
+    hud_assert_eq(vector.allocator().allocation_count(), 0u);
+    hud_assert_eq(vector.allocator().free_count(), 0u);
+}
+
+GTEST_TEST(small_vector, construct_with_initializer_list)
+{
+    // Fit inline
+    {
+        hud::small_vector<i32, 4, hud_test::allocator_watcher<alignof(i32)>> vector {1, 2, 3};
+        hud_assert_true(vector.is_inline());
+        hud_assert_eq(vector.count(), 3u);
+        hud_assert_eq(vector.max_count(), 4u);
+        hud_assert_eq(vector[0], 1);
+        hud_assert_eq(vector[1], 2);
+        hud_assert_eq(vector[2], 3);
+        hud_assert_eq(vector.allocator().allocation_count(), 0u);
+    }
+
+    // Spill to the heap
+    {
+        hud::small_vector<i32, 2, hud_test::allocator_watcher<alignof(i32)>> vector {1, 2, 3};
+        hud_assert_false(vector.is_inline());
+        hud_assert_eq(vector.count(), 3u);
+        hud_assert_eq(vector.max_count(), 3u);
+        hud_assert_eq(vector[0], 1);
+        hud_assert_eq(vector[1], 2);
+        hud_assert_eq(vector[2], 3);
+        hud_assert_eq(vector.allocator().allocation_count(), 1u);
+    }
+}
+
+GTEST_TEST(small_vector, copy_constructor)
+{
+    using type = hud_test::non_bitwise_type;
+    using vector_type = hud::small_vector<type, 2, hud_test::allocator_watcher<alignof(type)>>;
+
+    for (usize element_count = 0; element_count < 5; element_count++) {
+        vector_type vector;
+        for (usize index = 0; index < element_count; index++) {
+            vector.emplace_back(static_cast<i32>(index), nullptr);
+        }
+
+        vector_type copy(vector);
+        hud_assert_eq(copy.count(), element_count);
+        hud_assert_eq(copy.is_inline(), element_count <= 2u);
+        hud_assert_ne(copy.data(), vector.data());
+        for (usize index = 0; index < element_count; index++) {
+            hud_assert_eq(copy[index].id(), static_cast<i32>(index));
+            hud_assert_eq(copy[index].copy_constructor_count(), 1u);
+        }
+    }
+}
+
+GTEST_TEST(small_vector, move_constructor_relocate_inline_elements)
+{
+    using type = hud_test::non_bitwise_type;
+    using vector_type = hud::small_vector<type, 4, hud_test::allocator_watcher<alignof(type)>>;
+    i32 dtor_count[2] = {0, 0};
+
+    vector_type vector;
+    vector.emplace_back(0, &dtor_count[0]);
+    vector.emplace_back(1, &dtor_count[1]);
+
+    vector_type moved(hud::move(vector));
+    hud_assert_true(moved.is_inline());
+    hud_assert_eq(moved.count(), 2u);
+    hud_assert_eq(moved[0].id(), 0);
+    hud_assert_eq(moved[1].id(), 1);
+    hud_assert_eq(moved[0].move_constructor_count(), 1u);
+    hud_assert_eq(moved[1].move_constructor_count(), 1u);
+    // Moved elements are destroyed
+    hud_assert_eq(dtor_count[0], 1);
+    hud_assert_eq(dtor_count[1], 1);
+
+    hud_assert_true(vector.is_inline());
+    hud_assert_true(vector.is_empty());
+    hud_assert_eq(moved.allocator().allocation_count(), 0u);
+}
+
+GTEST_TEST(small_vector, move_constructor_steal_allocation)
+{
+    using type = hud_test::non_bitwise_type;
+    using vector_type = hud::small_vector<type, 2, hud_test::allocator_watcher<alignof(type)>>;
+
+    vector_type vector;
+    for (i32 index = 0; index < 5; index++) {
+        vector.emplace_back(index, nullptr);
+    }
+    hud_assert_false(vector.is_inline());
+    const type *data = vector.data();
+    const usize max_count = vector.max_count();
+    u32 move_constructor_count[5];
+    for (i32 index = 0; index < 5; index++) {
+        move_constructor_count[index] = vector[index].move_constructor_count();
+    }
+
+    vector_type moved(hud::move(vector));
+    hud_assert_false(moved.is_inline());
+    hud_assert_eq(moved.data(), data);
+    hud_assert_eq(moved.count(), 5u);
+    hud_assert_eq(moved.max_count(), max_count);
+    for (i32 index = 0; index < 5; index++) {
+        hud_assert_eq(moved[index].id(), index);
+        // No element is moved
+        hud_assert_eq(moved[index].move_constructor_count(), move_constructor_count[index]);
+    }
+
+    hud_assert_true(vector.is_inline());
+    hud_assert_true(vector.is_empty());
+    hud_assert_eq(vector.max_count(), 2u);
+}
+
+GTEST_TEST(small_vector, destructor_call_elements_destructor_and_free_allocation)
+{
+    using type = hud_test::non_bitwise_type;
+    i32 dtor_count[5] = {0, 0, 0, 0, 0};
+    {
+        hud::small_vector<type, 2> vector;
+        for (i32 index = 0; index < 5; index++) {
+            vector.emplace_back(index, &dtor_count[index]);
+        }
+        for (i32 index = 0; index < 5; index++) {
+            dtor_count[index] = 0;
+        }
+    }
+    for (i32 index = 0; index < 5; index++) {
+        hud_assert_eq(dtor_count[index], 1);
+    }
+}
+
+GTEST_TEST(small_vector, copy_and_move_assign)
+{
+    using type = hud_test::non_bitwise_type;
+    using vector_type = hud::small_vector<type, 2, hud_test::allocator_watcher<alignof(type)>>;
+
+    for (usize source_count = 0; source_count < 5; source_count++) {
+        for (usize destination_count = 0; destination_count < 5; destination_count++) {
+            vector_type source;
+            for (usize index = 0; index < source_count; index++) {
+                source.emplace_back(static_cast<i32>(index), nullptr);
+            }
+            vector_type destination;
+            for (usize index = 0; index < destination_count; index++) {
+                destination.emplace_back(static_cast<i32>(index + 10), nullptr);
+            }
+
+            destination = source;
+            hud_assert_eq(destination.count(), source_count);
+            for (usize index = 0; index < source_count; index++) {
+                hud_assert_eq(destination[index].id(), static_cast<i32>(index));
+            }
+
+            // The copy keep the allocation of the destination if it is big enough, the move steal it
+            const bool destination_is_inline = destination.is_inline();
+            vector_type moved;
+            moved.emplace_back(42, nullptr);
+            moved = hud::move(destination);
+            hud_assert_eq(moved.count(), source_count);
+            hud_assert_eq(moved.is_inline(), destination_is_inline);
+            for (usize index = 0; index < source_count; index++) {
+                hud_assert_eq(moved[index].id(), static_cast<i32>(index));
+            }
+            hud_assert_true(destination.is_empty());
+            hud_assert_true(destination.is_inline());
+        }
+    }
+}
@@ -0,0 +1,75 @@
+#include <core/containers/small_vector.h>
+
+GTEST_TEST(small_vector, find_and_contains)
+{
+    hud::small_vector<i32, 4> vector {1, 2, 3, 2, 5};
+    hud_assert_eq(vector.find_first_index(2), 1u);
+    hud_assert_eq(vector.find_last_index(2), 3u);
+    hud_assert_eq(vector.find_first_index(42), hud::index_none);
+    hud_assert_eq(vector.find_last_index(42), hud::index_none);
+    hud_assert_eq(vector.find_first_index_by_predicate([](const i32 value)
+                                                       { return value > 2; }),
+                  2u);
+    hud_assert_eq(vector.find_last_index_by_predicate([](const i32 value)
+                                                      { return value < 3; }),
+                  3u);
+    hud_assert_true(vector.contains(5));
+    hud_assert_false(vector.contains(0));
+    hud_assert_true(vector.contains_by_predicate([](const i32 value)
+                                                 { return value == 3; }));
+}
+
+GTEST_TEST(small_vector, slices)
+{
+    hud::small_vector<i32, 4> vector {0, 1, 2, 3};
+    hud::slice<i32> slice = vector.as_slice();
+    hud_assert_eq(slice.data(), vector.data());
+    hud_assert_eq(slice.count(), 4u);
+
+    hud::slice<i32> sub = vector.sub_slice(1, 2);
+    hud_assert_eq(sub.data(), vector.data() + 1);
+    hud_assert_eq(sub.count(), 2u);
+    hud_assert_eq(sub[0], 1);
+
+    const auto &const_vector = vector;
+    hud::slice<const i32> const_slice = const_vector.as_slice();
+    hud_assert_eq(const_slice.count(), 4u);
+}
+
+GTEST_TEST(small_vector, iteration)
+{
+    hud::small_vector<i32, 2> vector {0, 1, 2, 3};
+    i32 expected = 0;
+    for (const i32 value : vector) {
+        hud_assert_eq(value, expected);
+        expected++;
+    }
+    hud_assert_eq(expected, 4);
+}
+
+GTEST_TEST(small_vector, swap)
+{
+    hud::small_vector<i32, 2> inline_vector {0, 1};
+    hud::small_vector<i32, 2> heap_vector {2, 3, 4};
+    const i32 *heap_data = heap_vector.data();
+
+    hud::swap(inline_vector, heap_vector);
+    hud_assert_false(inline_vector.is_inline());
+    hud_assert_eq(inline_vector.data(), heap_data);
+    hud_assert_eq(inline_vector.count(), 3u);
+    hud_assert_eq(inline_vector[0], 2);
+    hud_assert_true(heap_vector.is_inline());
+    hud_assert_eq(heap_vector.count(), 2u);
+    hud_assert_eq(heap_vector[1], 1);
+}
+
+GTEST_TEST(small_vector, comparison)
+{
+    hud::small_vector<i32, 2> a {0, 1, 2};
+    hud::small_vector<i32, 4> b {0, 1, 2};
+    hud::small_vector<i32, 4> c {0, 1};
+    hud_assert_true(a == b);
+    hud_assert_false(a != b);
+    hud_assert_false(a == c);
+    hud_assert_true(a != c);
+}
@@ -93,4 +93,68 @@ GTEST_TEST(utf8, is_valid_utf8_portable)
         constexpr auto result_arabic = test_arabic();
         hud_assert_true(result_arabic);
     }
-}
\ No newline at end of file
+}
+
+GTEST_TEST(utf8, is_valid_utf8_accept_lipsum)
+{
+    const char8 latin_lipsum[] = LATIN_LIPSUM;
+    hud_assert_true(hud::encoding::is_valid_utf8(hud::slice {latin_lipsum, sizeof(latin_lipsum)}));
+    const char8 russian_lipsum[] = RUSSIAN_LIPSUM;
+    hud_assert_true(hud::encoding::is_valid_utf8(hud::slice {russian_lipsum, sizeof(russian_lipsum)}));
+    const char8 korean_lipsum[] = KOREAN_LIPSUM;
+    hud_assert_true(hud::encoding::is_valid_utf8(hud::slice {korean_lipsum, sizeof(korean_lipsum)}));
+    const char8 japanese_lipsum[] = JAPANESE_LIPSUM;
+    hud_assert_true(hud::encoding::is_valid_utf8(hud::slice {japanese_lipsum, sizeof(japanese_lipsum)}));
+    const char8 hindi_lipsum[] = HINDI_LIPSUM;
+    hud_assert_true(hud::encoding::is_valid_utf8(hud::slice {hindi_lipsum, sizeof(hindi_lipsum)}));
+    const char8 hebrew_lipsum[] = HEBREW_LIPSUM;
+    hud_assert_true(hud::encoding::is_valid_utf8(hud::slice {hebrew_lipsum, sizeof(hebrew_lipsum)}));
+    const char8 emoji_lipsum[] = EMOJI_LIPSUM;
+    hud_assert_true(hud::encoding::is_valid_utf8(hud::slice {emoji_lipsum, sizeof(emoji_lipsum)}));
+    const char8 chinese_lipsum[] = CHINESE_LIPSUM;
+    hud_assert_true(hud::encoding::is_valid_utf8(hud::slice {chinese_lipsum, sizeof(chinese_lipsum)}));
+    const char8 arabic_lipsum[] = ARABIC_LIPSUM;
+    hud_assert_true(hud::encoding::is_valid_utf8(hud::slice {arabic_lipsum, sizeof(arabic_lipsum)}));
+}
+
+GTEST_TEST(utf8, is_valid_utf8_match_portable_at_every_position)
+{
+    // Invalid sequences are inserted at every position of an ASCII buffer to cross SIMD block boundaries
+    const u8 sequences[][4] = {
+        {0xC3, 0xA9, 0x00, 0x00}, // Valid 2-byte
+        {0xE2, 0x82, 0xAC, 0x00}, // Valid 3-byte
+        {0xF0, 0x9F, 0x98, 0x80}, // Valid 4-byte
+        {0xC3, 0x41, 0x00, 0x00}, // Too short
+        {0x80, 0x41, 0x00, 0x00}, // Lone continuation
+        {0xC0, 0x80, 0x00, 0x00}, // Overlong 2-byte
+        {0xE0, 0x80, 0x80, 0x00}, // Overlong 3-byte
+        {0xF0, 0x80, 0x80, 0x80}, // Overlong 4-byte
+        {0xED, 0xA0, 0x80, 0x00}, // Surrogate
+        {0xF4, 0x90, 0x80, 0x80}, // Too large
+        {0xF8, 0x80, 0x80, 0x80}, // Invalid lead byte
+        {0xE2, 0x82, 0x00, 0x00}, // Truncated 3-byte
+    };
+    const usize sequence_lengths[] = {2, 3, 4, 2, 2, 2, 3, 4, 3, 4, 4, 3};
+
+    for (usize sequence_index = 0; sequence_index < sizeof(sequence_lengths) / sizeof(usize); sequence_index++) {
+        for (usize buffer_size = 1; buffer_size <= 70; buffer_size++) {
+            for (usize position = 0; position < buffer_size; position++) {
+                char8 buffer[74];
+                hud::memory::set_memory(buffer, 'a');
+                for (usize index = 0; index < sequence_lengths[sequence_index]; index++) {
+                    buffer[position + index] = static_cast<char8>(sequences[sequence_index][index]);
+                }
+                // The sequence can be truncated by the end of the buffer
+                const hud::slice<char8> string(buffer, buffer_size);
+                const bool expected = hud::encoding::is_valid_utf8_portable(string);
+                hud_assert_eq(hud::encoding::is_valid_utf8(string), expected);
+#if HD_SSE4_2
+                hud_assert_eq(hud::encoding::is_valid_utf8_sse4_2(string), expected);
+#endif
+#if HD_AVX2
+                hud_assert_eq(hud::encoding::is_valid_utf8_avx2(string), expected);
+#endif
+            }
+        }
+    }
+}
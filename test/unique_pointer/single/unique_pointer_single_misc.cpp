@@ -318,6 +318,27 @@ GTEST_TEST(unique_pointer, make_unique)
     }
 }
 
+GTEST_TEST(unique_pointer, make_unique_in_pool)
+{
+    hud::pool pool;
+    i32 dtor_count = 0;
+    hud_test::non_bitwise_type *first_pointer = nullptr;
+    {
+        hud::unique_pointer<hud_test::non_bitwise_type, hud::pool_deleter<hud_test::non_bitwise_type>> ptr = hud::make_unique<hud_test::non_bitwise_type>(hud::pool_allocator(pool), 123, &dtor_count);
+        hud_assert_eq(ptr->id(), 123);
+        hud_assert_eq(ptr.deleter().allocator().pool(), &pool);
+        hud_assert_eq(pool.slab_count(), 1u);
+        first_pointer = ptr.pointer();
+    }
+    hud_assert_eq(dtor_count, 1);
+
+    // The freed block is reused by the next allocation
+    auto ptr = hud::make_unique<hud_test::non_bitwise_type>(hud::pool_allocator(pool), 456, &dtor_count);
+    hud_assert_eq(ptr.pointer(), first_pointer);
+    hud_assert_eq(ptr->id(), 456);
+    hud_assert_eq(pool.slab_count(), 1u);
+}
+
 GTEST_TEST(unique_pointer, hash_32)
 {
 
@@ -0,0 +1,177 @@
+#include <core/containers/vector.h>
+#include <core/allocators/heap_allocator.h>
+#include "../misc/allocator_watcher.h"
+
+namespace hud_test
+{
+    template<typename growth_policy_t>
+    struct growth_policy_allocator
+        : public hud_test::allocator_watcher<alignof(usize)>
+    {
+    };
+} // namespace hud_test
+
+namespace hud
+{
+    template<typename growth_policy_t>
+    struct allocator_traits<hud_test::growth_policy_allocator<growth_policy_t>>
+    {
+        using is_always_equal = hud::true_type;
+        using copy_when_container_copy_assigned = hud::false_type;
+        using move_when_container_move_assigned = hud::false_type;
+        using swap_when_container_swap = hud::false_type;
+        using can_reallocate = hud::false_type;
+        using growth_policy = growth_policy_t;
+    };
+} // namespace hud
+
+GTEST_TEST(vector, growth_policy_grow)
+{
+    // Geometric 1.5x
+    hud_assert_eq(hud::growth_policy_1_5x::grow(0u, 1u), 1u);
+    hud_assert_eq(hud::growth_policy_1_5x::grow(1u, 2u), 2u);
+    hud_assert_eq(hud::growth_policy_1_5x::grow(4u, 5u), 6u);
+    hud_assert_eq(hud::growth_policy_1_5x::grow(4u, 10u), 10u);
+    hud_assert_eq(hud::growth_policy_1_5x::grow(hud::usize_max / 2u, hud::usize_max / 2u + 1u), hud::usize_max);
+
+    // Geometric 2x
+    hud_assert_eq(hud::growth_policy_2x::grow(0u, 1u), 1u);
+    hud_assert_eq(hud::growth_policy_2x::grow(1u, 2u), 2u);
+    hud_assert_eq(hud::growth_policy_2x::grow(4u, 5u), 8u);
+    hud_assert_eq(hud::growth_policy_2x::grow(4u, 10u), 10u);
+
+    // Fixed chunk
+    hud_assert_eq(hud::fixed_chunk_growth_policy<16u>::grow(0u, 1u), 16u);
+    hud_assert_eq(hud::fixed_chunk_growth_policy<16u>::grow(16u, 17u), 32u);
+    hud_assert_eq(hud::fixed_chunk_growth_policy<16u>::grow(16u, 32u), 32u);
+    hud_assert_eq(hud::fixed_chunk_growth_policy<16u>::grow(0u, 40u), 48u);
+
+    // Exact
+    hud_assert_eq(hud::exact_growth_policy::grow(0u, 1u), 1u);
+    hud_assert_eq(hud::exact_growth_policy::grow(4u, 5u), 5u);
+}
+
+GTEST_TEST(vector, growth_policy_default_is_geometric)
+{
+    hud_assert_true((hud::is_same_v<hud::allocator_traits<hud::aligned_heap_allocator<8>>::growth_policy, hud::default_growth_policy>));
+    hud_assert_true((hud::is_same_v<hud::allocator_traits<hud::heap_allocator>::growth_policy, hud::default_growth_policy>));
+
+    hud::vector<usize> vector;
+    usize reallocation_count = 0u;
+    usize previous_max_count = vector.max_count();
+    for (usize index = 0; index < 1000u; index++) {
+        vector.add(index);
+        if (vector.max_count() != previous_max_count) {
+            hud_assert_eq(vector.max_count(), hud::default_growth_policy::grow(previous_max_count, index + 1u));
+            previous_max_count = vector.max_count();
+            reallocation_count++;
+        }
+    }
+    hud_assert_eq(vector.count(), 1000u);
+    // 1.5x growth need 18 reallocations to reach 1000 elements instead of 1000
+    hud_assert_eq(reallocation_count, 18u);
+    for (usize index = 0; index < 1000u; index++) {
+        hud_assert_eq(vector[index], index);
+    }
+}
+
+GTEST_TEST(vector, growth_policy_is_applied_by_emplace_back)
+{
+    const auto test = []()
+    {
+        hud::vector<usize, hud_test::growth_policy_allocator<hud::growth_policy_2x>> vector;
+        for (usize index = 0; index < 9u; index++) {
+            vector.emplace_back(index);
+        }
+        bool all_values_are_correct = true;
+        for (usize index = 0; index < 9u; index++) {
+            all_values_are_correct &= vector[index] == index;
+        }
+        return std::tuple {
+            vector.count(),
+            vector.max_count(),
+            vector.allocator().allocation_count(),
+            vector.allocator().free_count(),
+            all_values_are_correct
+        };
+    };
+
+    // Non constant
+    {
+        const auto result = test();
+        hud_assert_eq(std::get<0>(result), 9u);
+        hud_assert_eq(std::get<1>(result), 16u);
+        // 1, 2, 4, 8, 16
+        hud_assert_eq(std::get<2>(result), 5u);
+        hud_assert_eq(std::get<3>(result), 4u);
+        hud_assert_true(std::get<4>(result));
+    }
+
+    // Constant
+    {
+        constexpr auto result = test();
+        hud_assert_eq(std::get<0>(result), 9u);
+        hud_assert_eq(std::get<1>(result), 16u);
+        hud_assert_eq(std::get<2>(result), 5u);
+        hud_assert_eq(std::get<3>(result), 4u);
+        hud_assert_true(std::get<4>(result));
+    }
+}
+
+GTEST_TEST(vector, growth_policy_is_applied_by_emplace_at)
+{
+    hud::vector<usize, hud_test::growth_policy_allocator<hud::growth_policy_2x>> vector;
+    for (usize index = 0; index < 9u; index++) {
+        vector.emplace_at(0, index);
+    }
+    hud_assert_eq(vector.count(), 9u);
+    hud_assert_eq(vector.max_count(), 16u);
+    hud_assert_eq(vector.allocator().allocation_count(), 5u);
+    hud_assert_eq(vector.allocator().free_count(), 4u);
+    for (usize index = 0; index < 9u; index++) {
+        hud_assert_eq(vector[index], 8u - index);
+    }
+}
+
+GTEST_TEST(vector, growth_policy_is_applied_by_add_no_construct_and_resize)
+{
+    hud::vector<usize, hud_test::growth_policy_allocator<hud::fixed_chunk_growth_policy<16u>>> vector;
+    vector.add_no_construct(1u);
+    hud_assert_eq(vector.count(), 1u);
+    hud_assert_eq(vector.max_count(), 16u);
+    hud_assert_eq(vector.allocator().allocation_count(), 1u);
+
+    vector.resize(16u);
+    hud_assert_eq(vector.count(), 16u);
+    hud_assert_eq(vector.max_count(), 16u);
+    hud_assert_eq(vector.allocator().allocation_count(), 1u);
+
+    vector.resize(17u);
+    hud_assert_eq(vector.count(), 17u);
+    hud_assert_eq(vector.max_count(), 32u);
+    hud_assert_eq(vector.allocator().allocation_count(), 2u);
+    hud_assert_eq(vector.allocator().free_count(), 1u);
+
+    vector.add(0u);
+    hud_assert_eq(vector.count(), 18u);
+    hud_assert_eq(vector.max_count(), 32u);
+    hud_assert_eq(vector.allocator().allocation_count(), 2u);
+}
+
+GTEST_TEST(vector, growth_policy_is_not_applied_by_reserve)
+{
+    hud::vector<usize, hud_test::growth_policy_allocator<hud::growth_policy_2x>> vector;
+    vector.reserve(5u);
+    hud_assert_eq(vector.max_count(), 5u);
+    hud_assert_eq(vector.allocator().allocation_count(), 1u);
+    vector.reserve(7u);
+    hud_assert_eq(vector.max_count(), 7u);
+    hud_assert_eq(vector.allocator().allocation_count(), 2u);
+
+    // Growing after reserve use the policy
+    for (usize index = 0; index < 8u; index++) {
+        vector.add(index);
+    }
+    hud_assert_eq(vector.max_count(), 14u);
+    hud_assert_eq(vector.allocator().allocation_count(), 3u);
+}
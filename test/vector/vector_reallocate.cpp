@@ -0,0 +1,229 @@
+#include <core/containers/vector.h>
+#include "../misc/allocator_watcher.h"
+
+namespace hud_test
+{
+    /** Allocator that count allocations and reallocations. */
+    template<u32 alignment>
+    struct reallocate_watcher
+        : public hud_test::allocator_watcher<alignment>
+    {
+        template<typename type_t>
+        using memory_allocation_type = hud::memory_allocation<type_t>;
+
+        template<typename type_t>
+        [[nodiscard]] memory_allocation_type<type_t> reallocate(const memory_allocation_type<type_t> &buffer, const usize count) noexcept
+        {
+            count_of_reallocate++;
+            return allocator.template reallocate<type_t>(buffer, count);
+        }
+
+        /** Retrieves the count of reallocations done. */
+        constexpr u32 reallocation_count() const noexcept
+        {
+            return count_of_reallocate;
+        }
+
+    private:
+        hud::aligned_heap_allocator<alignment> allocator;
+        u32 count_of_reallocate = 0u;
+    };
+
+    /** Allocator that count allocations and reallocations, every reallocation fails. */
+    template<u32 alignment>
+    struct failing_reallocate_watcher
+        : public hud_test::allocator_watcher<alignment>
+    {
+        template<typename type_t>
+        using memory_allocation_type = hud::memory_allocation<type_t>;
+
+        template<typename type_t>
+        [[nodiscard]] memory_allocation_type<type_t> reallocate(const memory_allocation_type<type_t> &, const usize) noexcept
+        {
+            count_of_reallocate++;
+            return memory_allocation_type<type_t> {};
+        }
+
+        /** Retrieves the count of reallocations done. */
+        constexpr u32 reallocation_count() const noexcept
+        {
+            return count_of_reallocate;
+        }
+
+    private:
+        u32 count_of_reallocate = 0u;
+    };
+} // namespace hud_test
+
+namespace hud
+{
+    template<u32 alignment>
+    struct allocator_traits<hud_test::reallocate_watcher<alignment>>
+    {
+        using is_always_equal = hud::true_type;
+        using copy_when_container_copy_assigned = hud::false_type;
+        using move_when_container_move_assigned = hud::false_type;
+        using swap_when_container_swap = hud::false_type;
+        using can_reallocate = hud::true_type;
+        using growth_policy = hud::exact_growth_policy;
+    };
+
+    template<u32 alignment>
+    struct allocator_traits<hud_test::failing_reallocate_watcher<alignment>>
+    {
+        using is_always_equal = hud::true_type;
+        using copy_when_container_copy_assigned = hud::false_type;
+        using move_when_container_move_assigned = hud::false_type;
+        using swap_when_container_swap = hud::false_type;
+        using can_reallocate = hud::true_type;
+        using growth_policy = hud::exact_growth_policy;
+    };
+} // namespace hud
+
+GTEST_TEST(vector, reserve_reallocate_trivially_relocatable_type)
+{
+    using type = usize;
+    hud::vector<type, hud_test::reallocate_watcher<alignof(type)>> vector;
+    vector.reserve(2u);
+    hud_assert_eq(vector.max_count(), 2u);
+    hud_assert_eq(vector.allocator().reallocation_count(), 1u);
+    hud_assert_eq(vector.allocator().allocation_count(), 0u);
+
+    vector.add(1u);
+    vector.add(2u);
+    vector.reserve(1024u * 1024u);
+    hud_assert_eq(vector.count(), 2u);
+    hud_assert_eq(vector.max_count(), 1024u * 1024u);
+    hud_assert_eq(vector[0], 1u);
+    hud_assert_eq(vector[1], 2u);
+    hud_assert_eq(vector.allocator().reallocation_count(), 2u);
+    hud_assert_eq(vector.allocator().allocation_count(), 0u);
+    hud_assert_eq(vector.allocator().free_count(), 0u);
+}
+
+GTEST_TEST(vector, emplace_back_reallocate_trivially_relocatable_type)
+{
+    using type = usize;
+    hud::vector<type, hud_test::reallocate_watcher<alignof(type)>> vector;
+    for (usize index = 0; index < 100u; index++) {
+        vector.emplace_back(index);
+    }
+    hud_assert_eq(vector.count(), 100u);
+    hud_assert_eq(vector.allocator().reallocation_count(), 100u);
+    hud_assert_eq(vector.allocator().allocation_count(), 0u);
+    for (usize index = 0; index < 100u; index++) {
+        hud_assert_eq(vector[index], index);
+    }
+
+    // Emplace an element of the vector itself while the vector is full
+    hud_assert_eq(vector.count(), vector.max_count());
+    vector.add(vector[42]);
+    hud_assert_eq(vector.count(), 101u);
+    hud_assert_eq(vector[100], 42u);
+    hud_assert_eq(vector.allocator().reallocation_count(), 101u);
+}
+
+GTEST_TEST(vector, emplace_at_reallocate_trivially_relocatable_type)
+{
+    using type = usize;
+    hud::vector<type, hud_test::reallocate_watcher<alignof(type)>> vector;
+    for (usize index = 0; index < 10u; index++) {
+        vector.emplace_at(0u, index);
+    }
+    hud_assert_eq(vector.count(), 10u);
+    hud_assert_eq(vector.allocator().reallocation_count(), 10u);
+    hud_assert_eq(vector.allocator().allocation_count(), 0u);
+    for (usize index = 0; index < 10u; index++) {
+        hud_assert_eq(vector[index], 9u - index);
+    }
+
+    // Emplace an element of the vector itself while the vector is full
+    vector.emplace_at(5u, vector[0]);
+    hud_assert_eq(vector.count(), 11u);
+    hud_assert_eq(vector[4], 5u);
+    hud_assert_eq(vector[5], 9u);
+    hud_assert_eq(vector[6], 4u);
+}
+
+GTEST_TEST(vector, resize_reallocate_trivially_relocatable_type)
+{
+    using type = usize;
+    hud::vector<type, hud_test::reallocate_watcher<alignof(type)>> vector;
+    vector.resize(4u);
+    vector[3] = 3u;
+    vector.resize(4096u);
+    hud_assert_eq(vector.count(), 4096u);
+    hud_assert_eq(vector[3], 3u);
+    hud_assert_eq(vector.allocator().reallocation_count(), 2u);
+    hud_assert_eq(vector.allocator().allocation_count(), 0u);
+}
+
+GTEST_TEST(vector, grow_allocate_when_reallocate_fails)
+{
+    using type = usize;
+    hud::vector<type, hud_test::failing_reallocate_watcher<alignof(type)>> vector;
+    vector.reserve(2u);
+    hud_assert_eq(vector.max_count(), 2u);
+    hud_assert_eq(vector.allocator().reallocation_count(), 1u);
+    hud_assert_eq(vector.allocator().allocation_count(), 1u);
+
+    vector.add(1u);
+    vector.add(2u);
+    vector.add(3u);
+    hud_assert_eq(vector.count(), 3u);
+    hud_assert_eq(vector.max_count(), 3u);
+    hud_assert_eq(vector[0], 1u);
+    hud_assert_eq(vector[1], 2u);
+    hud_assert_eq(vector[2], 3u);
+    hud_assert_eq(vector.allocator().reallocation_count(), 2u);
+    hud_assert_eq(vector.allocator().allocation_count(), 2u);
+    hud_assert_eq(vector.allocator().free_count(), 1u);
+
+    vector.emplace_at(0u, 0u);
+    hud_assert_eq(vector.count(), 4u);
+    for (usize index = 0; index < 4u; index++) {
+        hud_assert_eq(vector[index], index);
+    }
+    hud_assert_eq(vector.allocator().reallocation_count(), 3u);
+    hud_assert_eq(vector.allocator().allocation_count(), 3u);
+    hud_assert_eq(vector.allocator().free_count(), 2u);
+}
+
+GTEST_TEST(vector, grow_do_not_reallocate_non_trivially_relocatable_type)
+{
+    using type = hud_test::non_bitwise_type;
+    hud::vector<type, hud_test::reallocate_watcher<alignof(type)>> vector;
+    vector.reserve(2u);
+    vector.emplace_back(1, nullptr);
+    vector.emplace_back(2, nullptr);
+    vector.emplace_back(3, nullptr);
+    vector.emplace_at(0u, 0, nullptr);
+    hud_assert_eq(vector.count(), 4u);
+    hud_assert_eq(vector.allocator().reallocation_count(), 0u);
+    hud_assert_eq(vector.allocator().allocation_count(), 3u);
+    for (usize index = 0; index < 4u; index++) {
+        hud_assert_eq(vector[index].id(), static_cast<i32>(index));
+    }
+}
+
+GTEST_TEST(vector, grow_do_not_reallocate_in_constant_evaluated_expression)
+{
+    constexpr auto test = []()
+    {
+        hud::vector<usize, hud_test::reallocate_watcher<alignof(usize)>> vector;
+        vector.reserve(1u);
+        vector.emplace_back(1u);
+        vector.emplace_back(2u);
+        return std::tuple {
+            vector.count(),
+            vector[1],
+            vector.allocator().allocation_count(),
+            vector.allocator().reallocation_count()
+        };
+    };
+    constexpr auto result = test();
+    hud_assert_eq(std::get<0>(result), 2u);
+    hud_assert_eq(std::get<1>(result), 2u);
+    hud_assert_eq(std::get<2>(result), 2u);
+    hud_assert_eq(std::get<3>(result), 0u);
+}